@@ -32,6 +32,8 @@
 #  endif
 #endif
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -91,6 +93,18 @@ enum MDAL_DataLocation
   DataOnEdges
 };
 
+/**
+ * HDF5 file drivers used to open the HDF5 files for reading
+ * \since MDAL 0.8.0
+ */
+enum MDAL_Hdf5FileDriver
+{
+  //! Files are read from disk with POSIX I/O, default of the HDF5 library
+  Hdf5Sec2 = 0,
+  //! Files are fully read in memory when opened
+  Hdf5Core
+};
+
 typedef void *MDAL_MeshH;
 typedef void *MDAL_MeshVertexIteratorH;
 typedef void *MDAL_MeshEdgeIteratorH;
@@ -98,6 +112,7 @@ typedef void *MDAL_MeshFaceIteratorH;
 typedef void *MDAL_DatasetGroupH;
 typedef void *MDAL_DatasetH;
 typedef void *MDAL_DriverH;
+typedef void *MDAL_MeshSummaryH;
 
 typedef void ( *MDAL_LoggerCallback )( MDAL_LogLevel logLevel, MDAL_Status status, const char *message );
 
@@ -108,6 +123,9 @@ MDAL_EXPORT const char *MDAL_Version();
 
 /**
  * Returns last status message
+ *
+ * The status is kept per thread, it is the last status set by the calls made from the calling thread,
+ * including the failures of the worker threads used by these calls.
  */
 MDAL_EXPORT MDAL_Status MDAL_LastStatus();
 
@@ -117,6 +135,10 @@ MDAL_EXPORT MDAL_Status MDAL_LastStatus();
  * By default standard stdout is used as output.
  * Calling this method with nullptr dissables logger ( logs will not be shown anywhere ).
  * MDAL_LoggerCallback is a function accepting MDAL_LogLevel, MDAL_Status and const char* string
+ *
+ * The callback is called from the thread logging the message, which may be a thread reading datasets
+ * or a worker thread of MDAL (see MDAL_SetThreadCount()). It can be called from several threads at once,
+ * without synchronization, so it must be thread safe. The callback should be set before any other thread uses MDAL.
  * \since MDAL 0.6.0
  */
 MDAL_EXPORT void MDAL_SetLoggerCallback( MDAL_LoggerCallback callback );
@@ -131,6 +153,98 @@ MDAL_EXPORT void MDAL_SetLoggerCallback( MDAL_LoggerCallback callback );
  */
 MDAL_EXPORT void MDAL_SetLogVerbosity( MDAL_LogLevel verbosity );
 
+/**
+ * Sets the maximum size in bytes of the raw data chunk cache of each HDF5 dataset opened for reading
+ *
+ * The chunk cache of a chunked dataset is sized to hold the chunks covering one index of its first dimension
+ * (usually one timestep), limited by \a bytes, so the chunks are not decompressed again when the values
+ * of a timestep are read in several calls. By default, 1 MB, the default of the HDF5 library.
+ *
+ * This is a cap for each dataset, not a budget shared by the datasets: every opened chunked dataset has its own
+ * cache, so the memory used can reach \a bytes times the count of HDF5 datasets kept open, which is up to one
+ * per dataset group or per dataset for some drivers.
+ * Applies to the datasets opened after the call. Does nothing if MDAL is built without HDF5.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetHdf5DatasetChunkCacheSize( int64_t bytes );
+
+/**
+ * Sets the HDF5 file driver used to open the HDF5 files for reading
+ *
+ * With Hdf5Core, the whole file is read in memory when opened, including when the drivers check if they can read the file.
+ * By default Hdf5Sec2. Applies to the files opened after the call. Does nothing if MDAL is built without HDF5.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetHdf5FileDriver( MDAL_Hdf5FileDriver driver );
+
+/**
+ * Sets the maximum size in bytes of the cache of the dataset values read from NetCDF files
+ *
+ * The values of a timestep are read from NetCDF files by blocks, kept in a least recently used cache shared by all
+ * the opened files, so the blocks are not read again when the values of a timestep are read in several calls.
+ * The blocks of a file are removed from the cache when the file is closed. With 0, the blocks are not cached.
+ * By default, 64 MB. The least recently used blocks are removed if the cache is larger than the new size.
+ * Does nothing if MDAL is built without NetCDF.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetNetCDFBlockCacheSize( int64_t bytes );
+
+/**
+ * Returns the maximum size in bytes of the cache of the dataset values read from NetCDF files, see MDAL_SetNetCDFBlockCacheSize()
+ * Returns 0 if MDAL is built without NetCDF
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_NetCDFBlockCacheSize();
+
+/**
+ * Sets the maximum count of threads used for parallel computations, such as the statistics of the datasets of a group
+ *
+ * With 0 (default), the count of hardware threads is used. With 1, computations run in the calling thread.
+ * Results do not depend on the count of threads.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetThreadCount( int count );
+
+/**
+ * Returns the maximum count of threads used for parallel computations, see MDAL_SetThreadCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int MDAL_ThreadCount();
+
+/**
+ * Enables or disables the cache of the statistics of the datasets
+ *
+ * When enabled, the minimum, maximum and histograms of the datasets computed while a mesh is opened are written in a cache file
+ * when the mesh is closed, and are read from it when the file is opened again, so they are not computed again.
+ * The cache of a file is ignored once the size or the modification time of the file change.
+ * Cache files are written next to the files, with the .mdalcache suffix, unless a directory is set with
+ * MDAL_SetStatisticsCacheDirectory(). Disabled by default.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetStatisticsCacheEnabled( bool enabled );
+
+/**
+ * Returns whether the cache of the statistics of the datasets is enabled, see MDAL_SetStatisticsCacheEnabled()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT bool MDAL_StatisticsCacheEnabled();
+
+/**
+ * Sets the directory where the cache files of the statistics are written, see MDAL_SetStatisticsCacheEnabled()
+ *
+ * The directory must exist. With nullptr or an empty string (default), cache files are written next to the files.
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_SetStatisticsCacheDirectory( const char *directory );
+
+/**
+ * Returns the directory where the cache files of the statistics are written, empty if they are written next to the files
+ *
+ * not thread-safe and valid only till next call
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const char *MDAL_StatisticsCacheDirectory();
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// DRIVERS
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -210,6 +324,20 @@ MDAL_EXPORT const char *MDAL_DR_filters( MDAL_DriverH driver );
  */
 MDAL_EXPORT MDAL_MeshH MDAL_LoadMesh( const char *uri );
 
+/**
+ * Loads mesh file as MDAL_LoadMesh(), restricting what is loaded with the null terminated list of KEY=VALUE \a options:
+ *
+ * - GROUPS=<name1>,<name2>,... loads only the dataset groups with these names, compared case insensitively
+ * - TIME_START=<hours> and TIME_END=<hours> load only the datasets with time in this window, relative to the reference time.
+ *   Groups with a single dataset (bed elevation, maximums, ...) are not restricted by the time window
+ *
+ * Drivers supporting it skip the parsing of the excluded groups and datasets, others load them and they are removed afterwards.
+ * Unknown options are ignored. \a options can be null
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT MDAL_MeshH MDAL_LoadMeshWithOptions( const char *uri, const char *const *options );
+
 /**
  * Returns uris that the resource contains (mesh names)
  * Uris are separated by ;; and have form <DriverName>:"<MeshFilePath>"[:<SpecificMeshName>]
@@ -299,17 +427,35 @@ MDAL_EXPORT void MDAL_M_addFaces( MDAL_MeshH mesh,
  */
 MDAL_EXPORT int MDAL_M_vertexCount( MDAL_MeshH mesh );
 
+/**
+ * Returns vertex count for the mesh, 64 bits version of MDAL_M_vertexCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_M_vertexCount64( MDAL_MeshH mesh );
+
 /**
  * Returns edge count for the mesh
  * \since MDAL 0.6.0
  */
 MDAL_EXPORT int MDAL_M_edgeCount( MDAL_MeshH mesh );
 
+/**
+ * Returns edge count for the mesh, 64 bits version of MDAL_M_edgeCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_M_edgeCount64( MDAL_MeshH mesh );
+
 /**
  * Returns face count for the mesh
  */
 MDAL_EXPORT int MDAL_M_faceCount( MDAL_MeshH mesh );
 
+/**
+ * Returns face count for the mesh, 64 bits version of MDAL_M_faceCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_M_faceCount64( MDAL_MeshH mesh );
+
 /**
  * Returns maximum number of vertices face can consist of, e.g. 4 for regular quad mesh
  */
@@ -323,6 +469,14 @@ MDAL_EXPORT int MDAL_M_faceVerticesMaximumCount( MDAL_MeshH mesh );
  */
 MDAL_EXPORT void MDAL_M_LoadDatasets( MDAL_MeshH mesh, const char *datasetFile );
 
+/**
+ * Loads dataset file as MDAL_M_LoadDatasets(), restricting the dataset groups and the datasets loaded with the
+ * null terminated list of KEY=VALUE \a options, see MDAL_LoadMeshWithOptions(). \a options can be null
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_M_LoadDatasetsWithOptions( MDAL_MeshH mesh, const char *datasetFile, const char *const *options );
+
 /**
  * Returns dataset groups count
  */
@@ -365,6 +519,124 @@ MDAL_EXPORT MDAL_DatasetGroupH MDAL_M_addDatasetGroup(
  */
 MDAL_EXPORT const char *MDAL_M_driverName( MDAL_MeshH mesh );
 
+///////////////////////////////////////////////////////////////////////////////////////
+/// MESH SUMMARY
+///////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Loads the summary of a mesh file: driver, projection, extent, element counts and dataset groups with their time range,
+ * without building the mesh topology nor reading the dataset values when the driver supports it, otherwise the mesh
+ * is loaded and closed. On error see MDAL_LastStatus for error type.
+ * The uri has the same format as in MDAL_LoadMesh().
+ * Caller must free memory with MDAL_CloseMeshSummary() afterwards
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT MDAL_MeshSummaryH MDAL_LoadMeshSummary( const char *uri );
+
+/**
+ * Closes the mesh summary, frees the memory
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_CloseMeshSummary( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns name of the MDAL driver of the summarized mesh
+ * not thread-safe and valid only till next call
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const char *MDAL_MS_driverName( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns projection of the summarized mesh, see MDAL_M_projection()
+ * not thread-safe and valid only till next call
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const char *MDAL_MS_projection( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns extent of the summarized mesh, see MDAL_M_extent()
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_MS_extent( MDAL_MeshSummaryH summary, double *minX, double *maxX, double *minY, double *maxY );
+
+/**
+ * Returns vertex count of the summarized mesh
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_MS_vertexCount( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns edge count of the summarized mesh
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_MS_edgeCount( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns face count of the summarized mesh
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_MS_faceCount( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns dataset group count of the summarized mesh
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int MDAL_MS_datasetGroupCount( MDAL_MeshSummaryH summary );
+
+/**
+ * Returns name of the dataset group with \a index, same order as MDAL_M_datasetGroup()
+ * not thread-safe and valid only till next call
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const char *MDAL_MS_datasetGroupName( MDAL_MeshSummaryH summary, int index );
+
+/**
+ * Returns data location of the dataset group with \a index
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT MDAL_DataLocation MDAL_MS_datasetGroupDataLocation( MDAL_MeshSummaryH summary, int index );
+
+/**
+ * Returns whether the dataset group with \a index has scalar data
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT bool MDAL_MS_datasetGroupHasScalarData( MDAL_MeshSummaryH summary, int index );
+
+/**
+ * Returns dataset count of the dataset group with \a index
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int MDAL_MS_datasetGroupDatasetCount( MDAL_MeshSummaryH summary, int index );
+
+/**
+ * Sets \a startTime and \a endTime with the earliest and latest times of the datasets of the dataset group with \a index,
+ * in hours relative to its reference time
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_MS_datasetGroupTimeRange( MDAL_MeshSummaryH summary, int index, double *startTime, double *endTime );
+
+/**
+ * Returns reference time of the dataset group with \a index in ISO8601 format, see MDAL_G_referenceTime()
+ * not thread-safe and valid only till next call
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const char *MDAL_MS_datasetGroupReferenceTime( MDAL_MeshSummaryH summary, int index );
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// MESH VERTICES
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -384,11 +656,32 @@ MDAL_EXPORT MDAL_MeshVertexIteratorH MDAL_M_vertexIterator( MDAL_MeshH mesh );
  */
 MDAL_EXPORT int MDAL_VI_next( MDAL_MeshVertexIteratorH iterator, int verticesCount, double *coordinates );
 
+/**
+ * Returns vertices from iterator for the mesh, 64 bits version of MDAL_VI_next()
+ * A negative \a verticesCount is rejected with Err_InvalidData status
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_VI_next64( MDAL_MeshVertexIteratorH iterator, int64_t verticesCount, double *coordinates );
+
 /**
  * Closes mesh data iterator, frees the memory
  */
 MDAL_EXPORT void MDAL_VI_close( MDAL_MeshVertexIteratorH iterator );
 
+/**
+ * Returns a read-only pointer to the vertex coordinates of the mesh, without copy,
+ * stored in form x1, y1, z1, ..., xN, yN, zN (same layout as MDAL_VI_next())
+ *
+ * Only available for meshes stored in memory, for other meshes, returns nullptr without
+ * changing MDAL_LastStatus(), use MDAL_M_vertexIterator() instead.
+ * The pointer is valid until the mesh is modified or closed.
+ *
+ * \param mesh mesh handle
+ * \param vertexCount set to the count of vertices of the view
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const double *MDAL_M_verticesView( MDAL_MeshH mesh, int64_t *vertexCount );
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// MESH EDGES
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -413,6 +706,13 @@ MDAL_EXPORT MDAL_MeshEdgeIteratorH MDAL_M_edgeIterator( MDAL_MeshH mesh );
  */
 MDAL_EXPORT int MDAL_EI_next( MDAL_MeshEdgeIteratorH iterator, int edgesCount, int *startVertexIndices, int *endVertexIndices );
 
+/**
+ * Returns edges from iterator for the mesh, 64 bits version of MDAL_EI_next()
+ * A negative \a edgesCount is rejected with Err_InvalidData status
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_EI_next64( MDAL_MeshEdgeIteratorH iterator, int64_t edgesCount, int64_t *startVertexIndices, int64_t *endVertexIndices );
+
 /**
  * Closes mesh data iterator, frees the memory
  *
@@ -451,11 +751,52 @@ MDAL_EXPORT int MDAL_FI_next( MDAL_MeshFaceIteratorH iterator,
                               int vertexIndicesBufferLen,
                               int *vertexIndicesBuffer );
 
+/**
+ * Returns next faces from iterator for the mesh, 64 bits version of MDAL_FI_next()
+ *
+ * Face offsets can exceed the int range, so more than 2^31 vertex indices can be read in one call.
+ * Negative buffer lengths are rejected with Err_InvalidData status
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_FI_next64( MDAL_MeshFaceIteratorH iterator,
+                                    int64_t faceOffsetsBufferLen,
+                                    int64_t *faceOffsetsBuffer,
+                                    int64_t vertexIndicesBufferLen,
+                                    int64_t *vertexIndicesBuffer );
+
 /**
  * Closes mesh data iterator, frees the memory
  */
 MDAL_EXPORT void MDAL_FI_close( MDAL_MeshFaceIteratorH iterator );
 
+/**
+ * Returns the index of the face containing the point (x, y), in native projection.
+ * Returns -1 if no face contains the point or on error
+ *
+ * Points on the edges or vertices of the faces are contained, the face with the lowest index is returned
+ * when several faces share the point.
+ *
+ * On first call, a spatial index of the faces is built and kept with the mesh,
+ * it is rebuilt on the next call if the mesh has been modified.
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_M_faceAtPoint( MDAL_MeshH mesh, double x, double y );
+
+/**
+ * Returns the indexes of the faces containing points, see MDAL_M_faceAtPoint()
+ *
+ * \param mesh mesh handle
+ * \param pointsCount count of points
+ * \param coordinates coordinates of the points in form x1, y1, ..., xN, yN (size 2 * pointsCount)
+ * \param faceIndexes set to the index of the face containing each point, or -1 if no face contains it (size pointsCount)
+ * \returns count of points located in a face
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_M_facesAtPoints( MDAL_MeshH mesh, int64_t pointsCount, const double *coordinates, int64_t *faceIndexes );
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// DATASET GROUPS
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -527,10 +868,53 @@ MDAL_EXPORT int MDAL_G_maximumVerticalLevelCount( MDAL_DatasetGroupH group );
 
 /**
  * Returns the minimum and maximum values of the group
+ * Unless the file provides them, they are computed from the values of all the datasets on first call,
+ * the datasets being processed in parallel, see MDAL_SetThreadCount()
  * Returns NaN on error
  */
 MDAL_EXPORT void MDAL_G_minimumMaximum( MDAL_DatasetGroupH group, double *min, double *max );
 
+/**
+ * Populates \a counts with the count of values of all the datasets of the group in each of the \a binCount bins
+ * of equal width between \a minimum and \a maximum, \a maximum being included in the last bin.
+ * For vector datasets, the magnitudes are counted. NaN and infinite values are not counted.
+ *
+ * Counts are derived from a histogram of 1024 bins computed with the minimum and maximum in the same read of the values
+ * and kept with them: a value closer to the limit of a bin than 1/256 of the range of the values can be counted in the neighbour bin.
+ * \param counts output array, must be already allocated with at least \a binCount values
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_G_histogram( MDAL_DatasetGroupH group, double minimum, double maximum, int binCount, int64_t *counts );
+
+/**
+ * Populates \a quantiles with the approximate quantiles of the values of all the datasets of the group for the \a count
+ * \a probabilities, between 0 and 1 (for example 0.02 and 0.98 to stretch a color ramp).
+ * For vector datasets, quantiles of the magnitudes are returned. Returns NaN if there is no value.
+ *
+ * Quantiles are interpolated in the histogram described in MDAL_G_histogram(), they are accurate to 1/256 of the range of the values.
+ * \param quantiles output array, must be already allocated with at least \a count values
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_G_quantiles( MDAL_DatasetGroupH group, int count, const double *probabilities, double *quantiles );
+
+/**
+ * Populates buffer with the values of some elements for all the datasets (time steps) of the group
+ *
+ * Only for groups with data defined on vertices, faces or edges
+ *
+ * \param group handle to dataset group
+ * \param indices indices of the vertices/faces/edges to read
+ * \param indicesCount number of indices
+ * \param buffer output array to be populated with the values, must be already allocated
+ *               with datasetCount * indicesCount doubles for scalar groups, 2 * datasetCount * indicesCount for vector groups.
+ *               Values are written dataset by dataset: values of the first dataset for all indices, then values of the second dataset, ...
+ *               For vector groups, values are written x1, y1, ..., xN, yN
+ * \returns number of datasets written to buffer. If return value != dataset count, see MDAL_LastStatus() for error type
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int MDAL_G_timeSeries( MDAL_DatasetGroupH group, const int *indices, int indicesCount, double *buffer );
+
 /**
  * Adds empty (new) dataset to the group
  * This increases dataset group count MDAL_G_datasetCount() by 1
@@ -618,6 +1002,12 @@ MDAL_EXPORT double MDAL_D_time( MDAL_DatasetH dataset );
  */
 MDAL_EXPORT int MDAL_D_volumesCount( MDAL_DatasetH dataset );
 
+/**
+ * Returns volumes count for the mesh (for 3D meshes), 64 bits version of MDAL_D_volumesCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_D_volumesCount64( MDAL_DatasetH dataset );
+
 /**
  * Returns maximum number of vertical levels (for 3D meshes)
  */
@@ -632,6 +1022,12 @@ MDAL_EXPORT int MDAL_D_maximumVerticalLevelCount( MDAL_DatasetH dataset );
  */
 MDAL_EXPORT int MDAL_D_valueCount( MDAL_DatasetH dataset );
 
+/**
+ * Returns number of values, 64 bits version of MDAL_D_valueCount()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_D_valueCount64( MDAL_DatasetH dataset );
+
 /**
  * Returns whether dataset is valid
  */
@@ -676,15 +1072,76 @@ enum MDAL_DataType
  *               For SCALAR_VOLUMES_DOUBLE, the minimum size must be volumesCount * size_of(double)
  *               For VECTOR_2D_VOLUMES_DOUBLE, the minimum size must be 2 * volumesCount * size_of(double)
  * \returns number of values written to buffer. If return value != count requested, see MDAL_LastStatus() for error type
+ *
+ * \note Datasets, even of the same mesh, can be read from different threads. Reads using a library that is
+ *       not thread safe (NetCDF, HDF5 built without thread safety) are serialized internally.
+ *       Meshes must not be closed while their datasets are read.
  */
 MDAL_EXPORT int MDAL_D_data( MDAL_DatasetH dataset, int indexStart, int count, MDAL_DataType dataType, void *buffer );
 
+/**
+ * Populates buffer with values from the dataset, 64 bits version of MDAL_D_data()
+ * A negative \a indexStart or \a count is rejected with Err_InvalidData status
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_D_data64( MDAL_DatasetH dataset, int64_t indexStart, int64_t count, MDAL_DataType dataType, void *buffer );
+
+/**
+ * Returns a read-only pointer to the values of the dataset, without copy
+ *
+ * Values have the same layout and type as the buffer populated by MDAL_D_data(), for example
+ * x1, y1, ..., xN, yN doubles for VECTOR_2D_DOUBLE.
+ * Only available for datasets stored in memory with this layout (SCALAR_DOUBLE, VECTOR_2D_DOUBLE and ACTIVE_INTEGER),
+ * for other datasets, returns nullptr without changing MDAL_LastStatus(), use MDAL_D_data() instead.
+ * The pointer is valid until the dataset is modified or closed.
+ *
+ * \param dataset handle to dataset
+ * \param dataType type of values of the view
+ * \param count set to the number of values of the view
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT const void *MDAL_D_dataView( MDAL_DatasetH dataset, MDAL_DataType dataType, int64_t *count );
+
+/**
+ * Populates buffer with the values of the dataset at points, in native projection of the mesh
+ *
+ * For data on faces, the value of the face containing the point is returned. For data on vertices,
+ * values are interpolated with the barycentric coordinates of the point in the face, faces with more
+ * than 3 vertices are split in triangles from their first vertex.
+ * Values at points outside the mesh or in inactive faces are NaN.
+ * The faces are located with the spatial index of the mesh, see MDAL_M_faceAtPoint().
+ * Only data on vertices and on faces are supported.
+ *
+ * \param dataset handle to dataset
+ * \param pointsCount count of points
+ * \param coordinates coordinates of the points in form x1, y1, ..., xN, yN (size 2 * pointsCount)
+ * \param buffer populated with the values, one double per point for scalar datasets
+ *               and x1, y1, ..., xN, yN for vector datasets (size pointsCount or 2 * pointsCount)
+ * \returns count of points located in an active face
+ *
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT int64_t MDAL_D_valuesAtPoints( MDAL_DatasetH dataset, int64_t pointsCount, const double *coordinates, double *buffer );
+
 /**
  * Returns the minimum and maximum values of the dataset
+ * Unless the file provides them, they are computed from the values on first call
  * Returns NaN on error
  */
 MDAL_EXPORT void MDAL_D_minimumMaximum( MDAL_DatasetH dataset, double *min, double *max );
 
+/**
+ * Populates \a counts with the count of values of the dataset in each of the \a binCount bins, see MDAL_G_histogram()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_D_histogram( MDAL_DatasetH dataset, double minimum, double maximum, int binCount, int64_t *counts );
+
+/**
+ * Populates \a quantiles with the approximate quantiles of the values of the dataset, see MDAL_G_quantiles()
+ * \since MDAL 0.8.0
+ */
+MDAL_EXPORT void MDAL_D_quantiles( MDAL_DatasetH dataset, int count, const double *probabilities, double *quantiles );
+
 #ifdef __cplusplus
 }
 #endif
@@ -155,7 +155,8 @@ std::unique_ptr<MDAL::Mesh> MDAL::Driver2dm::load( const std::string &meshFile,
   // Allocate memory
   Vertices vertices( vertexCount );
   Edges edges( edgesCount );
-  Faces faces( faceCount );
+  Faces faces;
+  faces.reserve( faceCount, faceCount * MAX_VERTICES_PER_FACE_2DM );
 
   // .2dm mesh files may have any number of material ID columns
   std::vector<std::vector<double>> faceMaterials;
@@ -164,6 +165,7 @@ std::unique_ptr<MDAL::Mesh> MDAL::Driver2dm::load( const std::string &meshFile,
   in.seekg( 0, std::ios::beg );
 
   std::vector<std::string> chunks;
+  size_t face[MAX_VERTICES_PER_FACE_2DM];
 
   size_t faceIndex = 0;
   size_t vertexIndex = 0;
@@ -183,9 +185,6 @@ std::unique_ptr<MDAL::Mesh> MDAL::Driver2dm::load( const std::string &meshFile,
       const size_t faceVertexCount = MDAL::toSizeT( line[1] );
       assert( ( faceVertexCount == 3 ) || ( faceVertexCount == 4 ) );
 
-      Face &face = faces[faceIndex];
-      face.resize( faceVertexCount );
-
       // chunks format here
       // E** id vertex_id1, vertex_id2, vertex_id3, material_id [, aux_column_1, aux_column_2, ...]
       // vertex ids are numbered from 1
@@ -194,6 +193,7 @@ std::unique_ptr<MDAL::Mesh> MDAL::Driver2dm::load( const std::string &meshFile,
 
       for ( size_t i = 0; i < faceVertexCount; ++i )
         face[i] = MDAL::toSizeT( chunks[i + 2] ) - 1; // 2dm is numbered from 1
+      faces.addFace( face, faceVertexCount );
 
       // NUM_MATERIALS_PER_ELEM tag provided, use new MATID parser
       if ( hasMaterialsDefinitionsForElements )
@@ -273,17 +273,17 @@ std::unique_ptr<MDAL::Mesh> MDAL::Driver2dm::load( const std::string &meshFile,
     }
   }
 
-  for ( std::vector<Face>::iterator it = faces.begin(); it != faces.end(); ++it )
+  for ( size_t fi = 0; fi < faces.size(); ++fi )
   {
-    Face &face = *it;
-    for ( Face::size_type nd = 0; nd < face.size(); ++nd )
+    const size_t faceSize = faces.faceSize( fi );
+    for ( size_t nd = 0; nd < faceSize; ++nd )
     {
-      size_t nodeID = face[nd];
+      size_t nodeID = faces.vertexIndex( fi, nd );
 
       std::map<size_t, size_t>::iterator ni2i = vertexIDtoIndex.find( nodeID );
       if ( ni2i != vertexIDtoIndex.end() )
       {
-        face[nd] = ni2i->second; // convert from ID to index
+        faces.setVertexIndex( fi, nd, ni2i->second ); // convert from ID to index
       }
       else if ( vertices.size() < nodeID )
       {
@@ -116,9 +116,11 @@ void MDAL::Driver3Di::populateElements( Vertices &vertices, Edges &edges, Faces
 void MDAL::Driver3Di::populateMesh2DElements( MDAL::Vertices &vertices, MDAL::Faces &faces )
 {
   assert( vertices.empty() );
+  // the netCDF library is called directly
+  NetCDFLock lock;
   size_t faceCount = mDimensions.size( CFDimensions::Face );
-  faces.resize( faceCount );
   size_t verticesInFace = mDimensions.size( CFDimensions::MaxVerticesInFace );
+  faces.reserve( faceCount, faceCount * verticesInFace );
   size_t arrsize = faceCount * verticesInFace;
   std::map<std::string, size_t> xyToVertex2DId;
 
@@ -136,9 +138,11 @@ void MDAL::Driver3Di::populateMesh2DElements( MDAL::Vertices &vertices, MDAL::Fa
 
   // now populate create faces and backtrack which vertices
   // are used in multiple faces
+  Face face;
+  face.reserve( verticesInFace );
   for ( size_t faceId = 0; faceId < faceCount; ++faceId )
   {
-    Face face;
+    face.clear();
 
     for ( size_t faceVertexId = 0; faceVertexId < verticesInFace; ++faceVertexId )
     {
@@ -173,7 +177,7 @@ void MDAL::Driver3Di::populateMesh2DElements( MDAL::Vertices &vertices, MDAL::Fa
 
     }
 
-    faces[faceId] = face;
+    faces.addFace( face );
   }
 
   // Only now we have number of vertices, since we identified vertices that
@@ -184,6 +188,8 @@ void MDAL::Driver3Di::populateMesh2DElements( MDAL::Vertices &vertices, MDAL::Fa
 void MDAL::Driver3Di::addBedElevation( MemoryMesh *mesh )
 {
   assert( mesh );
+  // the netCDF library is called directly
+  NetCDFLock lock;
   if ( 0 == mesh->facesCount() )
     return;
 
@@ -213,8 +219,6 @@ void MDAL::Driver3Di::addBedElevation( MemoryMesh *mesh )
   {
     dataset->setScalarValue( i, MDAL::safeValue( coordZ[i], fillZ ) );
   }
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   group->datasets.push_back( dataset );
   mesh->datasetGroups.push_back( group );
 }
@@ -346,6 +350,8 @@ void MDAL::Driver3Di::populate1DMeshDimensions( MDAL::CFDimensions &dims )
 void MDAL::Driver3Di::populateMesh1DElements( MDAL::Vertices &vertices, MDAL::Edges &edges )
 {
   assert( vertices.empty() && edges.empty() );
+  // the netCDF library is called directly
+  NetCDFLock lock;
   size_t vertexCount = mDimensions.size( CFDimensions::Vertex );
   size_t edgesCount = mDimensions.size( CFDimensions::Edge );
   vertices.resize( vertexCount );
@@ -142,7 +142,6 @@ void MDAL::DriverAsciiDat::loadOldFormat( std::ifstream &in,
     return;
   }
 
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   mesh->datasetGroups.push_back( group );
   group.reset();
 }
@@ -244,7 +243,6 @@ void MDAL::DriverAsciiDat::loadNewFormat(
         MDAL::Log::error( MDAL_Status::Err_UnknownFormat, name(), "ENDDS card for no active dataset!" );
         return;
       }
-      group->setStatistics( MDAL::calculateStatistics( group ) );
       mesh->datasetGroups.push_back( group );
       group.reset();
     }
@@ -423,7 +421,6 @@ void MDAL::DriverAsciiDat::readVertexTimestep(
     }
   }
 
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   group->datasets.push_back( dataset );
 }
 
@@ -468,7 +465,6 @@ void MDAL::DriverAsciiDat::readElementTimestep(
     }
   }
 
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   group->datasets.push_back( dataset );
 }
 
@@ -13,6 +13,7 @@
 #include <map>
 #include <cassert>
 #include <memory>
+#include <algorithm>
 
 #include "mdal_binary_dat.hpp"
 #include "mdal.h"
@@ -76,6 +77,83 @@ static bool readIStat( std::ifstream &in, int sflg, char *flag )
   return false;
 }
 
+MDAL::DatasetBinaryDat::DatasetBinaryDat( MDAL::DatasetGroup *parent,
+    std::shared_ptr<MDAL::StreamPool> streams,
+    std::streampos values,
+    std::streampos flags,
+    int flagSize ):
+  Dataset2D( parent )
+  , mStreams( streams )
+  , mValuesPosition( values )
+  , mFlagsPosition( flags )
+  , mFlagSize( flagSize )
+{
+  setSupportsActiveFlag( flagSize != 0 );
+}
+
+size_t MDAL::DatasetBinaryDat::scalarData( size_t indexStart, size_t count, double *buffer )
+{
+  assert( group()->isScalar() ); //checked in C API interface
+  return readData( indexStart, count, 1, buffer );
+}
+
+size_t MDAL::DatasetBinaryDat::vectorData( size_t indexStart, size_t count, double *buffer )
+{
+  assert( !group()->isScalar() ); //checked in C API interface
+  return readData( indexStart, count, 2, buffer );
+}
+
+size_t MDAL::DatasetBinaryDat::activeData( size_t indexStart, size_t count, int *buffer )
+{
+  assert( supportsActiveFlag() );
+  size_t nValues = mesh()->facesCount();
+
+  if ( ( count < 1 ) || ( indexStart >= nValues ) )
+    return 0;
+
+  size_t copyValues = std::min( nValues - indexStart, count );
+
+  StreamPool::Stream stream = mStreams->acquire();
+  std::ifstream &in = *stream;
+  in.seekg( mFlagsPosition + static_cast<std::streamoff>( indexStart * static_cast<size_t>( mFlagSize ) ) );
+
+  if ( mFlagSize == CF_FLAG_SIZE )
+  {
+    if ( !MDAL::readValues<char>( buffer, copyValues, in ) )
+      return 0;
+    for ( size_t i = 0; i < copyValues; ++i )
+      buffer[i] = buffer[i] != 0;
+  }
+  else
+  {
+    if ( !MDAL::readValues<int>( buffer, copyValues, in ) )
+      return 0;
+    for ( size_t i = 0; i < copyValues; ++i )
+      buffer[i] = buffer[i] == 1;
+  }
+
+  return copyValues;
+}
+
+size_t MDAL::DatasetBinaryDat::readData( size_t indexStart, size_t count, size_t valuesPerItem, double *buffer )
+{
+  size_t nValues = valuesCount();
+
+  if ( ( count < 1 ) || ( indexStart >= nValues ) )
+    return 0;
+
+  size_t copyValues = std::min( nValues - indexStart, count );
+
+  // values are stored as floats in the byte order of the host, as the header, the whole block is read and converted at once
+  StreamPool::Stream stream = mStreams->acquire();
+  std::ifstream &in = *stream;
+  in.seekg( mValuesPosition + static_cast<std::streamoff>( indexStart * valuesPerItem * CT_FLOAT_SIZE ) );
+  if ( !MDAL::readValues<float>( buffer, copyValues * valuesPerItem, in ) )
+    return 0;
+
+  return copyValues;
+}
+
 MDAL::DriverBinaryDat::DriverBinaryDat():
   Driver( "BINARY_DAT",
           "Binary DAT",
@@ -127,12 +205,19 @@ void MDAL::DriverBinaryDat::load( const std::string &datFile, MDAL::Mesh *mesh )
     return;
   }
 
-  std::ifstream in( mDatFile, std::ifstream::in | std::ifstream::binary );
+  // the streams of the pool stay opened while the datasets exist, values are read on demand
+  std::shared_ptr<StreamPool> streams = std::make_shared<StreamPool>( mDatFile );
+  StreamPool::Stream stream = streams->acquire();
+  std::ifstream &in = *stream;
 
   // implementation based on information from:
   // http://www.xmswiki.com/wiki/SMS:Binary_Dataset_Files_*.dat
   if ( !in ) return exit_with_error( MDAL_Status::Err_FileNotFound, "Couldn't open the file" );
 
+  in.seekg( 0, std::ios::end );
+  std::streamoff fileSize = in.tellg();
+  in.seekg( 0, std::ios::beg );
+
   size_t vertexCount = mesh->verticesCount();
   size_t elemCount = mesh->facesCount();
 
@@ -289,7 +374,7 @@ void MDAL::DriverBinaryDat::load( const std::string &datFile, MDAL::Mesh *mesh )
         double rawTime = static_cast<double>( time );
         MDAL::RelativeTimestamp t( rawTime, MDAL::parseDurationTimeUnit( timeUnitStr ) );
 
-        if ( readVertexTimestep( mesh, group, groupMax, t, istat, sflg, in ) )
+        if ( readVertexTimestep( mesh, group, groupMax, t, istat, sflg, in, streams, fileSize ) )
           return exit_with_error( MDAL_Status::Err_UnknownFormat, "Unable to read vertex timestep" );
 
         break;
@@ -299,12 +384,11 @@ void MDAL::DriverBinaryDat::load( const std::string &datFile, MDAL::Mesh *mesh )
   if ( !group || group->datasets.size() == 0 )
     return exit_with_error( MDAL_Status::Err_UnknownFormat, "No datasets" );
 
-  group->setStatistics( MDAL::calculateStatistics( group ) );
+  // statistics are calculated on demand, reading the values block by block
   mesh->datasetGroups.push_back( group );
 
   if ( groupMax && groupMax->datasets.size() > 0 )
   {
-    groupMax->setStatistics( MDAL::calculateStatistics( groupMax ) );
     mesh->datasetGroups.push_back( groupMax );
   }
 }
@@ -316,7 +400,9 @@ bool MDAL::DriverBinaryDat::readVertexTimestep(
   MDAL::RelativeTimestamp time,
   bool hasStatus,
   int sflg,
-  std::ifstream &in )
+  std::ifstream &in,
+  std::shared_ptr<StreamPool> streams,
+  std::streamoff fileSize )
 {
   assert( group && groupMax && ( group->isScalar() == groupMax->isScalar() ) );
   bool isScalar = group->isScalar();
@@ -324,56 +410,29 @@ bool MDAL::DriverBinaryDat::readVertexTimestep(
   size_t vertexCount = mesh->verticesCount();
   size_t faceCount = mesh->facesCount();
 
-  std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared< MDAL::MemoryDataset2D >( group.get(), hasStatus );
-
-  bool active = true;
-  for ( size_t i = 0; i < faceCount; ++i )
-  {
-    if ( hasStatus )
-    {
-      if ( readIStat( in, sflg, reinterpret_cast< char * >( &active ) ) )
-        return true; //error
-
-    }
-    dataset->setActive( i, active );
-  }
-
-  for ( size_t i = 0; i < vertexCount; ++i )
-  {
-    if ( !isScalar )
-    {
-      float x, y;
-
-      if ( read( in, reinterpret_cast< char * >( &x ), 4 ) )
-        return true; //error
-      if ( read( in, reinterpret_cast< char * >( &y ), 4 ) )
-        return true; //error
+  // the time step contains the status flags of faces (if any), then the float values on vertices
+  int flagSize = hasStatus ? sflg : 0;
+  if ( flagSize != 0 && flagSize != CF_FLAG_SIZE && flagSize != CF_FLAG_INT_SIZE )
+    return true; //error
+  std::streampos flagsPosition = in.tellg();
+  std::streampos valuesPosition = flagsPosition + static_cast<std::streamoff>( faceCount * static_cast<size_t>( flagSize ) );
+  std::streamoff valuesSize = static_cast<std::streamoff>( vertexCount * ( isScalar ? 1 : 2 ) * CT_FLOAT_SIZE );
 
-      dataset->setVectorValue( i, static_cast< double >( x ), static_cast< double >( y ) );
-    }
-    else
-    {
-      float scalar;
+  if ( flagsPosition < 0 || valuesPosition + valuesSize > fileSize )
+    return true; //error
 
-      if ( read( in, reinterpret_cast< char * >( &scalar ), 4 ) )
-        return true; //error
+  in.seekg( valuesPosition + valuesSize );
+  if ( !in )
+    return true; //error
 
-      dataset->setScalarValue( i, static_cast< double >( scalar ) );
-    }
-  }
+  std::shared_ptr<MDAL::DatasetBinaryDat> dataset = std::make_shared< MDAL::DatasetBinaryDat >( group.get(), streams, valuesPosition, flagsPosition, flagSize );
+  dataset->setTime( time );
 
   if ( MDAL::equals( time.value( MDAL::RelativeTimestamp::hours ), 99999.0 ) ) // Special TUFLOW dataset with maximus
-  {
-    dataset->setTime( time );
-    dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
     groupMax->datasets.push_back( dataset );
-  }
   else
-  {
-    dataset->setTime( time );
-    dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
     group->datasets.push_back( dataset );
-  }
+
   return false; //OK
 }
 
@@ -16,10 +16,48 @@
 #include "mdal_data_model.hpp"
 #include "mdal.h"
 #include "mdal_driver.hpp"
+#include "mdal_utils.hpp"
 
 namespace MDAL
 {
 
+  /**
+   * Dataset of a binary DAT file with lazy loading
+   *
+   * Only the positions of the time step's status flags and values in the file are stored,
+   * the values are read from the file on demand.
+   *
+   * \note the pool of streams on the file is shared between all the datasets of the file, each read acquires
+   * its own stream so the data can be read from different threads at once.
+   */
+  class DatasetBinaryDat: public Dataset2D
+  {
+    public:
+      /**
+       * Contructs a dataset with the pool of \a streams on the file and the position of the \a values in the stream.
+       * If \a flagSize is not 0, the dataset supports active flag and the status flags of the faces,
+       * each of them stored on \a flagSize bytes, are located at \a flags position.
+       */
+      DatasetBinaryDat( DatasetGroup *parent,
+                        std::shared_ptr<StreamPool> streams,
+                        std::streampos values,
+                        std::streampos flags = 0,
+                        int flagSize = 0 );
+
+      size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t activeData( size_t indexStart, size_t count, int *buffer ) override;
+
+    private:
+      //! Reads \a count items of \a valuesPerItem floats from \a indexStart and copy them as double in \a buffer
+      size_t readData( size_t indexStart, size_t count, size_t valuesPerItem, double *buffer );
+
+      std::shared_ptr<StreamPool> mStreams;
+      std::streampos mValuesPosition;
+      std::streampos mFlagsPosition;
+      int mFlagSize = 0;
+  };
+
   class DriverBinaryDat: public Driver
   {
     public:
@@ -34,13 +72,16 @@ namespace MDAL
       std::string writeDatasetOnFileSuffix() const override;
 
     private:
+      //! Creates a lazy dataset for the time step at the current position of the stream and moves the stream to the end of the time step
       bool readVertexTimestep( const Mesh *mesh,
                                std::shared_ptr<DatasetGroup> group,
                                std::shared_ptr<DatasetGroup> groupMax,
                                RelativeTimestamp time,
                                bool hasStatus,
                                int sflg,
-                               std::ifstream &in );
+                               std::ifstream &in,
+                               std::shared_ptr<StreamPool> streams,
+                               std::streamoff fileSize );
 
       std::string mDatFile;
   };
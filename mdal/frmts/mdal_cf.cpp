@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <cstring>
+#include <algorithm>
 
 #include "mdal_data_model.hpp"
 #include "mdal_cf.hpp"
@@ -63,6 +64,8 @@ MDAL::cfdataset_info_map MDAL::DriverCF::parseDatasetGroupInfo()
 
   std::set<std::string> ignoreVariables = ignoreNetCDFVariables();
 
+  // the netCDF library is called directly
+  NetCDFLock lock;
   do
   {
     ++varid;
@@ -253,18 +256,18 @@ MDAL::cfdataset_info_map MDAL::DriverCF::parseDatasetGroupInfo()
 
 static void populate_vector_vals( double *vals, size_t i,
                                   const std::vector<double> &vals_x, const std::vector<double> &vals_y,
-                                  size_t idx, double fill_val_x, double fill_val_y )
+                                  size_t idx )
 {
-  vals[2 * i] = MDAL::safeValue( vals_x[idx], fill_val_x );
-  vals[2 * i + 1] = MDAL::safeValue( vals_y[idx], fill_val_y );
+  vals[2 * i] = vals_x[idx];
+  vals[2 * i + 1] = vals_y[idx];
 }
 
 static void populate_polar_vector_vals( double *vals, size_t i,
                                         const std::vector<double> &vals_x, const std::vector<double> &vals_y,
-                                        size_t idx, double fill_val_x, double fill_val_y, std::pair<double, double> referenceAngles )
+                                        size_t idx, std::pair<double, double> referenceAngles )
 {
-  double magnitude = MDAL::safeValue( vals_x[idx], fill_val_x );
-  double direction = MDAL::safeValue( vals_y[idx], fill_val_y );
+  double magnitude = vals_x[idx];
+  double direction = vals_y[idx];
 
   direction = 2 * M_PI * ( ( direction - referenceAngles.second ) / referenceAngles.first );
 
@@ -272,14 +275,6 @@ static void populate_polar_vector_vals( double *vals, size_t i,
   vals[2 * i + 1] = magnitude * sin( direction );
 }
 
-static void populate_scalar_vals( double *vals, size_t i,
-                                  const std::vector<double> &rawVals,
-                                  size_t idx,
-                                  double fill_val )
-{
-  vals[i] = MDAL::safeValue( rawVals[idx], fill_val );
-}
-
 static void fromClassificationToValue( const MDAL::Classification &classification, std::vector<double> &values, size_t classStartAt = 0 )
 {
   for ( size_t i = 0; i < values.size(); ++i )
@@ -308,12 +303,32 @@ static void fromClassificationToValue( const MDAL::Classification &classificatio
   }
 }
 
+static MDAL_DataLocation dataLocationFor( MDAL::CFDimensions::Type outputType )
+{
+  switch ( outputType )
+  {
+    case MDAL::CFDimensions::Vertex:
+      return MDAL_DataLocation::DataOnVertices;
+    case MDAL::CFDimensions::Edge:
+      return MDAL_DataLocation::DataOnEdges;
+    case MDAL::CFDimensions::Face:
+      return MDAL_DataLocation::DataOnFaces;
+    case MDAL::CFDimensions::Volume3D:
+      return MDAL_DataLocation::DataOnVolumes;
+    default:
+      return MDAL_DataLocation::DataInvalidLocation;
+  }
+}
+
 void MDAL::DriverCF::addDatasetGroups( MDAL::Mesh *mesh, const std::vector<RelativeTimestamp> &times, const MDAL::cfdataset_info_map &dsinfo_map, const MDAL::DateTime &referenceTime )
 {
   /* PHASE 2 - add dataset groups */
   for ( const auto &it : dsinfo_map )
   {
     const CFDatasetGroupInfo dsi = it.second;
+    if ( !openOptions().acceptsGroup( dsi.name ) )
+      continue;
+
     // Create a dataset group
     std::shared_ptr<MDAL::DatasetGroup> group = std::make_shared<MDAL::DatasetGroup>(
           name(),
@@ -331,19 +346,13 @@ void MDAL::DriverCF::addDatasetGroups( MDAL::Mesh *mesh, const std::vector<Relat
     }
     group->setMetadata( dsi.metadata );
 
-    if ( dsi.outputType == CFDimensions::Vertex )
-      group->setDataLocation( MDAL_DataLocation::DataOnVertices );
-    else if ( dsi.outputType == CFDimensions::Edge )
-      group->setDataLocation( MDAL_DataLocation::DataOnEdges );
-    else if ( dsi.outputType == CFDimensions::Face )
-      group->setDataLocation( MDAL_DataLocation::DataOnFaces );
-    else if ( dsi.outputType == CFDimensions::Volume3D )
-      group->setDataLocation( MDAL_DataLocation::DataOnVolumes );
-    else
+    const MDAL_DataLocation dataLocation = dataLocationFor( dsi.outputType );
+    if ( dataLocation == MDAL_DataLocation::DataInvalidLocation )
     {
       // unsupported
       continue;
     }
+    group->setDataLocation( dataLocation );
 
     // read X data
     double fill_val_x = mNcFile->getFillValue( dsi.ncid_x );
@@ -359,6 +368,9 @@ void MDAL::DriverCF::addDatasetGroups( MDAL::Mesh *mesh, const std::vector<Relat
     // Create dataset
     for ( size_t ts = 0; ts < dsi.nTimesteps; ++ts )
     {
+      if ( !openOptions().acceptsTime( times[ts], dsi.nTimesteps ) )
+        continue;
+
       std::shared_ptr<MDAL::Dataset> dataset;
       if ( dsi.outputType == CFDimensions::Volume3D )
       {
@@ -384,7 +396,12 @@ void MDAL::DriverCF::addDatasetGroups( MDAL::Mesh *mesh, const std::vector<Relat
     // Add to mesh
     if ( !group->datasets.empty() )
     {
-      group->setStatistics( MDAL::calculateStatistics( group ) );
+      // range of the whole variable given by the file, otherwise computed on demand
+      Statistics range;
+      if ( !dsi.isVector && dsi.classification_x.empty() && group->datasets.size() == dsi.nTimesteps &&
+           mNcFile->getActualRange( dsi.ncid_x, range.minimum, range.maximum ) )
+        group->setStatistics( range );
+
       group->setReferenceTime( referenceTime );
       mesh->datasetGroups.push_back( group );
     }
@@ -438,7 +455,6 @@ std::shared_ptr<MDAL::Dataset> MDAL::DriverCF::create2DDataset( std::shared_ptr<
         ts,
         mNcFile
       );
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   return std::move( dataset );
 }
 
@@ -604,6 +620,115 @@ std::unique_ptr< MDAL::Mesh > MDAL::DriverCF::load( const std::string &fileName,
   }
 }
 
+std::unique_ptr< MDAL::MeshSummary > MDAL::DriverCF::loadSummary( const std::string &fileName, const std::string &meshName )
+{
+  mNcFile.reset( new NetCDFFile );
+
+  mFileName = fileName;
+
+  mRequestedMeshName = meshName;
+
+  MDAL::Log::resetLastStatus();
+
+  std::unique_ptr< MeshSummary > summary( new MeshSummary );
+
+  try
+  {
+    mNcFile->openFile( mFileName );
+    mDimensions = populateDimensions( );
+
+    summary->driverName = name();
+    summary->uri = mFileName;
+    if ( !populateSummary( *summary ) )
+      return Driver::loadSummary( fileName, meshName );
+
+    // the projection is set on an empty mesh to share setProjection()
+    MemoryMesh projectionMesh( name(), 0, mFileName );
+    setProjection( &projectionMesh );
+    summary->crs = projectionMesh.crs();
+
+    std::vector<MDAL::RelativeTimestamp> times;
+    const MDAL::DateTime referenceTime = parseTime( times );
+
+    // same groups as addDatasetGroups(), without creating the datasets
+    const cfdataset_info_map dsinfo_map = parseDatasetGroupInfo();
+    for ( const auto &it : dsinfo_map )
+    {
+      const CFDatasetGroupInfo &dsi = it.second;
+      if ( !openOptions().acceptsGroup( dsi.name ) )
+        continue;
+
+      DatasetGroupSummary group;
+      group.name = dsi.name;
+      group.dataLocation = dataLocationFor( dsi.outputType );
+      group.isScalar = !dsi.isVector;
+      group.referenceTime = referenceTime;
+      if ( group.dataLocation == MDAL_DataLocation::DataInvalidLocation )
+        continue;
+
+      for ( size_t ts = 0; ts < dsi.nTimesteps; ++ts )
+      {
+        if ( !openOptions().acceptsTime( times[ts], dsi.nTimesteps ) )
+          continue;
+
+        if ( group.datasetsCount == 0 || times[ts] < group.startTime )
+          group.startTime = times[ts];
+        if ( group.datasetsCount == 0 || group.endTime < times[ts] )
+          group.endTime = times[ts];
+        ++group.datasetsCount;
+      }
+
+      if ( group.datasetsCount > 0 )
+        summary->groups.push_back( group );
+    }
+  }
+  catch ( MDAL_Status error )
+  {
+    MDAL::Log::error( error, name(), "error while loading file " + fileName );
+    summary.reset();
+  }
+  catch ( MDAL::Error err )
+  {
+    MDAL::Log::error( err, name() );
+    summary.reset();
+  }
+
+  return summary;
+}
+
+bool MDAL::DriverCF::populateSummary( MDAL::MeshSummary & )
+{
+  return false;
+}
+
+void MDAL::DriverCF::populateSummaryElements( MDAL::MeshSummary &summary, const std::vector<double> &verticesX, const std::vector<double> &verticesY ) const
+{
+  summary.verticesCount = mDimensions.size( CFDimensions::Vertex );
+  summary.edgesCount = mDimensions.size( CFDimensions::Edge );
+  summary.facesCount = mDimensions.size( CFDimensions::Face );
+
+  for ( size_t i = 0; i < summary.verticesCount; ++i )
+  {
+    summary.extent.minX = std::min( summary.extent.minX, verticesX[i] );
+    summary.extent.maxX = std::max( summary.extent.maxX, verticesX[i] );
+    summary.extent.minY = std::min( summary.extent.minY, verticesY[i] );
+    summary.extent.maxY = std::max( summary.extent.maxY, verticesY[i] );
+  }
+}
+
+void MDAL::DriverCF::addBedElevationSummary( MDAL::MeshSummary &summary )
+{
+  if ( summary.verticesCount == 0 )
+    return;
+
+  DatasetGroupSummary group;
+  group.name = "Bed Elevation";
+  group.dataLocation = MDAL_DataLocation::DataOnVertices;
+  group.isScalar = true;
+  group.datasetsCount = 1;
+  summary.groups.push_back( group );
+}
+
 //////////////////////////////////////////////////////////////////////////////////////
 
 MDAL::CFDimensions::Type MDAL::CFDimensions::type( int ncid ) const
@@ -672,6 +797,20 @@ MDAL::CFDataset2D::CFDataset2D( MDAL::DatasetGroup *parent,
 
 MDAL::CFDataset2D::~CFDataset2D() = default;
 
+static NetCDFFile::TimeLayout timeLayout( MDAL::CFDatasetGroupInfo::TimeLocation timeLocation )
+{
+  switch ( timeLocation )
+  {
+    case MDAL::CFDatasetGroupInfo::NoTimeDimension:
+      return NetCDFFile::NoTimeDimension;
+    case MDAL::CFDatasetGroupInfo::TimeDimensionFirst:
+      return NetCDFFile::TimeDimensionFirst;
+    case MDAL::CFDatasetGroupInfo::TimeDimensionLast:
+      return NetCDFFile::TimeDimensionLast;
+  }
+  return NetCDFFile::NoTimeDimension;
+}
+
 size_t MDAL::CFDataset2D::scalarData( size_t indexStart, size_t count, double *buffer )
 {
   assert( group()->isScalar() ); //checked in C API interface
@@ -681,41 +820,10 @@ size_t MDAL::CFDataset2D::scalarData( size_t indexStart, size_t count, double *b
     return 0;
 
   size_t copyValues = std::min( mValues - indexStart, count );
-  std::vector<double> values_x;
-
-  if ( mTimeLocation == CFDatasetGroupInfo::NoTimeDimension )
-  {
-    values_x = mNcFile->readDoubleArr(
-                 mNcidX,
-                 indexStart,
-                 copyValues
-               );
-  }
-  else
-  {
-    bool timeFirstDim = mTimeLocation == CFDatasetGroupInfo::TimeDimensionFirst;
-    size_t start_dim1 = timeFirstDim ?  mTs : indexStart;
-    size_t start_dim2 = timeFirstDim ?  indexStart : mTs;
-    size_t count_dim1 = timeFirstDim ?  1 : copyValues;
-    size_t count_dim2 = timeFirstDim ?  copyValues : 1;
-
-    values_x = mNcFile->readDoubleArr(
-                 mNcidX,
-                 start_dim1,
-                 start_dim2,
-                 count_dim1,
-                 count_dim2
-               );
-  }
 
-  for ( size_t i = 0; i < copyValues; ++i )
-  {
-    populate_scalar_vals( buffer,
-                          i,
-                          values_x,
-                          i,
-                          mFillValX );
-  }
+  // read through the block cache of the file, a timestep read in several calls is decompressed once
+  // values are decoded with the fill value while read
+  mNcFile->readTimestepDoubleArr( mNcidX, timeLayout( mTimeLocation ), mTs, mValues, mFillValX, indexStart, copyValues, buffer );
   return copyValues;
 }
 
@@ -730,78 +838,84 @@ size_t MDAL::CFDataset2D::vectorData( size_t indexStart, size_t count, double *b
 
   size_t copyValues = std::min( mValues - indexStart, count );
 
-  std::vector<double> values_x;
-  std::vector<double> values_y;
+  std::vector<double> values_x( copyValues );
+  std::vector<double> values_y( copyValues );
 
-  if ( mTimeLocation == CFDatasetGroupInfo::NoTimeDimension )
-  {
-    values_x = mNcFile->readDoubleArr(
-                 mNcidX,
-                 indexStart,
-                 copyValues
-               );
-
-    values_y = mNcFile->readDoubleArr(
-                 mNcidX,
-                 indexStart,
-                 copyValues
-               );
-  }
-  else
-  {
-    bool timeFirstDim = mTimeLocation == CFDatasetGroupInfo::TimeDimensionFirst;
-    size_t start_dim1 = timeFirstDim ?  mTs : indexStart;
-    size_t start_dim2 = timeFirstDim ?  indexStart : mTs;
-    size_t count_dim1 = timeFirstDim ?  1 : copyValues;
-    size_t count_dim2 = timeFirstDim ?  copyValues : 1;
-
-    values_x = mNcFile->readDoubleArr(
-                 mNcidX,
-                 start_dim1,
-                 start_dim2,
-                 count_dim1,
-                 count_dim2
-               );
-    values_y = mNcFile->readDoubleArr(
-                 mNcidY,
-                 start_dim1,
-                 start_dim2,
-                 count_dim1,
-                 count_dim2
-               );
-  }
+  NetCDFFile::TimeLayout layout = timeLayout( mTimeLocation );
+  mNcFile->readTimestepDoubleArr( mNcidX, layout, mTs, mValues, mFillValX, indexStart, copyValues, values_x.data() );
+  mNcFile->readTimestepDoubleArr( mNcidY, layout, mTs, mValues, mFillValY, indexStart, copyValues, values_y.data() );
+
+  populateVectorValues( values_x, values_y, buffer );
+  return copyValues;
+}
+
+//! Returns the count of the first \a indices lower than \a valuesCount
+static size_t validIndicesCount( const size_t *indices, size_t count, size_t valuesCount )
+{
+  size_t validCount = 0;
+  while ( validCount < count && indices[validCount] < valuesCount )
+    ++validCount;
+  return validCount;
+}
+
+size_t MDAL::CFDataset2D::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( group()->isScalar() ); //checked in C API interface
+  if ( mTs >= mTimesteps )
+    return 0;
+
+  // time series read a few values of each timestep, caching their blocks would evict the blocks of other reads
+  size_t validCount = validIndicesCount( indices, count, mValues );
+  mNcFile->readTimestepDoubleValuesAt( mNcidX, timeLayout( mTimeLocation ), mTs, mFillValX, indices, validCount, buffer );
+  return validCount;
+}
+
+size_t MDAL::CFDataset2D::vectorDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( !group()->isScalar() ); //checked in C API interface
+  if ( mTs >= mTimesteps )
+    return 0;
+
+  size_t validCount = validIndicesCount( indices, count, mValues );
+  std::vector<double> values_x( validCount );
+  std::vector<double> values_y( validCount );
 
+  NetCDFFile::TimeLayout layout = timeLayout( mTimeLocation );
+  mNcFile->readTimestepDoubleValuesAt( mNcidX, layout, mTs, mFillValX, indices, validCount, values_x.data() );
+  mNcFile->readTimestepDoubleValuesAt( mNcidY, layout, mTs, mFillValY, indices, validCount, values_y.data() );
+
+  populateVectorValues( values_x, values_y, buffer );
+  return validCount;
+}
+
+void MDAL::CFDataset2D::populateVectorValues( std::vector<double> &valuesX, std::vector<double> &valuesY, double *buffer ) const
+{
+  // values are decoded with the fill values while read
   //if values component are classified convert from index to value
   if ( !mClassificationX.empty() )
   {
-    fromClassificationToValue( mClassificationX, values_x, 1 );
+    fromClassificationToValue( mClassificationX, valuesX, 1 );
   }
 
   if ( !mClassificationY.empty() )
   {
-    fromClassificationToValue( mClassificationY, values_y, 1 );
+    fromClassificationToValue( mClassificationY, valuesY, 1 );
   }
 
-  for ( size_t i = 0; i < copyValues; ++i )
+  for ( size_t i = 0; i < valuesX.size(); ++i )
   {
     if ( group()->isPolar() )
       populate_polar_vector_vals( buffer,
                                   i,
-                                  values_x,
-                                  values_y,
+                                  valuesX,
+                                  valuesY,
                                   i,
-                                  mFillValX,
-                                  mFillValY,
                                   group()->referenceAngles() );
     else
       populate_vector_vals( buffer,
                             i,
-                            values_x,
-                            values_y,
-                            i,
-                            mFillValX,
-                            mFillValY );
+                            valuesX,
+                            valuesY,
+                            i );
   }
-
-  return copyValues;
 }
@@ -94,8 +94,15 @@ namespace MDAL
 
       virtual size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
       virtual size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+      //! Reads the values one by one from the file, without loading their blocks in the cache of the file
+      virtual size_t scalarDataAt( const size_t *indices, size_t count, double *buffer ) override;
+      //! Reads the values one by one from the file, without loading their blocks in the cache of the file
+      virtual size_t vectorDataAt( const size_t *indices, size_t count, double *buffer ) override;
 
     protected:
+      //! Converts the x and y values, read from the file, to the x, y pairs of \a buffer
+      void populateVectorValues( std::vector<double> &valuesX, std::vector<double> &valuesY, double *buffer ) const;
+
       double mFillValX;
       double mFillValY;
       int mNcidX; //!< NetCDF variable id
@@ -122,6 +129,8 @@ namespace MDAL
       virtual ~DriverCF() override;
       bool canReadMesh( const std::string &uri ) override;
       std::unique_ptr< Mesh > load( const std::string &fileName, const std::string &meshName = "" ) override;
+      //! Reads the dimensions, the coordinates and the time variable, without the topology nor the values of the datasets
+      std::unique_ptr< MeshSummary > loadSummary( const std::string &fileName, const std::string &meshName = "" ) override;
 
     protected:
       virtual CFDimensions populateDimensions( ) = 0;
@@ -138,6 +147,17 @@ namespace MDAL
           bool *is_x ) = 0;
       virtual std::vector<std::pair<double, double> > parseClassification( int varid ) const = 0;
       virtual std::string getTimeVariableName() const = 0;
+
+      /**
+       * Sets the counts of the elements, the extent and the groups added by addBedElevation() in \a summary,
+       * from the dimensions and the coordinates. Returns false if they are only known once the mesh is built,
+       * the summary is then made from the loaded mesh. Default implementation returns false
+       */
+      virtual bool populateSummary( MeshSummary &summary );
+      //! Sets the counts of the elements of \a summary from the dimensions and its extent from the coordinates of the vertices
+      void populateSummaryElements( MeshSummary &summary, const std::vector<double> &verticesX, const std::vector<double> &verticesY ) const;
+      //! Adds to \a summary the group added by addBedElevationDatasetGroup()
+      static void addBedElevationSummary( MeshSummary &summary );
       virtual std::shared_ptr<MDAL::Dataset> create2DDataset(
         std::shared_ptr<MDAL::DatasetGroup> group,
         size_t ts,
@@ -79,6 +79,15 @@ std::unique_ptr< MDAL::Mesh > MDAL::Driver::load( const std::string &, const std
 
 void MDAL::Driver::load( const std::string &, Mesh * ) {}
 
+std::unique_ptr< MDAL::MeshSummary > MDAL::Driver::loadSummary( const std::string &uri, const std::string &meshName )
+{
+  std::unique_ptr< Mesh > mesh = load( uri, meshName );
+  if ( !mesh )
+    return std::unique_ptr< MeshSummary >();
+
+  return std::unique_ptr< MeshSummary >( new MeshSummary( mesh.get() ) );
+}
+
 void MDAL::Driver::save( const std::string &, MDAL::Mesh * ) {}
 
 void MDAL::Driver::createDatasetGroup( MDAL::Mesh *mesh, const std::string &groupName, MDAL_DataLocation dataLocation, bool hasScalarData, const std::string &datasetGroupFile )
@@ -108,8 +117,18 @@ void MDAL::Driver::createDataset( MDAL::DatasetGroup *group, MDAL::RelativeTimes
   memcpy( dataset->values(), values, sizeof( double ) * count );
   if ( dataset->supportsActiveFlag() )
     dataset->setActive( active );
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   group->datasets.push_back( dataset );
+  group->invalidateStatistics();
 }
 
 bool MDAL::Driver::persist( MDAL::DatasetGroup * ) { return true; } // failure
+
+void MDAL::Driver::setOpenOptions( const MDAL::OpenOptions &options )
+{
+  mOpenOptions = options;
+}
+
+const MDAL::OpenOptions &MDAL::Driver::openOptions() const
+{
+  return mOpenOptions;
+}
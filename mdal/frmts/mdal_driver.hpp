@@ -8,6 +8,7 @@
 
 #include <string>
 #include "mdal_data_model.hpp"
+#include "mdal_open_options.hpp"
 #include "mdal.h"
 
 namespace MDAL
@@ -56,6 +57,12 @@ namespace MDAL
       virtual std::unique_ptr< Mesh > load( const std::string &uri, const std::string &meshName = "" );
       // loads datasets
       virtual void load( const std::string &uri, Mesh *mesh );
+
+      /**
+       * Loads the summary of the mesh and of its dataset groups, without building the topology nor reading the values.
+       * Default implementation loads the whole mesh, drivers override it to read only what is needed from the file
+       */
+      virtual std::unique_ptr< MeshSummary > loadSummary( const std::string &uri, const std::string &meshName = "" );
       // save mesh
       virtual void save( const std::string &uri, Mesh *mesh );
 
@@ -77,11 +84,21 @@ namespace MDAL
       // returns true on error, false on success
       virtual bool persist( DatasetGroup *group );
 
+      //! Sets the options restricting what is loaded by the next load()
+      void setOpenOptions( const OpenOptions &options );
+
+      /**
+       * Returns the options restricting what is loaded. Drivers can use them to skip the parsing of the excluded
+       * groups and datasets, the driver manager removes what remains after the load
+       */
+      const OpenOptions &openOptions() const;
+
     private:
       std::string mName;
       std::string mLongName;
       std::string mFilters;
       int mCapabilityFlags;
+      OpenOptions mOpenOptions;
   };
 
 } // namespace MDAL
@@ -242,11 +242,9 @@ bool MDAL::MeshDynamicDriver::populateDatasetGroups()
       dataset->setSupportsActiveFlag( mDatasetSupportActiveFlagFunction( mId, i, d ) );
       if ( !dataset->loadSymbol() )
         return false;
-      dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
       group->datasets.push_back( dataset );
     }
 
-    group->setStatistics( MDAL::calculateStatistics( group ) );
     datasetGroups.push_back( group );
   }
   return true;
@@ -419,6 +417,11 @@ size_t MDAL::DatasetDynamicDriver::activeData( size_t indexStart, size_t count,
   return mActiveFlagsFunction( mMeshId, mGroupIndex, mDatasetIndex, MDAL::toInt( indexStart ), MDAL::toInt( count ), buffer );
 }
 
+bool MDAL::DatasetDynamicDriver::supportsConcurrentReads() const
+{
+  return false;
+}
+
 bool MDAL::DatasetDynamicDriver::loadSymbol()
 {
   mDataFunction = mLibrary.getSymbol<int, int, int, int, int, int, double *>( "MDAL_DRIVER_D_data" );
@@ -115,6 +115,9 @@ namespace MDAL
       size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
       size_t activeData( size_t indexStart, size_t count, int *buffer ) override;
 
+      //! The thread safety of the external library is unknown
+      bool supportsConcurrentReads() const override;
+
       bool loadSymbol();
 
     private:
@@ -101,7 +101,7 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverEsriTin::load( const std::string &uri, c
       //exclude masked face
       if ( !( maskInt & 0x01 ) )
       {
-        faces.push_back( f );
+        faces.addFace( f );
         //fill raw indexes
         for ( auto ri : f )
         {
@@ -168,9 +168,9 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverEsriTin::load( const std::string &uri, c
     inZ.close();
 
     //Round 4 :apply correction to the face's indexes
-    for ( auto &face : faces )
-      for ( auto &fi : face )
-        fi = rawAndCorrectedIndexesMap[fi];
+    for ( size_t faceIndex = 0; faceIndex < faces.size(); ++faceIndex )
+      for ( size_t i = 0; i < faces.faceSize( faceIndex ); ++i )
+        faces.setVertexIndex( faceIndex, i, rawAndCorrectedIndexesMap[faces.vertexIndex( faceIndex, i )] );
 
     //create the memory mesh
     std::unique_ptr< MemoryMesh > mesh(
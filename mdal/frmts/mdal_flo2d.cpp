@@ -79,9 +79,7 @@ void MDAL::DriverFlo2D::addStaticDataset(
   dataset->setTime( MDAL::RelativeTimestamp() );
   double *values = dataset->values();
   memcpy( values, vals.data(), vals.size() * sizeof( double ) );
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   group->datasets.push_back( dataset );
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   mMesh->datasetGroups.push_back( group );
 }
 
@@ -374,13 +372,7 @@ void MDAL::DriverFlo2D::parseHYCHANFile( const std::string &datFileName, const s
   }
 
   for ( std::shared_ptr<DatasetGroup> datasetGroup : datasetGroups )
-  {
-    for ( std::shared_ptr<Dataset> dataset : datasetGroup->datasets )
-      dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
-
-    datasetGroup->setStatistics( MDAL::calculateStatistics( datasetGroup ) );
     mMesh->datasetGroups.push_back( datasetGroup );
-  }
 }
 
 
@@ -531,7 +523,6 @@ static void addDatasetToGroup( std::shared_ptr<MDAL::DatasetGroup> group, std::s
 {
   if ( group && dataset && dataset->valuesCount() > 0 )
   {
-    dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
     group->datasets.push_back( dataset );
   }
 }
@@ -642,10 +633,6 @@ void MDAL::DriverFlo2D::parseTIMDEPFile( const std::string &datFileName, const s
   if ( flowDataset ) addDatasetToGroup( flowDsGroup, flowDataset );
   if ( waterLevelDataset ) addDatasetToGroup( waterLevelDsGroup, waterLevelDataset );
 
-  depthDsGroup->setStatistics( MDAL::calculateStatistics( depthDsGroup ) );
-  flowDsGroup->setStatistics( MDAL::calculateStatistics( flowDsGroup ) );
-  waterLevelDsGroup->setStatistics( MDAL::calculateStatistics( waterLevelDsGroup ) );
-
   mMesh->datasetGroups.push_back( depthDsGroup );
   mMesh->datasetGroups.push_back( flowDsGroup );
   mMesh->datasetGroups.push_back( waterLevelDsGroup );
@@ -811,7 +798,8 @@ void MDAL::DriverFlo2D::createMesh2d( const std::vector<CellCenter> &cells, cons
   // try to reuse Vertexs already created for other Faces by usage of unique_Vertexs set.
 
   double half_cell_size = cell_size / 2;
-  Faces faces( cells.size(), Face( 4 ) );
+  Faces faces;
+  faces.reserve( cells.size(), 4 * cells.size() );
 
   BBox vertexExtent( cellCenterExtent.minX - half_cell_size,
                      cellCenterExtent.maxX + half_cell_size,
@@ -824,9 +812,9 @@ void MDAL::DriverFlo2D::createMesh2d( const std::vector<CellCenter> &cells, cons
 
   Vertices vertices;
 
+  size_t e[4];
   for ( size_t i = 0; i < cells.size(); ++i )
   {
-    Face &e = faces[i];
 
     size_t xVertexIdx = MDAL::toSizeT( ( cells[i].x - vertexExtent.minX ) / cell_size );
     size_t yVertexIdx = MDAL::toSizeT( ( cells[i].y - vertexExtent.minY ) / cell_size );
@@ -867,6 +855,7 @@ void MDAL::DriverFlo2D::createMesh2d( const std::vector<CellCenter> &cells, cons
 
       e[position] = vertexGrid[xVertexIdx + xPos][yVertexIdx + yPos];
     }
+    faces.addFace( e, 4 );
   }
 
   mMesh.reset(
@@ -944,7 +933,8 @@ bool MDAL::DriverFlo2D::parseHDF5Datasets( MemoryMesh *mesh, const std::string &
 
     for ( size_t ts = 0; ts < timesteps; ++ts )
     {
-      std::shared_ptr< MemoryDataset2D > output = std::make_shared< MemoryDataset2D >( ds.get() );
+      // values are stored as float in the file
+      std::shared_ptr< MemoryDataset2D > output = std::make_shared< MemoryDataset2D >( ds.get(), false, true );
       output->setTime( times[ts], parseDurationTimeUnit( timeUnitString ) );
 
       if ( isVector )
@@ -972,7 +962,6 @@ bool MDAL::DriverFlo2D::parseHDF5Datasets( MemoryMesh *mesh, const std::string &
     }
 
     // TODO use mins & maxs arrays
-    ds->setStatistics( MDAL::calculateStatistics( ds ) );
     mesh->datasetGroups.push_back( ds );
 
   }
@@ -16,6 +16,9 @@
 
 #define MDAL_NODATA -9999
 
+// maximum count of values of a strip of rows kept in memory by GdalRasterDataset
+static const size_t MAX_STRIP_SIZE = 1 << 20;
+
 void MDAL::GdalDataset::init( const std::string &dsName )
 {
   mDatasetName = dsName;
@@ -71,92 +74,18 @@ bool MDAL::DriverGdal::meshes_equals( const MDAL::GdalDataset *ds1, const MDAL::
 }
 
 
-bool MDAL::DriverGdal::initVertices( Vertices &vertices )
+bool MDAL::DriverGdal::isLongitudeShifted()
 {
-  Vertex *VertexsPtr = vertices.data();
-  unsigned int mXSize = meshGDALDataset()->mXSize;
-  unsigned int mYSize = meshGDALDataset()->mYSize;
-  const double *mGT = meshGDALDataset()->mGT;
-
-  for ( unsigned int y = 0; y < mYSize; ++y )
-  {
-    for ( unsigned int x = 0; x < mXSize; ++x, ++VertexsPtr )
-    {
-      // VertexsPtr->setId(x + mXSize*y);
-      VertexsPtr->x = mGT[0] + ( x + 0.5 ) * mGT[1] + ( y + 0.5 ) * mGT[2];
-      VertexsPtr->y = mGT[3] + ( x + 0.5 ) * mGT[4] + ( y + 0.5 ) * mGT[5];
-      VertexsPtr->z = 0.0;
-    }
-  }
+  const GdalDataset *dataset = meshGDALDataset();
+  const BBox extent = RegularGridMesh( name(), mFileName, dataset->mXSize, dataset->mYSize, dataset->mGT ).extent();
 
-  BBox extent = computeExtent( vertices );
   // we want to detect situation when there is whole earth represented in dataset
-  bool is_longitude_shifted = ( extent.minX >= 0.0 ) &&
-                              ( fabs( extent.minX + extent.maxX - 360.0 ) < 1.0 ) &&
-                              ( extent.minY >= -90.0 ) &&
-                              ( extent.maxX <= 360.0 ) &&
-                              ( extent.maxX > 180.0 ) &&
-                              ( extent.maxY <= 90.0 );
-  if ( is_longitude_shifted )
-  {
-    for ( Vertices::size_type n = 0; n < vertices.size(); ++n )
-    {
-      if ( vertices[n].x > 180.0 )
-      {
-        vertices[n].x -= 360.0;
-      }
-    }
-  }
-
-  return is_longitude_shifted;
-}
-
-void MDAL::DriverGdal::initFaces( Vertices &Vertexs, Faces &Faces, bool is_longitude_shifted )
-{
-  int reconnected = 0;
-  unsigned int mXSize = meshGDALDataset()->mXSize;
-  unsigned int mYSize = meshGDALDataset()->mYSize;
-
-  size_t i = 0;
-
-  for ( unsigned int y = 0; y < mYSize - 1; ++y )
-  {
-    for ( unsigned int x = 0; x < mXSize - 1; ++x )
-    {
-      if ( is_longitude_shifted &&
-           ( Vertexs[x + mXSize * y].x > 0.0 ) &&
-           ( Vertexs[x + 1 + mXSize * y].x < 0.0 ) )
-        // omit border face
-      {
-        --reconnected;
-        continue;
-      }
-
-      if ( is_longitude_shifted && ( x == 0 ) )
-      {
-        // create extra faces around prime meridian
-        Faces[i].resize( 4 );
-        Faces[i][0] = mXSize * ( y + 1 );
-        Faces[i][3] = mXSize * y;
-        Faces[i][2] = mXSize - 1 + mXSize * y;
-        Faces[i][1] = mXSize - 1 + mXSize * ( y + 1 );
-
-        ++reconnected;
-        ++i;
-      }
-
-      // other faces
-      Faces[i].resize( 4 );
-      Faces[i][0] = x + 1 + mXSize * ( y + 1 );
-      Faces[i][3] = x + 1 + mXSize * y;
-      Faces[i][2] = x + mXSize * y;
-      Faces[i][1] = x + mXSize * ( y + 1 );
-
-      ++i;
-    }
-  }
-  //make sure we have discarded same amount of faces that we have added
-  assert( reconnected == 0 );
+  return ( extent.minX >= 0.0 ) &&
+         ( fabs( extent.minX + extent.maxX - 360.0 ) < 1.0 ) &&
+         ( extent.minY >= -90.0 ) &&
+         ( extent.maxX <= 360.0 ) &&
+         ( extent.maxX > 180.0 ) &&
+         ( extent.maxY <= 90.0 );
 }
 
 std::string MDAL::DriverGdal::GDALFileName( const std::string &fileName )
@@ -196,7 +125,7 @@ MDAL::DriverGdal::metadata_hash MDAL::DriverGdal::parseMetadata( GDALMajorObject
   return meta;
 }
 
-void MDAL::DriverGdal::parseRasterBands( const MDAL::GdalDataset *cfGDALDataset )
+void MDAL::DriverGdal::parseRasterBands( std::shared_ptr<MDAL::GdalDataset> cfGDALDataset )
 {
   for ( unsigned int i = 1; i <= cfGDALDataset->mNBands; ++i ) // starts with 1 .... ehm....
   {
@@ -207,6 +136,8 @@ void MDAL::DriverGdal::parseRasterBands( const MDAL::GdalDataset *cfGDALDataset
       throw MDAL::Error( MDAL_Status::Err_InvalidData, "Invalid GDAL band" );
     }
 
+    mBandDatasets[gdalBand] = cfGDALDataset;
+
     // Reference time
     metadata_hash global_metadata = parseMetadata( cfGDALDataset->mHDataset );
     parseGlobals( global_metadata );
@@ -218,7 +149,7 @@ void MDAL::DriverGdal::parseRasterBands( const MDAL::GdalDataset *cfGDALDataset
     MDAL::RelativeTimestamp time;
     bool is_vector;
     bool is_x;
-    if ( parseBandInfo( cfGDALDataset, metadata, band_name, &time, &is_vector, &is_x ) )
+    if ( parseBandInfo( cfGDALDataset.get(), metadata, band_name, &time, &is_vector, &is_x ) )
     {
       continue;
     }
@@ -317,85 +248,208 @@ MDAL::DateTime MDAL::DriverGdal::referenceTime() const
   return MDAL::DateTime();
 }
 
-void MDAL::DriverGdal::addDataToOutput( GDALRasterBandH raster_band, std::shared_ptr<MemoryDataset2D> tos, bool is_vector, bool is_x )
+MDAL::GdalRasterDataset::GdalRasterDataset( MDAL::DatasetGroup *parent,
+    const MDAL::RegularGridMesh *mesh,
+    const std::vector<GDALRasterBandH> &bands,
+    const std::vector<std::shared_ptr<GdalDataset>> &datasets )
+  : Dataset2D( parent )
+  , mMesh( mesh )
 {
-  assert( raster_band );
-
-  // nodata
-  int pbSuccess;
-  double nodata =  GDALGetRasterNoDataValue( raster_band, &pbSuccess );
-  if ( pbSuccess == 0 ) nodata = std::numeric_limits<double>::quiet_NaN();
-  bool hasNoData = !std::isnan( nodata );
-
-  // offset and scale
-  double offset = 0.0;
-  double scale = GDALGetRasterScale( raster_band, &pbSuccess );
-  if ( ( pbSuccess == 0 ) || MDAL::equals( scale, 0.0 ) || std::isnan( scale ) )
+  assert( bands.size() == datasets.size() );
+  setSupportsActiveFlag( true );
+
+  for ( size_t i = 0; i < bands.size(); ++i )
   {
-    scale = 1.0;
+    assert( bands[i] );
+    Band band;
+    band.handle = bands[i];
+    band.dataset = datasets[i];
+
+    // nodata
+    int pbSuccess;
+    band.nodata = GDALGetRasterNoDataValue( band.handle, &pbSuccess );
+    band.hasNoData = ( pbSuccess != 0 ) && !std::isnan( band.nodata );
+
+    // offset and scale
+    band.scale = GDALGetRasterScale( band.handle, &pbSuccess );
+    if ( ( pbSuccess == 0 ) || MDAL::equals( band.scale, 0.0 ) || std::isnan( band.scale ) )
+    {
+      band.scale = 1.0;
+    }
+    else
+    {
+      band.offset = GDALGetRasterOffset( band.handle, &pbSuccess );
+      if ( ( pbSuccess == 0 ) || std::isnan( band.offset ) )
+      {
+        band.offset = 0.0;
+      }
+    }
+
+    // natural block size, some formats like GRIB have only one block for the whole raster
+    int blockXSize = 0;
+    int blockYSize = 0;
+    GDALGetBlockSize( band.handle, &blockXSize, &blockYSize );
+    const size_t maxStripHeight = std::max<size_t>( 1, MAX_STRIP_SIZE / std::max<size_t>( 1, band.dataset->mXSize ) );
+    band.stripHeight = std::min( maxStripHeight, static_cast<size_t>( std::max( 1, blockYSize ) ) );
+
+    mBands.push_back( std::move( band ) );
   }
-  else
+}
+
+bool MDAL::GdalRasterDataset::readBand( const Band &band, size_t indexStart, size_t count, size_t stride, double *buffer )
+{
+  GdalDataset *dataset = band.dataset.get();
+  std::lock_guard<std::mutex> lock( dataset->mMutex );
+
+  const size_t xSize = dataset->mXSize;
+  const size_t ySize = dataset->mYSize;
+
+  size_t i = 0;
+  while ( i < count )
   {
-    offset = GDALGetRasterOffset( raster_band, &pbSuccess );
-    if ( ( pbSuccess == 0 ) || std::isnan( offset ) )
+    const size_t index = indexStart + i;
+    const size_t row = index / xSize;
+    const size_t column = index % xSize;
+
+    GdalDataset::Strip *strip = dataset->mStrips;
+    if ( !( strip[0].band == band.handle && row >= strip[0].start && row < strip[0].start + strip[0].rows ) )
     {
-      offset = 0.0;
+      std::swap( strip[0], strip[1] );
+      if ( !( strip[0].band == band.handle && row >= strip[0].start && row < strip[0].start + strip[0].rows ) )
+      {
+        // read the strip of rows containing the row, aligned to the blocks of the band, in place of the least recently used
+        strip[0].band = band.handle;
+        strip[0].start = row / band.stripHeight * band.stripHeight;
+        strip[0].rows = std::min( band.stripHeight, ySize - strip[0].start );
+        strip[0].values.resize( strip[0].rows * xSize );
+
+        CPLErr err = GDALRasterIO(
+                       band.handle,
+                       GF_Read,
+                       0, //nXOff
+                       static_cast<int>( strip[0].start ), //nYOff
+                       static_cast<int>( xSize ), //nXSize
+                       static_cast<int>( strip[0].rows ), //nYSize
+                       strip[0].values.data(), //pData
+                       static_cast<int>( xSize ), //nBufXSize
+                       static_cast<int>( strip[0].rows ), //nBufYSize
+                       GDT_Float64, //eBufType
+                       0, //nPixelSpace
+                       0 //nLineSpace
+                     );
+        if ( err != CE_None )
+        {
+          strip[0] = GdalDataset::Strip();
+          return false;
+        }
+      }
     }
+
+    // copy the values of the strip up to the end of the strip or of the requested values
+    const double *values = strip[0].values.data() + ( row - strip[0].start ) * xSize + column;
+    const size_t stripEnd = ( strip[0].start + strip[0].rows ) * xSize;
+    const size_t valuesCount = std::min( count - i, stripEnd - index );
+    for ( size_t j = 0; j < valuesCount; ++j )
+    {
+      const double val = values[j];
+      if ( band.hasNoData && MDAL::equals( val, band.nodata ) )
+        buffer[( i + j ) * stride] = std::numeric_limits<double>::quiet_NaN();
+      else
+        buffer[( i + j ) * stride] = val * band.scale + band.offset;
+    }
+    i += valuesCount;
   }
 
-  unsigned int mXSize = meshGDALDataset()->mXSize;
-  unsigned int mYSize = meshGDALDataset()->mYSize;
+  return true;
+}
+
+size_t MDAL::GdalRasterDataset::scalarData( size_t indexStart, size_t count, double *buffer )
+{
+  assert( group()->isScalar() ); //checked in C API interface
+  assert( mBands.size() == 1 );
+
+  const size_t nValues = valuesCount();
+  if ( indexStart >= nValues )
+    return 0;
+  count = std::min( nValues - indexStart, count );
+
+  if ( !readBand( mBands[0], indexStart, count, 1, buffer ) )
+    return 0;
+
+  return count;
+}
+
+size_t MDAL::GdalRasterDataset::vectorData( size_t indexStart, size_t count, double *buffer )
+{
+  assert( !group()->isScalar() ); //checked in C API interface
+  assert( mBands.size() == 2 );
 
-  for ( unsigned int y = 0; y < mYSize; ++y )
+  const size_t nValues = valuesCount();
+  if ( indexStart >= nValues )
+    return 0;
+  count = std::min( nValues - indexStart, count );
+
+  if ( !readBand( mBands[0], indexStart, count, 2, buffer ) ||
+       !readBand( mBands[1], indexStart, count, 2, buffer + 1 ) )
+    return 0;
+
+  return count;
+}
+
+size_t MDAL::GdalRasterDataset::activeData( size_t indexStart, size_t count, int *buffer )
+{
+  const size_t nFaces = mMesh->facesCount();
+  if ( indexStart >= nFaces )
+    return 0;
+  count = std::min( nFaces - indexStart, count );
+
+  // faces are processed by chunks, reading the values of the vertices between the first and the last vertex of the chunk
+  const size_t valuesPerItem = group()->isScalar() ? 1 : 2;
+  const size_t chunkSize = 4096;
+  std::vector<size_t> vertices( chunkSize * 4 );
+  std::vector<double> values;
+
+  for ( size_t chunkStart = 0; chunkStart < count; chunkStart += chunkSize )
   {
-    // buffering per-line
-    CPLErr err = GDALRasterIO(
-                   raster_band,
-                   GF_Read,
-                   0, //nXOff
-                   static_cast<int>( y ), //nYOff
-                   static_cast<int>( mXSize ), //nXSize
-                   1, //nYSize
-                   mPafScanline, //pData
-                   static_cast<int>( mXSize ), //nBufXSize
-                   1, //nBufYSize
-                   GDT_Float64, //eBufType
-                   0, //nPixelSpace
-                   0 //nLineSpace
-                 );
-    if ( err != CE_None )
+    const size_t chunkCount = std::min( chunkSize, count - chunkStart );
+    size_t minVertex = std::numeric_limits<size_t>::max();
+    size_t maxVertex = 0;
+    for ( size_t i = 0; i < chunkCount; ++i )
     {
-      throw MDAL::Error( MDAL_Status::Err_InvalidData, "Error while buffering data to output" );
+      mMesh->faceVertices( indexStart + chunkStart + i, vertices.data() + i * 4 );
+      for ( size_t j = 0; j < 4; ++j )
+      {
+        minVertex = std::min( minVertex, vertices[i * 4 + j] );
+        maxVertex = std::max( maxVertex, vertices[i * 4 + j] );
+      }
     }
 
-    for ( unsigned int x = 0; x < mXSize; ++x )
+    const size_t verticesCount = maxVertex - minVertex + 1;
+    values.resize( verticesCount * valuesPerItem );
+    const size_t read = valuesPerItem == 1 ?
+                        scalarData( minVertex, verticesCount, values.data() ) :
+                        vectorData( minVertex, verticesCount, values.data() );
+    if ( read != verticesCount )
+      return 0;
+
+    // active only if all the vertices have a value
+    for ( size_t i = 0; i < chunkCount; ++i )
     {
-      unsigned int idx = x + mXSize * y;
-      double val = mPafScanline[x];
-      if ( !hasNoData || !MDAL::equals( val, nodata ) )
+      int active = 1;
+      for ( size_t j = 0; j < 4 && active; ++j )
       {
-        // Apply scale and offset
-        val = val * scale + offset;
-
-        // values is prepolulated with NODATA values, so store only legal values
-        if ( is_vector )
-        {
-          if ( is_x )
-          {
-            tos->setValueX( idx, val );
-          }
-          else
-          {
-            tos->setValueY( idx, val );
-          }
-        }
-        else
+        const size_t valueIndex = ( vertices[i * 4 + j] - minVertex ) * valuesPerItem;
+        for ( size_t k = 0; k < valuesPerItem; ++k )
         {
-          tos->setScalarValue( idx, val );
+          if ( std::isnan( values[valueIndex + k] ) )
+            active = 0;
         }
       }
+      buffer[chunkStart + i] = active;
     }
   }
+
+  return count;
 }
 
 void MDAL::DriverGdal::addDatasetGroups()
@@ -418,21 +472,17 @@ void MDAL::DriverGdal::addDatasetGroups()
 
     for ( timestep_map::const_iterator time_step = band->second.begin(); time_step != band->second.end(); time_step++ )
     {
-      std::vector<GDALRasterBandH> raster_bands = time_step->second;
-      std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared< MDAL::MemoryDataset2D >( group.get(), true );
+      const std::vector<GDALRasterBandH> &raster_bands = time_step->second;
+      std::vector<std::shared_ptr<GdalDataset>> datasets;
+      for ( GDALRasterBandH raster_band : raster_bands )
+        datasets.push_back( mBandDatasets[raster_band] );
 
+      // values are read from the bands on demand
+      std::shared_ptr<MDAL::GdalRasterDataset> dataset = std::make_shared< MDAL::GdalRasterDataset >( group.get(), mMesh.get(), raster_bands, datasets );
       dataset->setTime( time_step->first );
-      for ( std::vector<GDALRasterBandH>::size_type i = 0; i < raster_bands.size(); ++i )
-      {
-        addDataToOutput( raster_bands[i], dataset, is_vector, i == 0 );
-      }
-      dataset->activateFaces( mMesh.get() );
-      dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
       group->datasets.push_back( dataset );
     }
 
-    // TODO use GDALComputeRasterMinMax
-    group->setStatistics( MDAL::calculateStatistics( group ) );
     group->setReferenceTime( referenceTime() );
     mMesh->datasetGroups.push_back( group );
   }
@@ -440,20 +490,19 @@ void MDAL::DriverGdal::addDatasetGroups()
 
 void MDAL::DriverGdal::createMesh()
 {
-  Vertices vertices( meshGDALDataset()->mNPoints );
-  bool is_longitude_shifted = initVertices( vertices );
-
-  Faces faces( meshGDALDataset()->mNVolumes );
-  initFaces( vertices, faces, is_longitude_shifted );
+  // vertices and faces are not stored, they are computed from the geotransform
+  const GdalDataset *dataset = meshGDALDataset();
+  bool is_longitude_shifted = isLongitudeShifted();
 
-  mMesh.reset( new MemoryMesh(
+  mMesh.reset( new RegularGridMesh(
                  name(),
-                 4, //maximum quads
-                 mFileName
+                 mFileName,
+                 dataset->mXSize,
+                 dataset->mYSize,
+                 dataset->mGT,
+                 is_longitude_shifted
                )
              );
-  mMesh->setVertices( std::move( vertices ) );
-  mMesh->setFaces( std::move( faces ) );
   bool proj_added = addSrcProj();
   if ( ( !proj_added ) && is_longitude_shifted )
   {
@@ -524,8 +573,7 @@ MDAL::DriverGdal::DriverGdal( const std::string &name,
                               const std::string &filter,
                               const std::string &gdalDriverName ):
   Driver( name, description, filter, Capability::ReadMesh ),
-  mGdalDriverName( gdalDriverName ),
-  mPafScanline( nullptr )
+  mGdalDriverName( gdalDriverName )
 {}
 
 bool MDAL::DriverGdal::canReadMesh( const std::string &uri )
@@ -555,7 +603,6 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverGdal::load( const std::string &fileName,
   mFileName = fileName;
   MDAL::Log::resetLastStatus();
 
-  mPafScanline = nullptr;
   mMesh.reset();
 
   try
@@ -579,21 +626,18 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverGdal::load( const std::string &fileName,
         // If it is first dataset, create mesh from it
         gdal_datasets.push_back( cfGDALDataset );
 
-        // Init memory for data reader
-        mPafScanline = new double [cfGDALDataset->mXSize];
-
         // Create mMesh
         createMesh();
 
         // Parse bands
-        parseRasterBands( cfGDALDataset.get() );
+        parseRasterBands( cfGDALDataset );
 
       }
       else if ( meshes_equals( meshGDALDataset(), cfGDALDataset.get() ) )
       {
         gdal_datasets.push_back( cfGDALDataset );
         // Parse bands
-        parseRasterBands( cfGDALDataset.get() );
+        parseRasterBands( cfGDALDataset );
       }
     }
 
@@ -617,9 +661,10 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverGdal::load( const std::string &fileName,
     mMesh.reset();
   }
 
+  // the datasets keep the GDAL datasets of their bands open
   gdal_datasets.clear();
-
-  if ( mPafScanline ) delete[] mPafScanline;
+  mBandDatasets.clear();
+  mBands.clear();
 
   // do not allow mesh without any valid datasets
   if ( mMesh && ( mMesh->datasetGroups.empty() ) )
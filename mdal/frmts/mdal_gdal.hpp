@@ -11,11 +11,14 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <mutex>
 
 #include "mdal_data_model.hpp"
 #include "mdal.h"
 #include "mdal_utils.hpp"
 #include "mdal_driver.hpp"
+#include "mdal_regular_grid_mesh.hpp"
 
 namespace MDAL
 {
@@ -43,11 +46,67 @@ namespace MDAL
       unsigned int mNVolumes; /* Faces count */
       double mGT[6]; /* affine transform matrix */
 
+      //! Serializes the reads of the bands, GDAL datasets can't be used from several threads
+      std::mutex mMutex;
+
+      //! Strip of full rows of a band kept in memory, used by GdalRasterDataset
+      struct Strip
+      {
+        GDALRasterBandH band = nullptr;
+        size_t start = 0; // first row
+        size_t rows = 0;
+        std::vector<double> values;
+      };
+
+      //! Last strips read, two to serve both bands of vector datasets, mStrips[0] is the most recently used
+      Strip mStrips[2];
+
     private:
       void parseParameters();
       void parseProj();
   };
 
+  /**
+   * Dataset of GDAL raster bands with lazy loading, one band for scalar datasets and two bands for vector datasets
+   *
+   * Values are read on demand by strips of full rows aligned to the natural block height of the bands,
+   * the last strips read are kept by the GDAL dataset to serve the next contiguous reads. Nodata, scale and offset
+   * are applied while copying the values. Faces are active if all their vertices have a value.
+   *
+   * \note the reads of the bands are serialized with the mutex of their GDAL dataset, the data can be read from different threads.
+   */
+  class GdalRasterDataset: public Dataset2D
+  {
+    public:
+      //! Constructs a dataset reading the \a bands of \a datasets, for a \a mesh created from the first dataset
+      GdalRasterDataset( DatasetGroup *parent,
+                         const RegularGridMesh *mesh,
+                         const std::vector<GDALRasterBandH> &bands,
+                         const std::vector<std::shared_ptr<GdalDataset>> &datasets );
+
+      size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t activeData( size_t indexStart, size_t count, int *buffer ) override;
+
+    private:
+      struct Band
+      {
+        GDALRasterBandH handle = nullptr;
+        std::shared_ptr<GdalDataset> dataset;
+        bool hasNoData = false;
+        double nodata = 0.0;
+        double scale = 1.0;
+        double offset = 0.0;
+        size_t stripHeight = 1; // natural block height, limited to a reasonable strip size
+      };
+
+      //! Reads \a count values of the band from vertex \a indexStart and copy them in \a buffer every \a stride values
+      bool readBand( const Band &band, size_t indexStart, size_t count, size_t stride, double *buffer );
+
+      const RegularGridMesh *mMesh;
+      std::vector<Band> mBands;
+  };
+
   class DriverGdal: public Driver
   {
     public:
@@ -79,29 +138,28 @@ namespace MDAL
 
       void registerDriver();
 
-      void initFaces( Vertices &nodes, Faces &Faces, bool is_longitude_shifted );
-      bool initVertices( Vertices &vertices ); //returns is_longitude_shifted
+      //! Returns whether the raster represents the whole earth with longitudes from 0 to 360 degrees
+      bool isLongitudeShifted();
 
       const GdalDataset *meshGDALDataset();
 
       bool meshes_equals( const GdalDataset *ds1, const GdalDataset *ds2 ) const;
 
       metadata_hash parseMetadata( GDALMajorObjectH gdalBand, const char *pszDomain = nullptr );
-      void addDataToOutput( GDALRasterBandH raster_band, std::shared_ptr<MemoryDataset2D> tos, bool is_vector, bool is_x );
       bool addSrcProj();
       void addDatasetGroups();
       void createMesh();
-      void parseRasterBands( const GdalDataset *cfGDALDataset );
+      void parseRasterBands( std::shared_ptr<GdalDataset> cfGDALDataset );
       void fixRasterBands();
 
       virtual MDAL::DateTime referenceTime() const;
 
       std::string mFileName;
       const std::string mGdalDriverName; /* GDAL driver name */
-      double *mPafScanline; /* temporary buffer for reading one raster line */
-      std::unique_ptr< MemoryMesh > mMesh;
+      std::unique_ptr< RegularGridMesh > mMesh;
       gdal_datasets_vector gdal_datasets;
       data_hash mBands; /* raster bands GDAL handle */
+      std::map<GDALRasterBandH, std::shared_ptr<GdalDataset>> mBandDatasets; /* GDAL (sub)dataset of each band */
   };
 
 } // namespace MDAL
@@ -6,15 +6,60 @@
 #include "mdal_hdf5.hpp"
 #include <cstring>
 #include <algorithm>
+#include <atomic>
+
+#ifndef H5_HAVE_THREADSAFE
+static std::recursive_mutex &hdfMutex()
+{
+  static std::recursive_mutex sMutex;
+  return sMutex;
+}
+
+HdfLock::HdfLock() { hdfMutex().lock(); }
+
+HdfLock::~HdfLock() { hdfMutex().unlock(); }
+#else
+HdfLock::HdfLock() = default;
+
+HdfLock::~HdfLock() = default;
+#endif
+
+// default size of the chunk cache of the HDF5 library
+static const size_t DEFAULT_CHUNK_CACHE_SIZE = 1024 * 1024;
+// memory increment of the core driver, only used to write in the file image
+static const size_t CORE_DRIVER_INCREMENT = 1024 * 1024;
+
+static std::atomic<size_t> sDatasetChunkCacheSize( DEFAULT_CHUNK_CACHE_SIZE );
+static std::atomic<bool> sCoreDriver( false );
+
+void HdfFile::setDatasetChunkCacheSize( size_t bytes ) { sDatasetChunkCacheSize = bytes; }
+
+size_t HdfFile::datasetChunkCacheSize() { return sDatasetChunkCacheSize; }
+
+void HdfFile::setCoreDriver( bool useCoreDriver ) { sCoreDriver = useCoreDriver; }
+
+bool HdfFile::coreDriver() { return sCoreDriver; }
 
 HdfFile::HdfFile( const std::string &path, HdfFile::Mode mode )
   : mPath( path )
 {
+  HdfLock lock;
   switch ( mode )
   {
     case HdfFile::ReadOnly:
       if ( H5Fis_hdf5( mPath.c_str() ) > 0 )
-        d = std::make_shared< Handle >( H5Fopen( path.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT ) );
+      {
+        hid_t fapl = H5P_DEFAULT;
+        if ( sCoreDriver )
+        {
+          // whole file read in memory, without writing back to the file
+          fapl = H5Pcreate( H5P_FILE_ACCESS );
+          H5Pset_fapl_core( fapl, CORE_DRIVER_INCREMENT, 0 );
+        }
+        d = std::make_shared< Handle >( H5Fopen( path.c_str(), H5F_ACC_RDONLY, fapl ) );
+        if ( fapl != H5P_DEFAULT )
+          H5Pclose( fapl );
+      }
       break;
     case HdfFile::ReadWrite:
       if ( H5Fis_hdf5( mPath.c_str() ) > 0 )
@@ -39,12 +84,14 @@ std::string HdfFile::filePath() const
 
 HdfGroup HdfGroup::create( hid_t file, const std::string &path )
 {
+  HdfLock lock;
   auto d = std::make_shared< Handle >( H5Gcreate2( file, path.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) );
   return HdfGroup( d );
 }
 
 HdfGroup::HdfGroup( hid_t file, const std::string &path )
 {
+  HdfLock lock;
   d = std::make_shared< Handle >( H5Gopen( file, path.c_str() ) );
 }
 
@@ -57,10 +104,15 @@ bool HdfGroup::isValid() const { return d->id >= 0; }
 
 hid_t HdfGroup::id() const { return d->id; }
 
-hid_t HdfGroup::file_id() const { return H5Iget_file_id( d->id ); }
+hid_t HdfGroup::file_id() const
+{
+  HdfLock lock;
+  return H5Iget_file_id( d->id );
+}
 
 std::string HdfGroup::name() const
 {
+  HdfLock lock;
   char name[HDF_MAX_NAME];
   H5Iget_name( d->id, name, HDF_MAX_NAME );
   return std::string( name );
@@ -76,6 +128,7 @@ std::string HdfGroup::childPath( const std::string &childName ) const { return n
 
 std::vector<std::string> HdfGroup::objects( H5G_obj_t type ) const
 {
+  HdfLock lock;
   std::vector<std::string> lst;
 
   hsize_t nobj;
@@ -95,6 +148,7 @@ std::vector<std::string> HdfGroup::objects( H5G_obj_t type ) const
 HdfAttribute::HdfAttribute( hid_t obj_id, const std::string &attr_name, HdfDataType type )
   : mType( type )
 {
+  HdfLock lock;
   std::vector<hsize_t> dimsSingle = {1};
   HdfDataspace dsc( dimsSingle );
   d = std::make_shared< Handle >( H5Acreate2( obj_id, attr_name.c_str(), type.id(), dsc.id(), H5P_DEFAULT, H5P_DEFAULT ) );
@@ -103,6 +157,7 @@ HdfAttribute::HdfAttribute( hid_t obj_id, const std::string &attr_name, HdfDataT
 HdfAttribute::HdfAttribute( hid_t obj_id, const std::string &attr_name )
   : m_objId( obj_id ), m_name( attr_name )
 {
+  HdfLock lock;
   d = std::make_shared< Handle >( H5Aopen( obj_id, attr_name.c_str(), H5P_DEFAULT ) );
 }
 
@@ -114,6 +169,7 @@ hid_t HdfAttribute::id() const { return d->id; }
 
 std::string HdfAttribute::readString() const
 {
+  HdfLock lock;
   HdfDataType datatype( H5Aget_type( id() ) );
   char name[HDF_MAX_NAME + 1];
   std::memset( name, '\0', HDF_MAX_NAME + 1 );
@@ -129,6 +185,7 @@ std::string HdfAttribute::readString() const
 
 double HdfAttribute::readDouble() const
 {
+  HdfLock lock;
   HdfDataType datatype( H5Aget_type( id() ) );
   double value;
   herr_t status = H5Aread( d->id, H5T_NATIVE_DOUBLE, &value );
@@ -141,6 +198,7 @@ double HdfAttribute::readDouble() const
 
 void HdfAttribute::write( const std::string &value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -155,6 +213,7 @@ void HdfAttribute::write( const std::string &value )
 
 void HdfAttribute::write( int value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -162,9 +221,19 @@ void HdfAttribute::write( int value )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Could not write data" );
 }
 
+struct HdfDataset::ReadSpaces
+{
+  std::mutex mutex;
+  HdfDataspace fileSpace;
+  HdfDataspace memSpace;
+  hsize_t memSpaceSize = 0;
+};
+
 HdfDataset::HdfDataset( hid_t file, const std::string &path, HdfDataType dtype, size_t nItems )
   : mType( dtype )
+  , mReadSpaces( std::make_shared<ReadSpaces>() )
 {
+  HdfLock lock;
   // Crete dataspace for attribute
   std::vector<hsize_t> dimsSingle = {nItems};
   HdfDataspace dsc( dimsSingle );
@@ -175,13 +244,101 @@ HdfDataset::HdfDataset( hid_t file, const std::string &path, HdfDataType dtype,
 
 HdfDataset::HdfDataset( hid_t file, const std::string &path, HdfDataType dtype, HdfDataspace dataspace )
   : mType( dtype )
+  , mReadSpaces( std::make_shared<ReadSpaces>() )
 {
+  HdfLock lock;
   d = std::make_shared< Handle >( H5Dcreate2( file, path.c_str(), dtype.id(), dataspace.id(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) );
 }
 
+static bool isPrime( size_t value )
+{
+  for ( size_t divisor = 2; divisor * divisor <= value; ++divisor )
+    if ( value % divisor == 0 )
+      return false;
+  return value > 1;
+}
+
+/**
+ * Returns the access properties of the \a dataset with a chunk cache holding the chunks of one index
+ * of the first dimension, within the dataset chunk cache size, or -1 if the default chunk cache is large enough
+ */
+static hid_t chunkCacheAccessProperties( hid_t dataset )
+{
+  const size_t maxCacheSize = sDatasetChunkCacheSize;
+  if ( maxCacheSize <= DEFAULT_CHUNK_CACHE_SIZE )
+    return -1;
+
+  hid_t dcpl = H5Dget_create_plist( dataset );
+  if ( dcpl < 0 )
+    return -1;
+  std::vector<hsize_t> chunkDims;
+  if ( H5Pget_layout( dcpl ) == H5D_CHUNKED )
+  {
+    int rank = H5Pget_chunk( dcpl, 0, nullptr );
+    if ( rank > 0 )
+    {
+      chunkDims.resize( static_cast<size_t>( rank ) );
+      H5Pget_chunk( dcpl, rank, chunkDims.data() );
+    }
+  }
+  H5Pclose( dcpl );
+  if ( chunkDims.empty() )
+    return -1;
+
+  hid_t space = H5Dget_space( dataset );
+  std::vector<hsize_t> dims( chunkDims.size() );
+  int rank = H5Sget_simple_extent_ndims( space );
+  if ( rank == static_cast<int>( dims.size() ) )
+    H5Sget_simple_extent_dims( space, dims.data(), nullptr );
+  H5Sclose( space );
+  if ( rank != static_cast<int>( dims.size() ) )
+    return -1;
+
+  hid_t type = H5Dget_type( dataset );
+  size_t chunkSize = H5Tget_size( type );
+  H5Tclose( type );
+
+  size_t chunksCount = 1; // chunks covering one index of the first dimension
+  for ( size_t i = 0; i < chunkDims.size(); ++i )
+  {
+    chunkSize *= static_cast<size_t>( chunkDims[i] );
+    if ( i > 0 && chunkDims[i] > 0 )
+      chunksCount *= static_cast<size_t>( ( dims[i] + chunkDims[i] - 1 ) / chunkDims[i] );
+  }
+  if ( chunkSize == 0 )
+    return -1;
+
+  const size_t cacheSize = std::min( maxCacheSize, chunksCount * chunkSize );
+  if ( cacheSize <= DEFAULT_CHUNK_CACHE_SIZE )
+    return -1;
+
+  // HDF5 recommends a prime count of hash slots about 100 times the count of chunks in the cache
+  size_t slots = std::max<size_t>( 521, 100 * ( cacheSize / chunkSize ) );
+  while ( !isPrime( slots ) )
+    ++slots;
+
+  hid_t dapl = H5Pcreate( H5P_DATASET_ACCESS );
+  H5Pset_chunk_cache( dapl, slots, cacheSize, H5D_CHUNK_CACHE_W0_DEFAULT );
+  return dapl;
+}
+
 HdfDataset::HdfDataset( hid_t file, const std::string &path )
-  : d( std::make_shared< Handle >( H5Dopen2( file, path.c_str(), H5P_DEFAULT ) ) )
+  : mReadSpaces( std::make_shared<ReadSpaces>() )
 {
+  HdfLock lock;
+  hid_t id = H5Dopen2( file, path.c_str(), H5P_DEFAULT );
+  if ( id >= 0 )
+  {
+    hid_t dapl = chunkCacheAccessProperties( id );
+    if ( dapl >= 0 )
+    {
+      // the chunk cache is created when the dataset is first opened, it needs to be reopened
+      H5Dclose( id );
+      id = H5Dopen2( file, path.c_str(), dapl );
+      H5Pclose( dapl );
+    }
+  }
+  d = std::make_shared< Handle >( id );
 }
 
 HdfDataset::~HdfDataset() = default;
@@ -192,6 +349,7 @@ hid_t HdfDataset::id() const { return d->id; }
 
 std::vector<hsize_t> HdfDataset::dims() const
 {
+  HdfLock lock;
   hid_t sid = H5Dget_space( d->id );
   std::vector<hsize_t> ret( static_cast<size_t>( H5Sget_simple_extent_ndims( sid ) ) );
   H5Sget_simple_extent_dims( sid, ret.data(), nullptr );
@@ -209,6 +367,7 @@ hsize_t HdfDataset::elementCount() const
 
 H5T_class_t HdfDataset::type() const
 {
+  HdfLock lock;
   if ( mType.isValid() )
     return H5Tget_class( mType.id() );
   else
@@ -218,6 +377,91 @@ H5T_class_t HdfDataset::type() const
   }
 }
 
+bool HdfDataset::readArray( hid_t memTypeId, const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, void *buffer ) const
+{
+  if ( !isValid() || !mReadSpaces )
+    return false;
+
+  hsize_t totalItems = 1;
+  for ( hsize_t count : counts )
+    totalItems *= count;
+  if ( totalItems == 0 )
+    return true;
+
+  std::lock_guard<std::mutex> guard( mReadSpaces->mutex );
+  HdfLock lock;
+
+  if ( !prepareReadFileSpace( offsets.size() ) )
+    return false;
+  mReadSpaces->fileSpace.selectHyperslab( offsets, counts );
+  return readSelection( memTypeId, totalItems, buffer );
+}
+
+bool HdfDataset::readElements( hid_t memTypeId, size_t rank, const std::vector<hsize_t> &coordinates, void *buffer ) const
+{
+  if ( !isValid() || !mReadSpaces || rank == 0 )
+    return false;
+
+  hsize_t totalItems = coordinates.size() / rank;
+  if ( totalItems == 0 )
+    return true;
+
+  std::lock_guard<std::mutex> guard( mReadSpaces->mutex );
+  HdfLock lock;
+
+  if ( !prepareReadFileSpace( rank ) )
+    return false;
+  mReadSpaces->fileSpace.selectElements( rank, coordinates );
+  return readSelection( memTypeId, totalItems, buffer );
+}
+
+bool HdfDataset::readElements( size_t rank, const std::vector<hsize_t> &coordinates, double *buffer ) const { return readElements( H5T_NATIVE_DOUBLE, rank, coordinates, buffer ); }
+
+bool HdfDataset::prepareReadFileSpace( size_t rank ) const
+{
+  // the extent of a dataset opened for reading does not change, its dataspace is created once
+  HdfDataspace &fileSpace = mReadSpaces->fileSpace;
+  if ( !fileSpace.isValid() )
+    fileSpace = HdfDataspace( d->id );
+  if ( !fileSpace.isValid() || H5Sget_simple_extent_ndims( fileSpace.id() ) != static_cast<int>( rank ) )
+  {
+    MDAL::Log::debug( "Failed to read data!" );
+    return false;
+  }
+  return true;
+}
+
+bool HdfDataset::readSelection( hid_t memTypeId, hsize_t totalItems, void *buffer ) const
+{
+  HdfDataspace &fileSpace = mReadSpaces->fileSpace;
+  HdfDataspace &memSpace = mReadSpaces->memSpace;
+  if ( !memSpace.isValid() )
+  {
+    memSpace = HdfDataspace( std::vector<hsize_t>( 1, totalItems ) );
+    mReadSpaces->memSpaceSize = totalItems;
+  }
+  else if ( mReadSpaces->memSpaceSize != totalItems )
+  {
+    // resizing the extent selects all the items
+    H5Sset_extent_simple( memSpace.id(), 1, &totalItems, &totalItems );
+    mReadSpaces->memSpaceSize = totalItems;
+  }
+
+  herr_t status = H5Dread( d->id, memTypeId, memSpace.id(), fileSpace.id(), H5P_DEFAULT, buffer );
+  if ( status < 0 )
+  {
+    MDAL::Log::debug( "Failed to read data!" );
+    return false;
+  }
+  return true;
+}
+
+bool HdfDataset::readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, double *buffer ) const { return readArray( H5T_NATIVE_DOUBLE, offsets, counts, buffer ); }
+
+bool HdfDataset::readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, float *buffer ) const { return readArray( H5T_NATIVE_FLOAT, offsets, counts, buffer ); }
+
+bool HdfDataset::readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, int *buffer ) const { return readArray( H5T_NATIVE_INT, offsets, counts, buffer ); }
+
 std::vector<uchar> HdfDataset::readArrayUint8( const std::vector<hsize_t> offsets, const std::vector<hsize_t> counts ) const { return readArray<uchar>( H5T_NATIVE_UINT8, offsets, counts ); }
 
 std::vector<float> HdfDataset::readArray( const std::vector<hsize_t> offsets, const std::vector<hsize_t> counts ) const { return readArray<float>( H5T_NATIVE_FLOAT, offsets, counts ); }
@@ -252,6 +496,7 @@ std::vector<std::string> HdfDataset::readArrayString() const
 
 float HdfDataset::readFloat() const
 {
+  HdfLock lock;
   if ( elementCount() != 1 )
   {
     MDAL::Log::debug( "Not scalar!" );
@@ -270,6 +515,7 @@ float HdfDataset::readFloat() const
 
 void HdfDataset::write( std::vector<float> &value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -280,6 +526,7 @@ void HdfDataset::write( std::vector<float> &value )
 
 void HdfDataset::write( float value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -290,6 +537,7 @@ void HdfDataset::write( float value )
 
 void HdfDataset::write( std::vector<double> &value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -300,6 +548,7 @@ void HdfDataset::write( std::vector<double> &value )
 
 void HdfDataset::write( const std::string &value )
 {
+  HdfLock lock;
   if ( !isValid() || !mType.isValid() )
     throw MDAL::Error( MDAL_Status::Err_FailToWriteToDisk, "Write failed due to invalid data" );
 
@@ -315,6 +564,7 @@ void HdfDataset::write( const std::string &value )
 
 std::string HdfDataset::readString() const
 {
+  HdfLock lock;
   if ( elementCount() != 1 )
   {
     MDAL::Log::debug( "Not scalar!" );
@@ -334,6 +584,7 @@ std::string HdfDataset::readString() const
 
 HdfDataspace::HdfDataspace( const std::vector<hsize_t> &dims )
 {
+  HdfLock lock;
   d = std::make_shared< Handle >( H5Screate_simple(
                                     static_cast<int>( dims.size() ),
                                     dims.data(),
@@ -344,6 +595,7 @@ HdfDataspace::HdfDataspace( const std::vector<hsize_t> &dims )
 
 HdfDataspace::HdfDataspace( hid_t dataset )
 {
+  HdfLock lock;
   if ( dataset >= 0 )
     d = std::make_shared< Handle >( H5Dget_space( dataset ) );
 }
@@ -352,6 +604,7 @@ HdfDataspace::~HdfDataspace() = default;
 
 void HdfDataspace::selectHyperslab( hsize_t start, hsize_t count )
 {
+  HdfLock lock;
   // this function works only for 1D arrays
   assert( H5Sget_simple_extent_ndims( d->id ) == 1 );
 
@@ -362,9 +615,22 @@ void HdfDataspace::selectHyperslab( hsize_t start, hsize_t count )
   }
 }
 
+void HdfDataspace::selectElements( size_t rank, const std::vector<hsize_t> &coordinates )
+{
+  HdfLock lock;
+  assert( H5Sget_simple_extent_ndims( d->id ) == static_cast<int>( rank ) );
+
+  herr_t status = H5Sselect_elements( d->id, H5S_SELECT_SET, coordinates.size() / rank, coordinates.data() );
+  if ( status < 0 )
+  {
+    MDAL::Log::debug( "Failed to select elements!" );
+  }
+}
+
 void HdfDataspace::selectHyperslab( const std::vector<hsize_t> offsets,
                                     const std::vector<hsize_t> counts )
 {
+  HdfLock lock;
   assert( H5Sget_simple_extent_ndims( d->id ) == static_cast<int>( offsets.size() ) );
   assert( offsets.size() == counts.size() );
 
@@ -380,7 +646,7 @@ void HdfDataspace::selectHyperslab( const std::vector<hsize_t> offsets,
   }
 }
 
-bool HdfDataspace::isValid() const { return d->id >= 0; }
+bool HdfDataspace::isValid() const { return d && d->id >= 0; }
 
 hid_t HdfDataspace::id() const { return d->id; }
 
@@ -397,6 +663,7 @@ HdfDataType::HdfDataType( hid_t type, bool isNativeType )
 
 HdfDataType HdfDataType::createString( int size )
 {
+  HdfLock lock;
   assert( size > 0 );
   if ( size > HDF_MAX_NAME )
     size = HDF_MAX_NAME;
@@ -21,6 +21,7 @@ typedef unsigned char uchar;
 #include <vector>
 #include <string>
 #include <numeric>
+#include <mutex>
 
 #include <assert.h>
 #include "stdlib.h"
@@ -31,6 +32,22 @@ struct HdfString
   char data [HDF_MAX_NAME];
 };
 
+/**
+ * Serializes the calls to the HDF5 library during its lifetime when the library is not built thread safe,
+ * so files can be opened and datasets read from different threads. Every wrapper calling the library takes it.
+ * Locks can be nested in the same thread.
+ */
+class HdfLock
+{
+  public:
+    HdfLock();
+    ~HdfLock();
+
+  private:
+    HdfLock( const HdfLock & ) = delete;
+    HdfLock &operator=( const HdfLock & ) = delete;
+};
+
 template <int TYPE> inline void hdfClose( hid_t id ) { MDAL_UNUSED( id ); assert( false ); }
 template <> inline void hdfClose<H5I_FILE>( hid_t id ) { H5Fclose( id ); }
 template <> inline void hdfClose<H5I_GROUP>( hid_t id ) { H5Gclose( id ); }
@@ -45,7 +62,14 @@ class HdfH
   public:
     HdfH( hid_t hid ) : id( hid ) {}
     HdfH( const HdfH &other ) : id( other.id ) { }
-    ~HdfH() { if ( id >= 0 ) hdfClose<TYPE>( id ); }
+    ~HdfH()
+    {
+      if ( id >= 0 )
+      {
+        HdfLock lock;
+        hdfClose<TYPE>( id );
+      }
+    }
 
     hid_t id;
 };
@@ -80,6 +104,14 @@ class HdfFile
     inline bool pathExists( const std::string &path ) const;
     std::string filePath() const;
 
+    //! Sets the maximum size in bytes of the chunk cache of each dataset opened for reading, see MDAL_SetHdf5DatasetChunkCacheSize()
+    static void setDatasetChunkCacheSize( size_t bytes );
+    static size_t datasetChunkCacheSize();
+
+    //! Sets whether the files opened for reading are read in memory with the HDF5 core driver, see MDAL_SetHdf5FileDriver()
+    static void setCoreDriver( bool useCoreDriver );
+    static bool coreDriver();
+
   protected:
     std::shared_ptr<Handle> d;
     std::string mPath;
@@ -180,6 +212,8 @@ class HdfDataspace
     //! select from N-D array
     void selectHyperslab( const std::vector<hsize_t> offsets,
                           const std::vector<hsize_t> counts );
+    //! select the points of N-D array with \a rank dimensions, \a coordinates contains the \a rank coordinates of each point
+    void selectElements( size_t rank, const std::vector<hsize_t> &coordinates );
 
     bool isValid() const;
     hid_t id() const;
@@ -230,11 +264,25 @@ class HdfDataset
     std::vector<double> readArrayDouble( const std::vector<hsize_t> offsets, const std::vector<hsize_t> counts ) const;
     std::vector<int> readArrayInt( const std::vector<hsize_t> offsets, const std::vector<hsize_t> counts ) const;
 
+    //! Reads part of the N-D array into \a buffer, which must be large enough for the product of \a counts items
+    //! The values are converted by HDF5 to the memory type \a memTypeId, returns false on failure
+    //! The dataspaces are kept between consecutive calls on the same dataset
+    bool readArray( hid_t memTypeId, const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, void *buffer ) const;
+    bool readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, double *buffer ) const;
+    bool readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, float *buffer ) const;
+    bool readArray( const std::vector<hsize_t> &offsets, const std::vector<hsize_t> &counts, int *buffer ) const;
+
+    //! Reads the points of the N-D array with \a rank dimensions into \a buffer with one read, \a coordinates contains the
+    //! \a rank coordinates of each point. The values are converted by HDF5 to the memory type \a memTypeId, returns false on failure
+    bool readElements( hid_t memTypeId, size_t rank, const std::vector<hsize_t> &coordinates, void *buffer ) const;
+    bool readElements( size_t rank, const std::vector<hsize_t> &coordinates, double *buffer ) const;
+
     inline bool hasAttribute( const std::string &attr_name ) const;
     inline HdfAttribute attribute( const std::string &attr_name ) const;
 
     template <typename T> std::vector<T> readArray( hid_t mem_type_id ) const
     {
+      HdfLock lock;
       hsize_t cnt = elementCount();
       std::vector<T> data( cnt );
       herr_t status = H5Dread( d->id, mem_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data() );
@@ -250,24 +298,13 @@ class HdfDataset
         const std::vector<hsize_t> offsets,
         const std::vector<hsize_t> counts ) const
     {
-      HdfDataspace dataspace( d->id );
-      dataspace.selectHyperslab( offsets, counts );
-
       hsize_t totalItems = 1;
       for ( auto it = counts.begin(); it != counts.end(); ++it )
         totalItems *= *it;
 
-      std::vector<hsize_t> dims = {totalItems};
-      HdfDataspace memspace( dims );
-      memspace.selectHyperslab( 0, totalItems );
-
       std::vector<T> data( totalItems );
-      herr_t status = H5Dread( d->id, mem_type_id, memspace.id(), dataspace.id(), H5P_DEFAULT, data.data() );
-      if ( status < 0 )
-      {
-        MDAL::Log::debug( "Failed to read data!" );
+      if ( !readArray( mem_type_id, offsets, counts, data.data() ) )
         return std::vector<T>();
-      }
       return data;
     }
 
@@ -290,6 +327,15 @@ class HdfDataset
   protected:
     std::shared_ptr<Handle> d;
     HdfDataType mType; // when in write mode
+
+    // dataspaces of the hyperslab reads, shared by the copies of the dataset
+    struct ReadSpaces;
+    std::shared_ptr<ReadSpaces> mReadSpaces;
+
+    //! Creates the file dataspace of the reads if needed and checks its \a rank, the read spaces must be locked
+    bool prepareReadFileSpace( size_t rank ) const;
+    //! Reads the \a totalItems items selected in the file dataspace, the read spaces must be locked
+    bool readSelection( hid_t memTypeId, hsize_t totalItems, void *buffer ) const;
 };
 
 inline std::vector<std::string> HdfFile::groups() const { return group( "/" ).groups(); }
@@ -304,6 +350,7 @@ inline HdfDataset HdfGroup::dataset( const std::string &dsName ) const { return
 
 inline bool HdfDataset::hasAttribute( const std::string &attr_name ) const
 {
+  HdfLock lock;
   htri_t res = H5Aexists( d->id, attr_name.c_str() );
   return  res > 0 ;
 }
@@ -314,8 +361,16 @@ inline HdfAttribute HdfGroup::attribute( const std::string &attr_name ) const {
 
 inline HdfAttribute HdfDataset::attribute( const std::string &attr_name ) const { return HdfAttribute( d->id, attr_name ); }
 
-inline bool HdfFile::pathExists( const std::string &path ) const { return H5Lexists( d->id, path.c_str(), H5P_DEFAULT ) > 0; }
+inline bool HdfFile::pathExists( const std::string &path ) const
+{
+  HdfLock lock;
+  return H5Lexists( d->id, path.c_str(), H5P_DEFAULT ) > 0;
+}
 
-inline bool HdfGroup::pathExists( const std::string &path ) const { return H5Lexists( d->id, path.c_str(), H5P_DEFAULT ) > 0; }
+inline bool HdfGroup::pathExists( const std::string &path ) const
+{
+  HdfLock lock;
+  return H5Lexists( d->id, path.c_str(), H5P_DEFAULT ) > 0;
+}
 
 #endif // MDAL_HDF5_HPP
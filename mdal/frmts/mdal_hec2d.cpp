@@ -9,6 +9,7 @@
 #include <cmath>
 #include <limits>
 #include <iterator>
+#include <algorithm>
 #include "assert.h"
 
 #include "mdal_hec2d.hpp"
@@ -202,144 +203,336 @@ static std::vector<MDAL::RelativeTimestamp> readTimes( const HdfFile &hdfFile )
   return convertTimeData( times, dataTimeUnits );
 }
 
-void MDAL::DriverHec2D::readFaceOutput( const HdfFile &hdfFile,
-                                        const HdfGroup &rootGroup,
-                                        const std::vector<size_t> &areaElemStartIndex,
-                                        const std::vector<std::string> &flowAreaNames,
-                                        const std::string rawDatasetName,
-                                        const std::string datasetName,
-                                        const std::vector<RelativeTimestamp> &times,
-                                        const DateTime &referenceTime )
+/**
+ * Reads in \a buffer the values of \a count cells or faces from \a start for the timestep \a timeIndex
+ * in a results array [time x cells] or in a geometry array [cells]
+ */
+template <typename T>
+static bool readAreaValues( const HdfDataset &dsValues, hsize_t timeIndex, size_t start, size_t count, T *buffer )
 {
-  std::shared_ptr<DatasetGroup> group = std::make_shared< DatasetGroup >(
-                                          name(),
-                                          mMesh.get(),
-                                          mFileName,
-                                          datasetName
-                                        );
-  group->setDataLocation( MDAL_DataLocation::DataOnFaces );
-  group->setIsScalar( false );
-  group->setReferenceTime( referenceTime );
+  if ( dsValues.dims().size() == 1 )
+  {
+    assert( timeIndex == 0 );
+    return dsValues.readArray( {start}, {count}, buffer );
+  }
+  return dsValues.readArray( {timeIndex, start}, {1, count}, buffer );
+}
+
+static std::vector<MDAL::Hec2DAreaValues> openAreaValues( const HdfGroup &rootGroup,
+    const std::vector<size_t> &areaElemStartIndex,
+    const std::vector<std::string> &flowAreaNames,
+    const std::string &rawDatasetName )
+{
+  std::vector<MDAL::Hec2DAreaValues> areas( flowAreaNames.size() );
+  for ( size_t nArea = 0; nArea < flowAreaNames.size(); ++nArea )
+  {
+    HdfGroup gFlowAreaRes = openHdfGroup( rootGroup, flowAreaNames[nArea] );
+    areas[nArea].elemStartIndex = areaElemStartIndex[nArea];
+    areas[nArea].elemCount = areaElemStartIndex[nArea + 1] - areaElemStartIndex[nArea];
+    areas[nArea].values = openHdfDataset( gFlowAreaRes, rawDatasetName );
+  }
+  return areas;
+}
 
-  std::vector<std::shared_ptr<MDAL::MemoryDataset2D>> datasets;
+MDAL::Hec2DElementDataset::Hec2DElementDataset( MDAL::DatasetGroup *grp,
+    std::shared_ptr<const std::vector<MDAL::Hec2DAreaValues>> areas,
+    hsize_t timeIndex,
+    NoDataRule noDataRule,
+    std::shared_ptr<MDAL::MemoryDataset2D> bedElevation )
+  : Dataset2D( grp )
+  , mAreas( areas )
+  , mTimeIndex( timeIndex )
+  , mNoDataRule( noDataRule )
+  , mBedElevation( bedElevation )
+{
+}
 
-  for ( size_t tidx = 0; tidx < times.size(); ++tidx )
+MDAL::Hec2DElementDataset::~Hec2DElementDataset() = default;
+
+size_t MDAL::Hec2DElementDataset::scalarData( size_t indexStart, size_t count, double *buffer )
+{
+  size_t nValues = valuesCount();
+  if ( ( count < 1 ) || ( indexStart >= nValues ) )
+    return 0;
+  count = std::min( nValues - indexStart, count );
+
+  size_t indexEnd = indexStart + count;
+  for ( const Hec2DAreaValues &area : *mAreas )
   {
-    std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared< MemoryDataset2D >( group.get() );
-    dataset->setTime( times[tidx] );
-    datasets.push_back( dataset );
+    size_t areaStart = std::max( indexStart, area.elemStartIndex );
+    size_t areaEnd = std::min( indexEnd, area.elemStartIndex + area.elemCount );
+    if ( areaStart >= areaEnd )
+      continue;
+
+    // values are stored as float, converted by HDF5 while reading
+    double *vals = buffer + ( areaStart - indexStart );
+    if ( !readAreaValues( area.values, mTimeIndex, areaStart - area.elemStartIndex, areaEnd - areaStart, vals ) )
+      return 0;
+
+    for ( size_t eInx = areaStart; eInx < areaEnd; ++eInx )
+      vals[eInx - areaStart] = applyNoDataRule( eInx, vals[eInx - areaStart] );
   }
+  return count;
+}
 
-  std::shared_ptr<MDAL::MemoryDataset2D> firstDataset;
+size_t MDAL::Hec2DElementDataset::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  size_t nValues = valuesCount();
+  size_t validCount = 0;
+  while ( validCount < count && indices[validCount] < nValues )
+    ++validCount;
+
+  std::vector<hsize_t> coordinates;
+  std::vector<size_t> positions;
+  std::vector<double> values;
+  for ( const Hec2DAreaValues &area : *mAreas )
+  {
+    // points of the area, with their position in the buffer
+    coordinates.clear();
+    positions.clear();
+    const bool hasTime = area.values.dims().size() != 1;
+    for ( size_t i = 0; i < validCount; ++i )
+    {
+      if ( indices[i] < area.elemStartIndex || indices[i] >= area.elemStartIndex + area.elemCount )
+        continue;
+      if ( hasTime )
+        coordinates.push_back( mTimeIndex );
+      coordinates.push_back( indices[i] - area.elemStartIndex );
+      positions.push_back( i );
+    }
+    if ( positions.empty() )
+      continue;
 
-  for ( size_t nArea = 0; nArea < flowAreaNames.size(); ++nArea )
+    // values are stored as float, converted by HDF5 while reading
+    values.resize( positions.size() );
+    if ( !area.values.readElements( hasTime ? 2 : 1, coordinates, values.data() ) )
+      return 0;
+
+    for ( size_t i = 0; i < positions.size(); ++i )
+      buffer[positions[i]] = applyNoDataRule( indices[positions[i]], values[i] );
+  }
+  return validCount;
+}
+
+double MDAL::Hec2DElementDataset::applyNoDataRule( size_t index, double value ) const
+{
+  if ( std::isnan( value ) )
+    return value;
+
+  double eps = std::numeric_limits<double>::min();
+  if ( mNoDataRule == ZeroDepth )
   {
-    std::string flowAreaName = flowAreaNames[nArea];
+    if ( fabs( value ) <= eps ) // 0 Depth is no-data
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+  else //Water surface
+  {
+    assert( mBedElevation );
+    double bed_elev = mBedElevation->scalarValue( index );
+    if ( !std::isnan( bed_elev ) && fabs( bed_elev - value ) <= eps ) // no change from bed elevation
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+  return value;
+}
 
-    HdfGroup gFlowAreaRes = openHdfGroup( rootGroup, flowAreaName );
-    HdfDataset dsVals = openHdfDataset( gFlowAreaRes, rawDatasetName );
-    std::vector<float> vals = dsVals.readArray();
+size_t MDAL::Hec2DElementDataset::vectorData( size_t, size_t, double * )
+{
+  assert( false ); //checked in C API interface
+  return 0;
+}
 
-    HdfGroup gGeom = openHdfGroup( hdfFile, "Geometry" );
-    HdfGroup gGeom2DFlowAreas = openHdfGroup( gGeom, "2D Flow Areas" );
-    HdfGroup gArea = openHdfGroup( gGeom2DFlowAreas, flowAreaName );
-    HdfDataset dsCellFaceInfo = openHdfDataset( gArea, "Cells Face and Orientation Info" );
-    std::vector<hsize_t> celldims = dsCellFaceInfo.dims();
-    std::vector<int> cellFaceInfo = dsCellFaceInfo.readArrayInt();
+MDAL::Hec2DFaceDataset::Hec2DFaceDataset( MDAL::DatasetGroup *grp,
+    std::shared_ptr<const std::vector<MDAL::Hec2DAreaValues>> areas,
+    std::shared_ptr<const std::vector<MDAL::Hec2DAreaFaces>> areaFaces,
+    hsize_t timeIndex )
+  : Dataset2D( grp )
+  , mAreas( areas )
+  , mAreaFaces( areaFaces )
+  , mTimeIndex( timeIndex )
+{
+}
 
-    HdfDataset dsCellFaceOrValues = openHdfDataset( gArea, "Cells Face and Orientation Values" );
-    std::vector<int> cellFaceOrValues = dsCellFaceOrValues.readArrayInt();
+MDAL::Hec2DFaceDataset::~Hec2DFaceDataset() = default;
 
-    HdfDataset dsFacePointIndex = openHdfDataset( gArea, "Faces FacePoint Indexes" );
-    std::vector<hsize_t> fdims = dsFacePointIndex.dims();
-    size_t nFaces = static_cast<size_t>( fdims[0] );
-    std::vector<int> facePointIndex = dsFacePointIndex.readArrayInt();
+size_t MDAL::Hec2DFaceDataset::scalarData( size_t, size_t, double * )
+{
+  assert( false ); //checked in C API interface
+  return 0;
+}
 
-    HdfDataset dsCoords = openHdfDataset( gArea, "FacePoints Coordinate" );
-    std::vector<hsize_t> cdims = dsCoords.dims();
-    std::vector<double> coords = dsCoords.readArrayDouble(); //2xnNodes matrix in array
+size_t MDAL::Hec2DFaceDataset::vectorData( size_t indexStart, size_t count, double *buffer )
+{
+  size_t nValues = valuesCount();
+  if ( ( count < 1 ) || ( indexStart >= nValues ) )
+    return 0;
+  count = std::min( nValues - indexStart, count );
 
-    for ( size_t tidx = 0; tidx < times.size(); ++tidx )
+  size_t indexEnd = indexStart + count;
+  for ( size_t nArea = 0; nArea < mAreas->size(); ++nArea )
+  {
+    const Hec2DAreaValues &area = mAreas->at( nArea );
+    const Hec2DAreaFaces &faces = mAreaFaces->at( nArea );
+    const std::vector<int> &cellFaceInfo = faces.cellFaceInfo;
+    const std::vector<int> &cellFaceOrValues = faces.cellFaceOrValues;
+    const std::vector<int> &facePointIndex = faces.facePointIndex;
+    const std::vector<double> &coords = faces.coords;
+
+    size_t areaStart = std::max( indexStart, area.elemStartIndex );
+    size_t areaEnd = std::min( indexEnd, area.elemStartIndex + area.elemCount );
+    if ( areaStart >= areaEnd )
+      continue;
+
+    // cells of the area without faces info have no value
+    size_t cellStart = areaStart - area.elemStartIndex;
+    size_t cellEnd = std::max( cellStart, std::min( areaEnd - area.elemStartIndex, cellFaceInfo.size() / 2 ) );
+    for ( size_t cell_idx = cellEnd; cell_idx < areaEnd - area.elemStartIndex; ++cell_idx )
     {
-      std::shared_ptr<MDAL::MemoryDataset2D> dataset = datasets[tidx];
-      double *values = dataset->values();
+      size_t bufferIndex = cell_idx + area.elemStartIndex - indexStart;
+      buffer[bufferIndex * 2] = std::numeric_limits<double>::quiet_NaN();
+      buffer[bufferIndex * 2 + 1] = std::numeric_limits<double>::quiet_NaN();
+    }
+    if ( cellStart >= cellEnd )
+      continue;
 
-      for ( size_t cell_idx = 0; cell_idx < celldims.at( 0 ); ++cell_idx )
+    // only the range of faces of the requested cells is read
+    size_t minFaceIndex = std::numeric_limits<size_t>::max();
+    size_t maxFaceIndex = 0;
+    for ( size_t cell_idx = cellStart; cell_idx < cellEnd; ++cell_idx )
+    {
+      size_t firstPosition = static_cast<size_t>( cellFaceInfo[cell_idx * 2] );
+      size_t faceCount = static_cast<size_t>( cellFaceInfo[cell_idx * 2 + 1] );
+      for ( size_t f = 0; f < faceCount; ++f )
       {
-        size_t cell_mdal_idx = cell_idx + areaElemStartIndex[nArea];
-        double valx = 0;
-        double valy = 0;
-        size_t consideredValueCount = 0;
-        size_t firstPosition = static_cast<size_t>( cellFaceInfo[cell_idx * 2] );
-        size_t faceCount = static_cast<size_t>( cellFaceInfo[cell_idx * 2 + 1] );
-        for ( size_t f = 0; f < faceCount; ++f )
-        {
-          //get face indexes
-          size_t faceIndex1 = static_cast<size_t>( cellFaceOrValues[( firstPosition + f ) * 2] );
-          size_t faceIndex2 = static_cast<size_t>( cellFaceOrValues[( firstPosition + ( f + 1 ) % faceCount ) * 2] );
-          double val1 = static_cast<double>( vals[faceIndex1 + tidx * nFaces] );
-          double val2 = static_cast<double>( vals[faceIndex2 + tidx * nFaces] );
-          if ( std::isnan( val1 ) || std::isnan( val2 ) )
-            continue;
-
-          size_t indexPoint11 = facePointIndex[faceIndex1 * 2];
-          size_t indexPoint12 = facePointIndex[faceIndex1 * 2 + 1];
-          size_t indexPoint21 = facePointIndex[faceIndex2 * 2];
-          size_t indexPoint22 = facePointIndex[faceIndex2 * 2 + 1];
-          bool commonIndex = ( indexPoint11 == indexPoint21 ||
-                               indexPoint11 == indexPoint22 ||
-                               indexPoint12 == indexPoint21 ||
-                               indexPoint12 == indexPoint22 );
-          if ( !commonIndex )
-          {
-            // should not happen, but better to prevent
-            continue;
-          }
-
-          double dx1 = coords[indexPoint11 * 2] - coords[indexPoint12 * 2];
-          double dy1 = coords[indexPoint11 * 2 + 1] - coords[indexPoint12 * 2 + 1];
-          double dx2 = coords[indexPoint21 * 2] - coords[indexPoint22 * 2];
-          double dy2 = coords[indexPoint21 * 2 + 1] - coords[indexPoint22 * 2 + 1];
-          double l1 = sqrt( dx1 * dx1 + dy1 * dy1 );
-          double l2 = sqrt( dx2 * dx2 + dy2 * dy2 );
-          if ( l1 == 0 || l2 == 0 )
-          {
-            continue;
-          }
-          double nx1 =   -dy1 / l1;
-          double ny1 =  dx1 / l1;
-          double nx2 =   -dy2 / l2;
-          double ny2 =  dx2 / l2;
-
-          double deter = nx1 * ny2 - nx2 * ny1;
-          if ( deter == 0 ) //colinear face, forbidden by hecras, but better to prevent
-            continue;
-          valx += ( ny2 * val1 - ny1 * val2 ) / deter;
-          valy += ( nx1 * val2 - nx2 * val1 ) / deter;
-          consideredValueCount++;
-        }
-        if ( consideredValueCount != 0 )
+        size_t faceIndex = static_cast<size_t>( cellFaceOrValues[( firstPosition + f ) * 2] );
+        minFaceIndex = std::min( minFaceIndex, faceIndex );
+        maxFaceIndex = std::max( maxFaceIndex, faceIndex );
+      }
+    }
+
+    std::vector<float> vals;
+    if ( minFaceIndex <= maxFaceIndex )
+    {
+      vals.resize( maxFaceIndex - minFaceIndex + 1 );
+      if ( !readAreaValues( area.values, mTimeIndex, minFaceIndex, vals.size(), vals.data() ) )
+        return 0;
+    }
+
+    for ( size_t cell_idx = cellStart; cell_idx < cellEnd; ++cell_idx )
+    {
+      size_t bufferIndex = cell_idx + area.elemStartIndex - indexStart;
+      double valx = 0;
+      double valy = 0;
+      size_t consideredValueCount = 0;
+      size_t firstPosition = static_cast<size_t>( cellFaceInfo[cell_idx * 2] );
+      size_t faceCount = static_cast<size_t>( cellFaceInfo[cell_idx * 2 + 1] );
+      for ( size_t f = 0; f < faceCount; ++f )
+      {
+        //get face indexes
+        size_t faceIndex1 = static_cast<size_t>( cellFaceOrValues[( firstPosition + f ) * 2] );
+        size_t faceIndex2 = static_cast<size_t>( cellFaceOrValues[( firstPosition + ( f + 1 ) % faceCount ) * 2] );
+        double val1 = static_cast<double>( vals[faceIndex1 - minFaceIndex] );
+        double val2 = static_cast<double>( vals[faceIndex2 - minFaceIndex] );
+        if ( std::isnan( val1 ) || std::isnan( val2 ) )
+          continue;
+
+        size_t indexPoint11 = facePointIndex[faceIndex1 * 2];
+        size_t indexPoint12 = facePointIndex[faceIndex1 * 2 + 1];
+        size_t indexPoint21 = facePointIndex[faceIndex2 * 2];
+        size_t indexPoint22 = facePointIndex[faceIndex2 * 2 + 1];
+        bool commonIndex = ( indexPoint11 == indexPoint21 ||
+                             indexPoint11 == indexPoint22 ||
+                             indexPoint12 == indexPoint21 ||
+                             indexPoint12 == indexPoint22 );
+        if ( !commonIndex )
         {
-          valx /= consideredValueCount;
-          valy /= consideredValueCount;
-          values[cell_mdal_idx * 2] = valx;
-          values[cell_mdal_idx * 2 + 1] = valy;
+          // should not happen, but better to prevent
+          continue;
         }
-        else
+
+        double dx1 = coords[indexPoint11 * 2] - coords[indexPoint12 * 2];
+        double dy1 = coords[indexPoint11 * 2 + 1] - coords[indexPoint12 * 2 + 1];
+        double dx2 = coords[indexPoint21 * 2] - coords[indexPoint22 * 2];
+        double dy2 = coords[indexPoint21 * 2 + 1] - coords[indexPoint22 * 2 + 1];
+        double l1 = sqrt( dx1 * dx1 + dy1 * dy1 );
+        double l2 = sqrt( dx2 * dx2 + dy2 * dy2 );
+        if ( l1 == 0 || l2 == 0 )
         {
-          values[cell_mdal_idx * 2] = std::numeric_limits<double>::quiet_NaN();
-          values[cell_mdal_idx * 2 + 1] = std::numeric_limits<double>::quiet_NaN();
+          continue;
         }
+        double nx1 =   -dy1 / l1;
+        double ny1 =  dx1 / l1;
+        double nx2 =   -dy2 / l2;
+        double ny2 =  dx2 / l2;
+
+        double deter = nx1 * ny2 - nx2 * ny1;
+        if ( deter == 0 ) //colinear face, forbidden by hecras, but better to prevent
+          continue;
+        valx += ( ny2 * val1 - ny1 * val2 ) / deter;
+        valy += ( nx1 * val2 - nx2 * val1 ) / deter;
+        consideredValueCount++;
+      }
+      if ( consideredValueCount != 0 )
+      {
+        valx /= consideredValueCount;
+        valy /= consideredValueCount;
+        buffer[bufferIndex * 2] = valx;
+        buffer[bufferIndex * 2 + 1] = valy;
+      }
+      else
+      {
+        buffer[bufferIndex * 2] = std::numeric_limits<double>::quiet_NaN();
+        buffer[bufferIndex * 2 + 1] = std::numeric_limits<double>::quiet_NaN();
       }
     }
   }
+  return count;
+}
+
+static std::shared_ptr<const std::vector<MDAL::Hec2DAreaFaces>> readAreaFaces( const HdfFile &hdfFile, const std::vector<std::string> &flowAreaNames )
+{
+  std::shared_ptr<std::vector<MDAL::Hec2DAreaFaces>> areaFaces = std::make_shared<std::vector<MDAL::Hec2DAreaFaces>>( flowAreaNames.size() );
+  HdfGroup gGeom = openHdfGroup( hdfFile, "Geometry" );
+  HdfGroup gGeom2DFlowAreas = openHdfGroup( gGeom, "2D Flow Areas" );
+  for ( size_t nArea = 0; nArea < flowAreaNames.size(); ++nArea )
+  {
+    HdfGroup gArea = openHdfGroup( gGeom2DFlowAreas, flowAreaNames[nArea] );
+    MDAL::Hec2DAreaFaces &faces = areaFaces->at( nArea );
+    faces.cellFaceInfo = openHdfDataset( gArea, "Cells Face and Orientation Info" ).readArrayInt();
+    faces.cellFaceOrValues = openHdfDataset( gArea, "Cells Face and Orientation Values" ).readArrayInt();
+    faces.facePointIndex = openHdfDataset( gArea, "Faces FacePoint Indexes" ).readArrayInt();
+    faces.coords = openHdfDataset( gArea, "FacePoints Coordinate" ).readArrayDouble(); //2xnNodes matrix in array
+  }
+  return areaFaces;
+}
+
+void MDAL::DriverHec2D::readFaceOutput( const HdfGroup &rootGroup,
+                                        const std::vector<size_t> &areaElemStartIndex,
+                                        const std::vector<std::string> &flowAreaNames,
+                                        std::shared_ptr<const std::vector<Hec2DAreaFaces>> areaFaces,
+                                        const std::string rawDatasetName,
+                                        const std::string datasetName,
+                                        const std::vector<RelativeTimestamp> &times,
+                                        const DateTime &referenceTime )
+{
+  std::shared_ptr<DatasetGroup> group = std::make_shared< DatasetGroup >(
+                                          name(),
+                                          mMesh.get(),
+                                          mFileName,
+                                          datasetName
+                                        );
+  group->setDataLocation( MDAL_DataLocation::DataOnFaces );
+  group->setIsScalar( false );
+  group->setReferenceTime( referenceTime );
+
+  std::shared_ptr<const std::vector<Hec2DAreaValues>> areas =
+    std::make_shared<const std::vector<Hec2DAreaValues>>( openAreaValues( rootGroup, areaElemStartIndex, flowAreaNames, rawDatasetName ) );
 
-  for ( auto dataset : datasets )
+  for ( size_t tidx = 0; tidx < times.size(); ++tidx )
   {
-    dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
+    std::shared_ptr<Hec2DFaceDataset> dataset = std::make_shared< Hec2DFaceDataset >( group.get(), areas, areaFaces, tidx );
+    dataset->setTime( times[tidx] );
     group->datasets.push_back( dataset );
   }
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   mMesh->datasetGroups.push_back( group );
 }
 
@@ -347,32 +540,34 @@ void MDAL::DriverHec2D::readFaceResults( const HdfFile &hdfFile,
     const std::vector<size_t> &areaElemStartIndex,
     const std::vector<std::string> &flowAreaNames )
 {
+  // geometry of the faces shared by all the face centered outputs
+  std::shared_ptr<const std::vector<Hec2DAreaFaces>> areaFaces = readAreaFaces( hdfFile, flowAreaNames );
+
   // UNSTEADY
   HdfGroup flowGroup = get2DFlowAreasGroup( hdfFile, "Unsteady Time Series" );
   MDAL::DateTime referenceDateTime = readReferenceDateTime( hdfFile );
-  readFaceOutput( hdfFile, flowGroup, areaElemStartIndex, flowAreaNames, "Face Shear Stress", "Shear Stress", mTimes, referenceDateTime );
-  readFaceOutput( hdfFile, flowGroup, areaElemStartIndex, flowAreaNames, "Face Velocity", "Velocity", mTimes, referenceDateTime );
+  readFaceOutput( flowGroup, areaElemStartIndex, flowAreaNames, areaFaces, "Face Shear Stress", "Shear Stress", mTimes, referenceDateTime );
+  readFaceOutput( flowGroup, areaElemStartIndex, flowAreaNames, areaFaces, "Face Velocity", "Velocity", mTimes, referenceDateTime );
 
   // SUMMARY
   flowGroup = get2DFlowAreasGroup( hdfFile, "Summary Output" );
   std::vector<MDAL::RelativeTimestamp> dummyTimes( 1, MDAL::RelativeTimestamp() );
 
-  readFaceOutput( hdfFile, flowGroup, areaElemStartIndex, flowAreaNames, "Maximum Face Shear Stress", "Shear Stress/Maximums", dummyTimes, referenceDateTime );
-  readFaceOutput( hdfFile, flowGroup, areaElemStartIndex, flowAreaNames, "Maximum Face Velocity", "Velocity/Maximums", dummyTimes, referenceDateTime );
+  readFaceOutput( flowGroup, areaElemStartIndex, flowAreaNames, areaFaces, "Maximum Face Shear Stress", "Shear Stress/Maximums", dummyTimes, referenceDateTime );
+  readFaceOutput( flowGroup, areaElemStartIndex, flowAreaNames, areaFaces, "Maximum Face Velocity", "Velocity/Maximums", dummyTimes, referenceDateTime );
 }
 
 
-std::shared_ptr<MDAL::MemoryDataset2D> MDAL::DriverHec2D::readElemOutput( const HdfGroup &rootGroup,
-    const std::vector<size_t> &areaElemStartIndex,
-    const std::vector<std::string> &flowAreaNames,
-    const std::string rawDatasetName,
-    const std::string datasetName,
-    const std::vector<RelativeTimestamp> &times,
-    std::shared_ptr<MDAL::MemoryDataset2D> bed_elevation,
-    const DateTime &referenceTime )
+void MDAL::DriverHec2D::readElemOutput( const HdfGroup &rootGroup,
+                                        const std::vector<size_t> &areaElemStartIndex,
+                                        const std::vector<std::string> &flowAreaNames,
+                                        const std::string rawDatasetName,
+                                        const std::string datasetName,
+                                        const std::vector<RelativeTimestamp> &times,
+                                        Hec2DElementDataset::NoDataRule noDataRule,
+                                        std::shared_ptr<MDAL::MemoryDataset2D> bed_elevation,
+                                        const DateTime &referenceTime )
 {
-  double eps = std::numeric_limits<double>::min();
-
   std::shared_ptr<DatasetGroup> group = std::make_shared< DatasetGroup >(
                                           name(),
                                           mMesh.get(),
@@ -383,74 +578,16 @@ std::shared_ptr<MDAL::MemoryDataset2D> MDAL::DriverHec2D::readElemOutput( const
   group->setIsScalar( true );
   group->setReferenceTime( referenceTime );
 
-  std::vector<std::shared_ptr<MDAL::MemoryDataset2D>> datasets;
+  std::shared_ptr<const std::vector<Hec2DAreaValues>> areas =
+    std::make_shared<const std::vector<Hec2DAreaValues>>( openAreaValues( rootGroup, areaElemStartIndex, flowAreaNames, rawDatasetName ) );
 
   for ( size_t tidx = 0; tidx < times.size(); ++tidx )
   {
-    std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared< MemoryDataset2D >( group.get() );
+    std::shared_ptr<Hec2DElementDataset> dataset = std::make_shared< Hec2DElementDataset >( group.get(), areas, tidx, noDataRule, bed_elevation );
     dataset->setTime( times[tidx] );
-    datasets.push_back( dataset );
-  }
-
-  for ( size_t nArea = 0; nArea < flowAreaNames.size(); ++nArea )
-  {
-    size_t nAreaElements = areaElemStartIndex[nArea + 1] - areaElemStartIndex[nArea];
-    std::string flowAreaName = flowAreaNames[nArea];
-    HdfGroup gFlowAreaRes = openHdfGroup( rootGroup, flowAreaName );
-
-    HdfDataset dsVals = openHdfDataset( gFlowAreaRes, rawDatasetName );
-    std::vector<float> vals = dsVals.readArray();
-
-    for ( size_t tidx = 0; tidx < times.size(); ++tidx )
-    {
-      std::shared_ptr<MDAL::MemoryDataset2D> dataset = datasets[tidx];
-      double *values = dataset->values();
-
-      for ( size_t i = 0; i < nAreaElements; ++i )
-      {
-        size_t idx = tidx * nAreaElements + i;
-        size_t eInx = areaElemStartIndex[nArea] + i;
-        double val = static_cast<double>( vals[idx] );
-        if ( !std::isnan( val ) )
-        {
-          if ( !bed_elevation )
-          {
-            // we are populating bed elevation dataset
-            values[eInx] = val;
-          }
-          else
-          {
-            if ( datasetName == "Depth" )
-            {
-              if ( fabs( val ) > eps ) // 0 Depth is no-data
-              {
-                values[eInx] = val;
-              }
-            }
-            else //Water surface
-            {
-              assert( bed_elevation );
-              double bed_elev = bed_elevation->scalarValue( eInx );
-              if ( std::isnan( bed_elev ) || fabs( bed_elev - val ) > eps ) // change from bed elevation
-              {
-                values[eInx] = val;
-              }
-            }
-          }
-        }
-      }
-    }
-  }
-
-  for ( auto dataset : datasets )
-  {
-    dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
     group->datasets.push_back( dataset );
   }
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   mMesh->datasetGroups.push_back( group );
-
-  return datasets[0];
 }
 
 std::shared_ptr<MDAL::MemoryDataset2D> MDAL::DriverHec2D::readBedElevation(
@@ -458,19 +595,32 @@ std::shared_ptr<MDAL::MemoryDataset2D> MDAL::DriverHec2D::readBedElevation(
   const std::vector<size_t> &areaElemStartIndex,
   const std::vector<std::string> &flowAreaNames )
 {
-  std::vector<MDAL::RelativeTimestamp> times( 1 );
-  DateTime referenceTime;
+  // bed elevation is needed to filter the water surface, it is kept in memory
+  std::shared_ptr<DatasetGroup> group = std::make_shared< DatasetGroup >(
+                                          name(),
+                                          mMesh.get(),
+                                          mFileName,
+                                          "Bed Elevation"
+                                        );
+  group->setDataLocation( MDAL_DataLocation::DataOnFaces );
+  group->setIsScalar( true );
+
+  // values are stored as float in the file
+  std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared< MemoryDataset2D >( group.get(), false, true );
+  dataset->setTime( RelativeTimestamp() );
+  float *values = dataset->singlePrecisionValues();
 
-  return readElemOutput(
-           gGeom2DFlowAreas,
-           areaElemStartIndex,
-           flowAreaNames,
-           "Cells Minimum Elevation",
-           "Bed Elevation",
-           times,
-           std::shared_ptr<MDAL::MemoryDataset2D>(),
-           referenceTime
-         );
+  std::vector<Hec2DAreaValues> areas = openAreaValues( gGeom2DFlowAreas, areaElemStartIndex, flowAreaNames, "Cells Minimum Elevation" );
+  for ( const Hec2DAreaValues &area : areas )
+  {
+    if ( !readAreaValues( area.values, 0, 0, area.elemCount, values + area.elemStartIndex ) )
+      throw MDAL::Error( MDAL_Status::Err_InvalidData, "Unable to read Cells Minimum Elevation" );
+  }
+
+  group->datasets.push_back( dataset );
+  mMesh->datasetGroups.push_back( group );
+
+  return dataset;
 }
 
 void MDAL::DriverHec2D::readElemResults(
@@ -489,6 +639,7 @@ void MDAL::DriverHec2D::readElemResults(
     "Water Surface",
     "Water Surface",
     mTimes,
+    Hec2DElementDataset::BedElevation,
     bed_elevation,
     mReferenceTime );
   readElemOutput(
@@ -498,6 +649,7 @@ void MDAL::DriverHec2D::readElemResults(
     "Depth",
     "Depth",
     mTimes,
+    Hec2DElementDataset::ZeroDepth,
     bed_elevation,
     mReferenceTime );
 
@@ -513,6 +665,7 @@ void MDAL::DriverHec2D::readElemResults(
     "Maximum Water Surface",
     "Water Surface/Maximums",
     dummyTimes,
+    Hec2DElementDataset::BedElevation,
     bed_elevation,
     mReferenceTime
   );
@@ -571,6 +724,7 @@ typedef struct FlowAreasAttribute505
 std::vector<std::string> MDAL::DriverHec2D::read2DFlowAreasNames505( HdfGroup gGeom2DFlowAreas ) const
 {
   HdfDataset dsAttributes = openHdfDataset( gGeom2DFlowAreas, "Attributes" );
+  HdfLock lock;
   hid_t attributeHID = H5Tcreate( H5T_COMPOUND, sizeof( FlowAreasAttribute505 ) );
   hid_t stringHID = H5Tcopy( H5T_C_S1 );
   H5Tset_size( stringHID, HDF_MAX_NAME );
@@ -648,11 +802,10 @@ void MDAL::DriverHec2D::parseMesh(
     size_t maxFaces = edims[1]; // elems have up to 8 faces, but sometimes the table has less than 8 columns
     std::vector<int> elem_nodes = dsElems.readArrayInt(); //maxFacesxnElements matrix in array
     areaElemStartIndex[nArea] = faces.size();
-    faces.resize( faces.size() + nElems );
+    faces.reserve( faces.size() + nElems, faces.vertexIndicesCount() + nElems * maxFaces );
+    std::vector<size_t> idx( maxFaces );
     for ( size_t e = 0; e < nElems; ++e )
     {
-      size_t eIdx = areaElemStartIndex[nArea] + e;
-      std::vector<size_t> idx( maxFaces );
       size_t nValidVertexes = maxFaces;
       for ( size_t fi = 0; fi < maxFaces; ++fi )
       {
@@ -668,8 +821,7 @@ void MDAL::DriverHec2D::parseMesh(
           idx[fi] = areaNodeStartIndex + static_cast<size_t>( elem_node_idx ); // shift by this area start node index
         }
       }
-      if ( nValidVertexes > 0 )
-        faces[eIdx].assign( idx.begin(), std::next( idx.begin(), nValidVertexes ) );
+      faces.addFace( idx.data(), nValidVertexes );
 
       if ( nValidVertexes > maxVerticesInFace )
         maxVerticesInFace = nValidVertexes;
@@ -783,3 +935,110 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverHec2D::load( const std::string &resultsF
 
   return std::unique_ptr<Mesh>( mMesh.release() );
 }
+
+std::unique_ptr<MDAL::MeshSummary> MDAL::DriverHec2D::loadSummary( const std::string &resultsFile, const std::string & )
+{
+  MDAL::Log::resetLastStatus();
+  std::unique_ptr<MeshSummary> summary( new MeshSummary );
+
+  try
+  {
+    HdfFile hdfFile = openHdfFile( resultsFile );
+
+    std::string fileType = openHdfAttribute( hdfFile, "File Type" );
+    bool oldFormat = canReadOldFormat( fileType );
+
+    HdfGroup gGeom = openHdfGroup( hdfFile, "Geometry" );
+    HdfGroup gGeom2DFlowAreas = openHdfGroup( gGeom, "2D Flow Areas" );
+
+    std::vector<std::string> flowAreaNames;
+    if ( oldFormat )
+      flowAreaNames = read2DFlowAreasNamesOld( gGeom2DFlowAreas );
+    else
+      flowAreaNames = read2DFlowAreasNames505( gGeom2DFlowAreas );
+
+    summary->driverName = name();
+    summary->uri = resultsFile;
+    try
+    {
+      summary->crs = MDAL::trim( openHdfAttribute( hdfFile, "Projection" ) );
+    }
+    catch ( MDAL_Status ) { /* projection not set */}
+    catch ( MDAL::Error ) { /* projection not set */}
+
+    // same vertices and faces as parseMesh(), only the coordinates are read for the extent
+    std::vector<size_t> areaElemStartIndex( flowAreaNames.size() + 1 );
+    for ( size_t nArea = 0; nArea < flowAreaNames.size(); ++nArea )
+    {
+      HdfGroup gArea = openHdfGroup( gGeom2DFlowAreas, flowAreaNames[nArea] );
+
+      HdfDataset dsCoords = openHdfDataset( gArea, "FacePoints Coordinate" );
+      std::vector<hsize_t> cdims = dsCoords.dims();
+      std::vector<double> coords = dsCoords.readArrayDouble(); //2xnNodes matrix in array
+      size_t nNodes = cdims[0];
+      for ( size_t n = 0; n < nNodes; ++n )
+      {
+        const double x = coords[cdims[1] * n];
+        const double y = coords[cdims[1] * n + 1];
+        summary->extent.minX = std::min( summary->extent.minX, x );
+        summary->extent.maxX = std::max( summary->extent.maxX, x );
+        summary->extent.minY = std::min( summary->extent.minY, y );
+        summary->extent.maxY = std::max( summary->extent.maxY, y );
+      }
+      summary->verticesCount += nNodes;
+
+      HdfDataset dsElems = openHdfDataset( gArea, "Cells FacePoint Indexes" );
+      areaElemStartIndex[nArea] = summary->facesCount;
+      summary->facesCount += static_cast<size_t>( dsElems.dims()[0] );
+    }
+    areaElemStartIndex[flowAreaNames.size()] = summary->facesCount;
+
+    const std::vector<RelativeTimestamp> times = readTimes( hdfFile );
+    const DateTime referenceTime = readReferenceDateTime( hdfFile );
+    const std::vector<RelativeTimestamp> dummyTimes( 1, RelativeTimestamp() );
+
+    // same groups as load(), the arrays of the values are opened to check they exist but not read
+    auto addGroup = [&]( const HdfGroup & rootGroup, const std::string & rawDatasetName, const std::string & datasetName,
+                         bool isScalar, const std::vector<RelativeTimestamp> &groupTimes, const DateTime & groupReferenceTime )
+    {
+      openAreaValues( rootGroup, areaElemStartIndex, flowAreaNames, rawDatasetName );
+
+      DatasetGroupSummary group;
+      group.name = datasetName;
+      group.dataLocation = MDAL_DataLocation::DataOnFaces;
+      group.isScalar = isScalar;
+      group.datasetsCount = groupTimes.size();
+      group.referenceTime = groupReferenceTime;
+      if ( !groupTimes.empty() )
+      {
+        group.startTime = *std::min_element( groupTimes.begin(), groupTimes.end() );
+        group.endTime = *std::max_element( groupTimes.begin(), groupTimes.end() );
+      }
+      summary->groups.push_back( group );
+    };
+
+    addGroup( gGeom2DFlowAreas, "Cells Minimum Elevation", "Bed Elevation", true, dummyTimes, DateTime() );
+
+    HdfGroup unsteadyGroup = get2DFlowAreasGroup( hdfFile, "Unsteady Time Series" );
+    HdfGroup summaryGroup = get2DFlowAreasGroup( hdfFile, "Summary Output" );
+    addGroup( unsteadyGroup, "Water Surface", "Water Surface", true, times, referenceTime );
+    addGroup( unsteadyGroup, "Depth", "Depth", true, times, referenceTime );
+    addGroup( summaryGroup, "Maximum Water Surface", "Water Surface/Maximums", true, dummyTimes, referenceTime );
+    addGroup( unsteadyGroup, "Face Shear Stress", "Shear Stress", false, times, referenceTime );
+    addGroup( unsteadyGroup, "Face Velocity", "Velocity", false, times, referenceTime );
+    addGroup( summaryGroup, "Maximum Face Shear Stress", "Shear Stress/Maximums", false, dummyTimes, referenceTime );
+    addGroup( summaryGroup, "Maximum Face Velocity", "Velocity/Maximums", false, dummyTimes, referenceTime );
+  }
+  catch ( MDAL_Status error )
+  {
+    MDAL::Log::error( error, name(), "Error occurred while loading file " + resultsFile );
+    summary.reset();
+  }
+  catch ( MDAL::Error err )
+  {
+    MDAL::Log::error( err, name() );
+    summary.reset();
+  }
+
+  return summary;
+}
@@ -7,6 +7,8 @@
 #define MDAL_HEC2D_HPP
 
 #include <string>
+#include <vector>
+#include <memory>
 
 #include "mdal_data_model.hpp"
 #include "mdal_memory_data_model.hpp"
@@ -16,6 +18,81 @@
 
 namespace MDAL
 {
+  //! Results of a 2D flow area, stored in a HDF5 array [time x cells] or [time x faces]
+  struct Hec2DAreaValues
+  {
+    size_t elemStartIndex = 0; //!< index of the first mesh face of the flow area
+    size_t elemCount = 0; //!< count of mesh faces (cells) of the flow area
+    HdfDataset values;
+  };
+
+  //! Geometry of the faces of a 2D flow area, used to reconstruct the cell vectors from the face normal values
+  struct Hec2DAreaFaces
+  {
+    std::vector<int> cellFaceInfo; //!< first position and count of faces in cellFaceOrValues for each cell
+    std::vector<int> cellFaceOrValues; //!< face index and orientation
+    std::vector<int> facePointIndex; //!< 2 face points per face
+    std::vector<double> coords; //!< x, y of the face points
+  };
+
+  /**
+   * Scalar dataset on cells, each timestep is read from the results of the flow areas by hyperslab.
+   *
+   * Depth values equal to 0 and water surface values equal to the bed elevation are no-data
+   */
+  class Hec2DElementDataset: public Dataset2D
+  {
+    public:
+      enum NoDataRule
+      {
+        ZeroDepth,
+        BedElevation
+      };
+
+      Hec2DElementDataset( DatasetGroup *grp,
+                           std::shared_ptr<const std::vector<Hec2DAreaValues>> areas,
+                           hsize_t timeIndex,
+                           NoDataRule noDataRule,
+                           std::shared_ptr<MemoryDataset2D> bedElevation );
+      ~Hec2DElementDataset() override;
+
+      size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+      //! Reads the values of each area with one HDF5 read of the selected points
+      size_t scalarDataAt( const size_t *indices, size_t count, double *buffer ) override;
+
+    private:
+      //! Sets to NaN the \a value of the element \a index if it is no data according to the no data rule
+      double applyNoDataRule( size_t index, double value ) const;
+
+      std::shared_ptr<const std::vector<Hec2DAreaValues>> mAreas;
+      hsize_t mTimeIndex;
+      NoDataRule mNoDataRule;
+      std::shared_ptr<MemoryDataset2D> mBedElevation;
+  };
+
+  /**
+   * Vector dataset on cells reconstructed from the normal values on the faces of the cells (e.g. Face Velocity).
+   * Each timestep reads by hyperslab only the range of faces of the requested cells.
+   */
+  class Hec2DFaceDataset: public Dataset2D
+  {
+    public:
+      Hec2DFaceDataset( DatasetGroup *grp,
+                        std::shared_ptr<const std::vector<Hec2DAreaValues>> areas,
+                        std::shared_ptr<const std::vector<Hec2DAreaFaces>> areaFaces,
+                        hsize_t timeIndex );
+      ~Hec2DFaceDataset() override;
+
+      size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+
+    private:
+      std::shared_ptr<const std::vector<Hec2DAreaValues>> mAreas;
+      std::shared_ptr<const std::vector<Hec2DAreaFaces>> mAreaFaces;
+      hsize_t mTimeIndex;
+  };
+
   /**
    * HEC-RAS 2D format.
    *
@@ -34,6 +111,7 @@ namespace MDAL
    * All reference times can be found in Time Data Stamp dataset.
    * First value in the dataset is reported by MDAL as reference time
    *
+   * Only the mesh and the bed elevation are read in memory, the results are read by timestep when requested.
    */
   class DriverHec2D: public Driver
   {
@@ -44,6 +122,8 @@ namespace MDAL
 
       bool canReadMesh( const std::string &uri ) override;
       std::unique_ptr< Mesh > load( const std::string &resultsFile, const std::string &meshName = "" ) override;
+      //! Reads the counts from the dimensions of the arrays and the extent from the coordinates, without the cells and the values
+      std::unique_ptr< MeshSummary > loadSummary( const std::string &resultsFile, const std::string &meshName = "" ) override;
 
     private:
       std::unique_ptr< MDAL::MemoryMesh > mMesh;
@@ -61,10 +141,10 @@ namespace MDAL
       std::vector<std::string> read2DFlowAreasNames505( HdfGroup gGeom2DFlowAreas ) const;
 
       // Common functions
-      void readFaceOutput( const HdfFile &hdfFile,
-                           const HdfGroup &rootGroup,
+      void readFaceOutput( const HdfGroup &rootGroup,
                            const std::vector<size_t> &areaElemStartIndex,
                            const std::vector<std::string> &flowAreaNames,
+                           std::shared_ptr<const std::vector<Hec2DAreaFaces>> areaFaces,
                            const std::string rawDatasetName,
                            const std::string datasetName,
                            const std::vector<MDAL::RelativeTimestamp> &times,
@@ -74,13 +154,14 @@ namespace MDAL
                             const std::vector<size_t> &areaElemStartIndex,
                             const std::vector<std::string> &flowAreaNames );
 
-      std::shared_ptr<MDAL::MemoryDataset2D> readElemOutput(
+      void readElemOutput(
         const HdfGroup &rootGroup,
         const std::vector<size_t> &areaElemStartIndex,
         const std::vector<std::string> &flowAreaNames,
         const std::string rawDatasetName,
         const std::string datasetName,
         const std::vector<MDAL::RelativeTimestamp> &times,
+        Hec2DElementDataset::NoDataRule noDataRule,
         std::shared_ptr<MDAL::MemoryDataset2D> bed_elevation,
         const DateTime &referenceTime );
 
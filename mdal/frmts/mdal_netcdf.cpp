@@ -8,16 +8,156 @@
 #include <assert.h>
 #include <netcdf.h>
 #include <cmath>
+#include <mutex>
+#include <list>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+#include <cstddef>
+#include <atomic>
 
 #include "mdal_netcdf.hpp"
 #include "mdal.h"
 #include "mdal_utils.hpp"
 #include "mdal_logger.hpp"
 
+static std::recursive_mutex &netCDFMutex()
+{
+  static std::recursive_mutex sMutex;
+  return sMutex;
+}
+
+NetCDFLock::NetCDFLock() { netCDFMutex().lock(); }
+
+NetCDFLock::~NetCDFLock() { netCDFMutex().unlock(); }
+
+// default budget of the block cache shared by all the files
+static const size_t DEFAULT_BLOCK_CACHE_SIZE = 64 * 1024 * 1024;
+// minimum count of values of a cached block, for contiguous variables or small chunks
+static const size_t MIN_BLOCK_VALUES = 1 << 16;
+// reads of less than 1/SMALL_READ_RATIO of a block are not cached
+static const size_t SMALL_READ_RATIO = 64;
+
+static std::atomic<size_t> sTimestepValuesReadCount( 0 );
+
+namespace
+{
+  //! Least recently used cache of the blocks of timestep values read by NetCDFFile::readTimestepDoubleArr()
+  class BlockCache
+  {
+    public:
+      struct Key
+      {
+        const NetCDFFile *file;
+        int varId;
+        size_t timestep;
+        size_t block;
+
+        bool operator<( const Key &other ) const
+        {
+          return std::tie( file, varId, timestep, block ) < std::tie( other.file, other.varId, other.timestep, other.block );
+        }
+      };
+      typedef std::shared_ptr<const std::vector<double>> Block;
+
+      //! Returns the block of the key and marks it as most recently used, or nullptr if not cached
+      Block get( const Key &key )
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        auto it = mIndex.find( key );
+        if ( it == mIndex.end() )
+          return Block();
+        mBlocks.splice( mBlocks.begin(), mBlocks, it->second );
+        return it->second->second;
+      }
+
+      void insert( const Key &key, Block block )
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        if ( mMaximumSize == 0 || mIndex.find( key ) != mIndex.end() )
+          return; // disabled or read in the meantime by another thread
+        mBlocks.emplace_front( key, block );
+        mIndex[key] = mBlocks.begin();
+        mSize += block->size() * sizeof( double );
+
+        // always keep the last block, even if larger than the budget
+        evict( 1 );
+      }
+
+      //! Sets the budget of the cache, the least recently used blocks are removed to fit in it
+      void setMaximumSize( size_t bytes )
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        mMaximumSize = bytes;
+        evict( bytes == 0 ? 0 : 1 );
+      }
+
+      size_t maximumSize()
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        return mMaximumSize;
+      }
+
+      size_t size()
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        return mSize;
+      }
+
+      //! Removes the blocks of the \a file, when it is closed
+      void removeFile( const NetCDFFile *file )
+      {
+        std::lock_guard<std::mutex> lock( mMutex );
+        auto it = mIndex.lower_bound( Key{file, std::numeric_limits<int>::min(), 0, 0} );
+        while ( it != mIndex.end() && it->first.file == file )
+        {
+          auto blockIt = it->second;
+          ++it;
+          erase( blockIt );
+        }
+      }
+
+    private:
+      typedef std::list<std::pair<Key, Block>> Blocks;
+
+      //! Removes the least recently used blocks while over the budget, keeping at least \a keptCount blocks
+      void evict( size_t keptCount )
+      {
+        while ( mSize > mMaximumSize && mBlocks.size() > keptCount )
+          erase( std::prev( mBlocks.end() ) );
+      }
+
+      void erase( Blocks::iterator it )
+      {
+        mSize -= it->second->size() * sizeof( double );
+        mIndex.erase( it->first );
+        mBlocks.erase( it );
+      }
+
+      std::mutex mMutex;
+      Blocks mBlocks; // most recently used first
+      std::map<Key, Blocks::iterator> mIndex;
+      size_t mSize = 0;
+      size_t mMaximumSize = DEFAULT_BLOCK_CACHE_SIZE;
+  };
+}
+
+static BlockCache &blockCache()
+{
+  static BlockCache sBlockCache;
+  return sBlockCache;
+}
+
 NetCDFFile::NetCDFFile(): mNcid( 0 ) {}
 
 NetCDFFile::~NetCDFFile()
 {
+  blockCache().removeFile( this );
+
+  NetCDFLock lock;
   if ( mNcid != 0 )
   {
     nc_close( mNcid );
@@ -32,6 +172,7 @@ int NetCDFFile::handle() const
 
 void NetCDFFile::openFile( const std::string &fileName )
 {
+  NetCDFLock lock;
   int res = nc_open( fileName.c_str(), NC_NOWRITE, &mNcid );
   if ( res != NC_NOERR )
   {
@@ -43,6 +184,7 @@ void NetCDFFile::openFile( const std::string &fileName )
 std::vector<int> NetCDFFile::readIntArr( const std::string &name, size_t dim ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
   int arr_id;
   if ( nc_inq_varid( mNcid, name.c_str(), &arr_id ) != NC_NOERR ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Internal error in Netcfd - unknown format" );
   std::vector<int> arr_val( dim );
@@ -53,6 +195,7 @@ std::vector<int> NetCDFFile::readIntArr( const std::string &name, size_t dim ) c
 std::vector<int> NetCDFFile::readIntArr( int arr_id, size_t start_dim1, size_t start_dim2, size_t count_dim1, size_t count_dim2 ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
 
   const std::vector<size_t> startp = {start_dim1, start_dim2};
   const std::vector<size_t> countp = {count_dim1, count_dim2};
@@ -67,6 +210,7 @@ std::vector<int> NetCDFFile::readIntArr( int arr_id, size_t start_dim1, size_t s
 std::vector<int> NetCDFFile::readIntArr( int arr_id, size_t start_dim, size_t count_dim ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
 
   const std::vector<size_t> startp = {start_dim};
   const std::vector<size_t> countp = {count_dim};
@@ -81,6 +225,7 @@ std::vector<int> NetCDFFile::readIntArr( int arr_id, size_t start_dim, size_t co
 std::vector<double> NetCDFFile::readDoubleArr( const std::string &name, size_t dim ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
 
   int arr_id;
   if ( nc_inq_varid( mNcid, name.c_str(), &arr_id ) != NC_NOERR ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Could not read double array" );
@@ -119,6 +264,7 @@ std::vector<double> NetCDFFile::readDoubleArr( int arr_id,
     size_t count_dim1, size_t count_dim2 ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
 
   const std::vector<size_t> startp = {start_dim1, start_dim2};
   const std::vector<size_t> countp = {count_dim1, count_dim2};
@@ -172,6 +318,7 @@ std::vector<double> NetCDFFile::readDoubleArr( int arr_id,
                                              ) const
 {
   assert( mNcid != 0 );
+  NetCDFLock lock;
 
   const std::vector<size_t> startp = {start_dim};
   const std::vector<size_t> countp = {count_dim};
@@ -206,8 +353,266 @@ std::vector<double> NetCDFFile::readDoubleArr( int arr_id,
   return arr_val;
 }
 
+size_t NetCDFFile::blockValuesCount( int arr_id, TimeLayout layout ) const
+{
+  NetCDFLock lock;
+
+  size_t chunkValues = 1;
+  int ndims = 0;
+  if ( nc_inq_varndims( mNcid, arr_id, &ndims ) == NC_NOERR && ndims > 0 && ndims <= NC_MAX_VAR_DIMS )
+  {
+    std::vector<size_t> chunkSizes( static_cast<size_t>( ndims ) );
+    int storage = NC_CONTIGUOUS;
+    size_t valuesDim = layout == TimeDimensionFirst ? 1 : 0;
+    if ( nc_inq_var_chunking( mNcid, arr_id, &storage, chunkSizes.data() ) == NC_NOERR &&
+         storage == NC_CHUNKED &&
+         valuesDim < chunkSizes.size() &&
+         chunkSizes[valuesDim] > 0 )
+      chunkValues = chunkSizes[valuesDim];
+  }
+
+  // whole chunks along the values dimension
+  return ( ( MIN_BLOCK_VALUES + chunkValues - 1 ) / chunkValues ) * chunkValues;
+}
+
+/**
+ * Converts the \a count \a raw values to double in \a buffer, values equal to \a fillValue
+ * are set to NaN, others are unpacked with \a scale and \a offset
+ */
+template <typename T>
+static void decodeValues( const T *raw, size_t count, double fillValue, double scale, double offset, double *buffer )
+{
+  const bool unpack = scale != 1.0 || offset != 0.0;
+  for ( size_t i = 0; i < count; ++i )
+  {
+    double val = MDAL::safeValue( static_cast<double>( raw[i] ), fillValue );
+    buffer[i] = unpack ? val * scale + offset : val;
+  }
+}
+
+//! Returns \a scratch resized to hold \a count values of type \a T
+template <typename T>
+static T *scratchValues( std::vector<unsigned char> &scratch, size_t count )
+{
+  if ( scratch.size() < count * sizeof( T ) )
+    scratch.resize( count * sizeof( T ) );
+  return reinterpret_cast<T *>( scratch.data() );
+}
+
+void NetCDFFile::readDecodedDoubleArr( int arr_id, size_t ndims, const size_t *startp, const size_t *countp, double fillValue, double *buffer ) const
+{
+  assert( mNcid != 0 );
+  NetCDFLock lock;
+
+  // buffer for the values in their storage type, reused by all the reads, protected by the netCDF mutex
+  static std::vector<unsigned char> sScratch;
+
+  size_t count = 1;
+  for ( size_t i = 0; i < ndims; ++i )
+    count *= countp[i];
+
+  nc_type typep;
+  if ( nc_inq_vartype( mNcid, arr_id, &typep ) != NC_NOERR ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Could not read double array" );
+
+  // CF packed data
+  double scale = getAttrDouble( arr_id, "scale_factor" );
+  if ( std::isnan( scale ) )
+    scale = 1.0;
+  double offset = getAttrDouble( arr_id, "add_offset" );
+  if ( std::isnan( offset ) )
+    offset = 0.0;
+
+  const std::vector<ptrdiff_t> stridep( ndims, 1 );
+  bool ok = false;
+  switch ( typep )
+  {
+    case NC_DOUBLE:
+    {
+      // read in place
+      ok = nc_get_vars_double( mNcid, arr_id, startp, countp, stridep.data(), buffer ) == NC_NOERR;
+      if ( ok )
+        decodeValues( buffer, count, fillValue, scale, offset, buffer );
+      break;
+    }
+    case NC_FLOAT:
+    {
+      float *raw = scratchValues<float>( sScratch, count );
+      ok = nc_get_vars_float( mNcid, arr_id, startp, countp, stridep.data(), raw ) == NC_NOERR;
+      if ( ok )
+        decodeValues( raw, count, fillValue, scale, offset, buffer );
+      break;
+    }
+    case NC_INT:
+    {
+      int *raw = scratchValues<int>( sScratch, count );
+      ok = nc_get_vars_int( mNcid, arr_id, startp, countp, stridep.data(), raw ) == NC_NOERR;
+      if ( ok )
+        decodeValues( raw, count, fillValue, scale, offset, buffer );
+      break;
+    }
+    case NC_SHORT:
+    {
+      short *raw = scratchValues<short>( sScratch, count );
+      ok = nc_get_vars_short( mNcid, arr_id, startp, countp, stridep.data(), raw ) == NC_NOERR;
+      if ( ok )
+        decodeValues( raw, count, fillValue, scale, offset, buffer );
+      break;
+    }
+    case NC_BYTE:
+    {
+      unsigned char *raw = scratchValues<unsigned char>( sScratch, count );
+      ok = nc_get_vars_uchar( mNcid, arr_id, startp, countp, stridep.data(), raw ) == NC_NOERR;
+      if ( ok )
+      {
+        decodeValues( raw, count, fillValue, scale, offset, buffer );
+        for ( size_t i = 0; i < count; ++i )
+        {
+          if ( raw[i] == 129 ) // same no data value as readDoubleArr()
+            buffer[i] = std::numeric_limits<double>::quiet_NaN();
+        }
+      }
+      break;
+    }
+    default:
+    {
+      // other numeric types, e.g. unsigned or 64 bits integers, converted by the library
+      ok = nc_get_vars_double( mNcid, arr_id, startp, countp, stridep.data(), buffer ) == NC_NOERR;
+      if ( ok )
+        decodeValues( buffer, count, fillValue, scale, offset, buffer );
+      break;
+    }
+  }
+
+  if ( !ok )
+    throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Could not read double array" );
+}
+
+void NetCDFFile::readTimestepValues( int arr_id, TimeLayout layout, size_t ts, double fillValue, size_t start, size_t count, double *buffer ) const
+{
+  switch ( layout )
+  {
+    case NoTimeDimension:
+    {
+      const size_t startp[1] = {start};
+      const size_t countp[1] = {count};
+      readDecodedDoubleArr( arr_id, 1, startp, countp, fillValue, buffer );
+      break;
+    }
+    case TimeDimensionFirst:
+    {
+      const size_t startp[2] = {ts, start};
+      const size_t countp[2] = {1, count};
+      readDecodedDoubleArr( arr_id, 2, startp, countp, fillValue, buffer );
+      break;
+    }
+    case TimeDimensionLast:
+    {
+      const size_t startp[2] = {start, ts};
+      const size_t countp[2] = {count, 1};
+      readDecodedDoubleArr( arr_id, 2, startp, countp, fillValue, buffer );
+      break;
+    }
+  }
+  sTimestepValuesReadCount += count;
+}
+
+void NetCDFFile::readTimestepDoubleArr( int arr_id,
+                                        TimeLayout layout,
+                                        size_t ts,
+                                        size_t valuesCount,
+                                        double fillValue,
+                                        size_t start,
+                                        size_t count,
+                                        double *buffer ) const
+{
+  assert( mNcid != 0 );
+  assert( start + count <= valuesCount );
+
+  const size_t blockValues = blockValuesCount( arr_id, layout );
+  // small reads or disabled cache, the values are read directly
+  const bool directRead = count * SMALL_READ_RATIO < blockValues || blockCache().maximumSize() == 0;
+  const size_t end = start + count;
+  for ( size_t block = start / blockValues; block * blockValues < end; ++block )
+  {
+    const size_t blockStart = block * blockValues;
+    const size_t blockCount = std::min( blockValues, valuesCount - blockStart );
+    const size_t copyStart = std::max( start, blockStart );
+    const size_t copyEnd = std::min( end, blockStart + blockCount );
+    if ( copyStart >= copyEnd )
+      continue;
+
+    const BlockCache::Key key{this, arr_id, ts, block};
+    BlockCache::Block values = blockCache().get( key );
+    if ( !values )
+    {
+      if ( directRead )
+      {
+        readTimestepValues( arr_id, layout, ts, fillValue, copyStart, copyEnd - copyStart, buffer + ( copyStart - start ) );
+        continue;
+      }
+
+      std::shared_ptr<std::vector<double>> blockValuesArr = std::make_shared<std::vector<double>>( blockCount );
+      readTimestepValues( arr_id, layout, ts, fillValue, blockStart, blockCount, blockValuesArr->data() );
+      values = blockValuesArr;
+      blockCache().insert( key, values );
+    }
+
+    std::copy( values->begin() + static_cast<std::ptrdiff_t>( copyStart - blockStart ),
+               values->begin() + static_cast<std::ptrdiff_t>( copyEnd - blockStart ),
+               buffer + ( copyStart - start ) );
+  }
+}
+
+void NetCDFFile::readTimestepDoubleValuesAt( int arr_id,
+    TimeLayout layout,
+    size_t ts,
+    double fillValue,
+    const size_t *indices,
+    size_t count,
+    double *buffer ) const
+{
+  assert( mNcid != 0 );
+  if ( count == 0 )
+    return;
+
+  // locked once for all the values
+  NetCDFLock lock;
+  const size_t blockValues = blockValuesCount( arr_id, layout );
+  for ( size_t i = 0; i < count; ++i )
+  {
+    const size_t block = indices[i] / blockValues;
+    BlockCache::Block values = blockCache().get( BlockCache::Key{this, arr_id, ts, block} );
+    const size_t indexInBlock = indices[i] - block * blockValues;
+    if ( values && indexInBlock < values->size() )
+      buffer[i] = ( *values )[indexInBlock];
+    else
+      readTimestepValues( arr_id, layout, ts, fillValue, indices[i], 1, buffer + i );
+  }
+}
+
+size_t NetCDFFile::timestepValuesReadCount()
+{
+  return sTimestepValuesReadCount;
+}
+
+void NetCDFFile::setBlockCacheSize( size_t bytes )
+{
+  blockCache().setMaximumSize( bytes );
+}
+
+size_t NetCDFFile::blockCacheSize()
+{
+  return blockCache().maximumSize();
+}
+
+size_t NetCDFFile::blockCacheUsage()
+{
+  return blockCache().size();
+}
+
 bool NetCDFFile::hasArr( const std::string &name ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
   int arr_id;
   return nc_inq_varid( mNcid, name.c_str(), &arr_id ) == NC_NOERR;
@@ -215,6 +620,7 @@ bool NetCDFFile::hasArr( const std::string &name ) const
 
 int NetCDFFile::arrId( const std::string &name ) const
 {
+  NetCDFLock lock;
   int arr_id = -1;
   if ( nc_inq_varid( mNcid, name.c_str(), &arr_id ) != NC_NOERR )
   {
@@ -225,6 +631,7 @@ int NetCDFFile::arrId( const std::string &name ) const
 
 std::vector<std::string> NetCDFFile::readArrNames() const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   std::vector<std::string> res;
@@ -246,6 +653,7 @@ std::vector<std::string> NetCDFFile::readArrNames() const
 
 bool NetCDFFile::hasAttrInt( const std::string &name, const std::string &attr_name ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   int arr_id;
@@ -259,6 +667,7 @@ bool NetCDFFile::hasAttrInt( const std::string &name, const std::string &attr_na
 
 int NetCDFFile::getAttrInt( const std::string &name, const std::string &attr_name ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   int arr_id;
@@ -271,6 +680,7 @@ int NetCDFFile::getAttrInt( const std::string &name, const std::string &attr_nam
 
 std::string NetCDFFile::getAttrStr( const std::string &name, const std::string &attr_name ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   int arr_id;
@@ -280,6 +690,7 @@ std::string NetCDFFile::getAttrStr( const std::string &name, const std::string &
 
 std::string NetCDFFile::getAttrStr( const std::string &attr_name, int varid ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   size_t attlen = 0;
@@ -308,6 +719,7 @@ double NetCDFFile::getFillValue( int varid ) const
 
 bool NetCDFFile::hasAttrDouble( int varid, const std::string &attr_name ) const
 {
+  NetCDFLock lock;
   double res;
   if ( nc_get_att_double( mNcid, varid, attr_name.c_str(), &res ) )
     return false;
@@ -316,15 +728,63 @@ bool NetCDFFile::hasAttrDouble( int varid, const std::string &attr_name ) const
 
 double NetCDFFile::getAttrDouble( int varid, const std::string &attr_name ) const
 {
+  NetCDFLock lock;
   double res;
   if ( nc_get_att_double( mNcid, varid, attr_name.c_str(), &res ) )
     res = std::numeric_limits<double>::quiet_NaN(); // not present/set
   return res;
 }
 
+bool NetCDFFile::getAttrDoubleRange( int varid, const std::string &attr_name, double &minimum, double &maximum ) const
+{
+  NetCDFLock lock;
+  size_t len;
+  if ( nc_inq_attlen( mNcid, varid, attr_name.c_str(), &len ) != NC_NOERR || len != 2 )
+    return false;
+
+  double range[2];
+  if ( nc_get_att_double( mNcid, varid, attr_name.c_str(), range ) != NC_NOERR )
+    return false;
+
+  minimum = range[0];
+  maximum = range[1];
+  return true;
+}
+
+bool NetCDFFile::getActualRange( int varid, double &minimum, double &maximum ) const
+{
+  NetCDFLock lock;
+  if ( !getAttrDoubleRange( varid, "actual_range", minimum, maximum ) )
+    return false;
+
+  // CF packed data: the range is of the unpacked values, with the type of scale_factor and add_offset,
+  // but some files give the range of the packed values, with the type of the variable
+  nc_type varType;
+  nc_type rangeType;
+  if ( nc_inq_vartype( mNcid, varid, &varType ) != NC_NOERR ||
+       nc_inq_atttype( mNcid, varid, "actual_range", &rangeType ) != NC_NOERR )
+    return false;
+
+  if ( rangeType == varType && varType != NC_FLOAT && varType != NC_DOUBLE )
+  {
+    double scale = getAttrDouble( varid, "scale_factor" );
+    if ( std::isnan( scale ) )
+      scale = 1.0;
+    double offset = getAttrDouble( varid, "add_offset" );
+    if ( std::isnan( offset ) )
+      offset = 0.0;
+
+    minimum = minimum * scale + offset;
+    maximum = maximum * scale + offset;
+    if ( scale < 0 )
+      std::swap( minimum, maximum );
+  }
+  return true;
+}
 
 int NetCDFFile::getVarId( const std::string &name )
 {
+  NetCDFLock lock;
   int ncid_val;
   if ( nc_inq_varid( mNcid, name.c_str(), &ncid_val ) != NC_NOERR ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Could not get variable id" );
   return ncid_val;
@@ -332,6 +792,7 @@ int NetCDFFile::getVarId( const std::string &name )
 
 void NetCDFFile::getDimension( const std::string &name, size_t *val, int *ncid_val ) const
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   if ( nc_inq_dimid( mNcid, name.c_str(), ncid_val ) != NC_NOERR ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Could not get dimension, invalid dimension ID or name" );
@@ -340,6 +801,7 @@ void NetCDFFile::getDimension( const std::string &name, size_t *val, int *ncid_v
 
 void NetCDFFile::getDimensions( const std::string &variableName, std::vector<size_t> &dimensions, std::vector<int> &dimensionIds )
 {
+  NetCDFLock lock;
   assert( mNcid != 0 );
 
   int n;
@@ -360,12 +822,14 @@ void NetCDFFile::getDimensions( const std::string &variableName, std::vector<siz
 
 bool NetCDFFile::hasDimension( const std::string &name ) const
 {
+  NetCDFLock lock;
   int ncid_val;
   return nc_inq_dimid( mNcid, name.c_str(), &ncid_val ) == NC_NOERR;
 }
 
 void NetCDFFile::createFile( const std::string &fileName )
 {
+  NetCDFLock lock;
   int res = nc_create( fileName.c_str(), NC_CLOBBER, &mNcid );
   if ( res != NC_NOERR )
   {
@@ -375,6 +839,7 @@ void NetCDFFile::createFile( const std::string &fileName )
 
 int NetCDFFile::defineDimension( const std::string &name, size_t size )
 {
+  NetCDFLock lock;
   int dimId = 0;
   int res = nc_def_dim( mNcid, name.c_str(), size, &dimId );
   if ( res != NC_NOERR )
@@ -387,6 +852,7 @@ int NetCDFFile::defineDimension( const std::string &name, size_t size )
 int NetCDFFile::defineVar( const std::string &varName,
                            int ncType, int dimensionCount, const int *dimensions )
 {
+  NetCDFLock lock;
   int varIdp;
 
   int res = nc_def_var( mNcid, varName.c_str(), ncType, dimensionCount, dimensions, &varIdp );
@@ -400,6 +866,7 @@ int NetCDFFile::defineVar( const std::string &varName,
 
 void NetCDFFile::putAttrStr( int varId, const std::string &attrName, const std::string &value )
 {
+  NetCDFLock lock;
   int res = nc_put_att_text( mNcid, varId, attrName.c_str(), value.size(), value.c_str() );
   if ( res != NC_NOERR )
   {
@@ -409,6 +876,7 @@ void NetCDFFile::putAttrStr( int varId, const std::string &attrName, const std::
 
 void NetCDFFile::putAttrInt( int varId, const std::string &attrName, int value )
 {
+  NetCDFLock lock;
   int res = nc_put_att_int( mNcid, varId, attrName.c_str(), NC_INT, 1, &value );
   if ( res != NC_NOERR )
   {
@@ -418,6 +886,7 @@ void NetCDFFile::putAttrInt( int varId, const std::string &attrName, int value )
 
 void NetCDFFile::putAttrDouble( int varId, const std::string &attrName, double value )
 {
+  NetCDFLock lock;
   int res = nc_put_att_double( mNcid, varId, attrName.c_str(), NC_DOUBLE, 1, &value );
   if ( res != NC_NOERR )
   {
@@ -427,6 +896,7 @@ void NetCDFFile::putAttrDouble( int varId, const std::string &attrName, double v
 
 void NetCDFFile::putDataDouble( int varId, const size_t index, const double value )
 {
+  NetCDFLock lock;
   int res = nc_put_var1_double( mNcid, varId, &index, &value );
   if ( res != NC_NOERR )
   {
@@ -436,6 +906,7 @@ void NetCDFFile::putDataDouble( int varId, const size_t index, const double valu
 
 void NetCDFFile::putDataArrayInt( int varId, size_t line, size_t faceVerticesMax, int *values )
 {
+  NetCDFLock lock;
   // Configuration of these two vectors determines how is value array read and stored in the file
   // https://www.unidata.ucar.edu/software/netcdf/docs/programming_notes.html#specify_hyperslabfileNameToSave
   const size_t start[] = { line, 0 };
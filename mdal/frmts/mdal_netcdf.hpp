@@ -9,11 +9,34 @@
 #include <string>
 #include <vector>
 
+/**
+ * Serializes the calls to the netCDF C library, which is not thread safe, so files can be opened
+ * and datasets read from different threads. Every wrapper calling the library takes it, as must
+ * the drivers calling the library directly with handle(). Locks can be nested in the same thread.
+ */
+class NetCDFLock
+{
+  public:
+    NetCDFLock();
+    ~NetCDFLock();
+
+  private:
+    NetCDFLock( const NetCDFLock & ) = delete;
+    NetCDFLock &operator=( const NetCDFLock & ) = delete;
+};
 
 //! C++ Wrapper around netcdf C library
 class NetCDFFile
 {
   public:
+    //! Position of the time dimension of a variable read by timestep, see readTimestepDoubleArr()
+    enum TimeLayout
+    {
+      NoTimeDimension = 0, //!< e.g. float TEMP(Cell)
+      TimeDimensionFirst, //!< e.g. float TEMP(Time, Cells)
+      TimeDimensionLast, //!< e.g. float TEMP(Cells, Time)
+    };
+
     //! Create file with invalid handle
     NetCDFFile();
     //! Closes the file
@@ -53,6 +76,53 @@ class NetCDFFile
                                        size_t count_dim
                                      ) const;
 
+    /**
+     * Reads \a count values from \a start of the timestep \a ts of the variable \a arr_id, with \a valuesCount values
+     * per timestep, into \a buffer.
+     *
+     * The values are read by blocks aligned on the chunks of the variable and kept in a cache shared by all the files,
+     * so reading a timestep in several calls decompresses each chunk once. The least recently used blocks are evicted
+     * when the cache exceeds its budget.
+     *
+     * Values are read in their storage type and decoded once: values equal to \a fillValue are set to NaN,
+     * then the scale_factor and add_offset attributes of the variable are applied.
+     *
+     * Reads much smaller than a block, e.g. values read one by one, only read the requested values and do not
+     * load their block in the cache, where they would evict the blocks of the other reads.
+     */
+    void readTimestepDoubleArr( int arr_id,
+                                TimeLayout layout,
+                                size_t ts,
+                                size_t valuesCount,
+                                double fillValue,
+                                size_t start,
+                                size_t count,
+                                double *buffer ) const;
+
+    /**
+     * Reads the values at the \a count \a indices of the timestep \a ts of the variable \a arr_id into \a buffer,
+     * decoded as by readTimestepDoubleArr(). The indices must be lower than the count of values per timestep.
+     *
+     * Each value is read alone without going through the block cache, so sparse reads such as time series
+     * do not evict the cached blocks. Values of blocks already cached are taken from the cache.
+     */
+    void readTimestepDoubleValuesAt( int arr_id,
+                                     TimeLayout layout,
+                                     size_t ts,
+                                     double fillValue,
+                                     const size_t *indices,
+                                     size_t count,
+                                     double *buffer ) const;
+
+    //! Returns the count of values read from the files by readTimestepDoubleArr() and readTimestepDoubleValuesAt() since the start, for diagnostics
+    static size_t timestepValuesReadCount();
+
+    //! Sets the maximum size in bytes of the blocks cached by readTimestepDoubleArr() for all the files, see MDAL_SetNetCDFBlockCacheSize()
+    static void setBlockCacheSize( size_t bytes );
+    static size_t blockCacheSize();
+    //! Returns the size in bytes of the blocks currently cached, for diagnostics
+    static size_t blockCacheUsage();
+
     bool hasArr( const std::string &name ) const;
     int arrId( const std::string &name ) const;
 
@@ -62,6 +132,13 @@ class NetCDFFile
     int getAttrInt( const std::string &name, const std::string &attr_name ) const;
     bool hasAttrDouble( int varid, const std::string &attr_name ) const;
     double getAttrDouble( int varid, const std::string &attr_name ) const;
+    //! Sets \a minimum and \a maximum with the 2 values of the attribute, returns false if the attribute has not 2 values
+    bool getAttrDoubleRange( int varid, const std::string &attr_name, double &minimum, double &maximum ) const;
+    /**
+     * Sets \a minimum and \a maximum with the actual_range attribute of the variable, returns false if it has not 2 values.
+     * A range given in the type of packed values is unpacked with scale_factor and add_offset
+     */
+    bool getActualRange( int varid, double &minimum, double &maximum ) const;
     /**
      * Get string attribute
      * \param name name of the variable
@@ -89,6 +166,18 @@ class NetCDFFile
     std::string getFileName() const;
 
   private:
+    //! Returns the count of values of the blocks of the variable \a arr_id cached by readTimestepDoubleArr()
+    size_t blockValuesCount( int arr_id, TimeLayout layout ) const;
+
+    //! Reads and decodes from the file the \a count values from \a start of the timestep \a ts of the variable \a arr_id, without cache
+    void readTimestepValues( int arr_id, TimeLayout layout, size_t ts, double fillValue, size_t start, size_t count, double *buffer ) const;
+
+    /**
+     * Reads the hyperslab of the variable \a arr_id with \a ndims dimensions in its storage type and decodes it in \a buffer,
+     * see readTimestepDoubleArr()
+     */
+    void readDecodedDoubleArr( int arr_id, size_t ndims, const size_t *startp, const size_t *countp, double fillValue, double *buffer ) const;
+
     int mNcid; // C handle to the file
     std::string mFileName;
 };
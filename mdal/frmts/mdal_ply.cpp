@@ -176,10 +176,11 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverPly::load( const std::string &meshFile,
   while ( true );
 
   Vertices vertices( 0 );
-  Faces faces( 0 );
+  Faces faces;
   Edges edges( 0 );
   size_t maxSizeFace = 0;
   size_t faceSize = 0;
+  Face face;
 
   //datastructures that will contain all of the datasets, categorised by vertex, face and edge datasets
   std::vector<std::vector<double>> vertexDatasets; // conatins the data
@@ -223,7 +224,7 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverPly::load( const std::string &meshFile,
     else if ( element.name == "face" )
     {
       faceCount = element.size;
-      faces.resize( faceCount );
+      faces.reserve( faceCount, 3 * faceCount );
       for ( size_t i = 0; i < element.properties.size(); ++i )
       {
         if ( element.properties[i] != "vertex_indices" &&
@@ -286,12 +287,12 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverPly::load( const std::string &meshFile,
       else if ( element.name == "face" )
       {
         faceSize = MDAL::toSizeT( chunks[0] );
-        Face &face = faces[i];
         face.resize( faceSize );
         for ( size_t j = 0; j < faceSize; ++j )
         {
           face[j] = MDAL::toSizeT( chunks[j + 1] );
         }
+        faces.addFace( face );
         if ( faceSize > maxSizeFace ) maxSizeFace = faceSize;
         for ( size_t j = 0; j < fProp2Ds.size(); ++j )
         {
@@ -398,7 +399,6 @@ std::shared_ptr< MDAL::DatasetGroup> MDAL::DriverPly::addDatasetGroup( MDAL::Mes
   std::shared_ptr< DatasetGroup > group = std::make_shared< DatasetGroup >( mesh->driverName(), mesh, name, name );
   group->setDataLocation( location );
   group->setIsScalar( isScalar );
-  group->setStatistics( MDAL::calculateStatistics( group ) );
   mesh->datasetGroups.push_back( group );
   return group;
 }
@@ -438,7 +438,5 @@ void MDAL::DriverPly::addDataset( MDAL::DatasetGroup *group, const std::vector<d
   std::shared_ptr< MDAL::MemoryDataset2D > dataset = std::make_shared< MemoryDataset2D >( group );
   dataset->setTime( 0.0 );
   memcpy( dataset->values(), values.data(), sizeof( double ) * values.size() );
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   group->datasets.push_back( dataset );
-  group->setStatistics( MDAL::calculateStatistics( group ) );
 }
@@ -31,6 +31,7 @@
 
 MDAL::SelafinFile::SelafinFile( const std::string &fileName ):
   mFileName( fileName )
+  , mStreams( fileName )
 {}
 
 void MDAL::SelafinFile::initialize()
@@ -40,6 +41,7 @@ void MDAL::SelafinFile::initialize()
     throw MDAL::Error( MDAL_Status::Err_FileNotFound, "Did not find file " + mFileName );
   }
 
+  mStreams.clear();
   mIn = std::ifstream( mFileName, std::ifstream::in | std::ifstream::binary );
   if ( !mIn )
     throw MDAL::Error( MDAL_Status::Err_FileNotFound, "File " + mFileName + " could not be open" ); // Couldn't open the file
@@ -295,14 +297,40 @@ size_t MDAL::SelafinFile::verticesPerFace()
 
 std::vector<double> MDAL::SelafinFile::datasetValues( size_t timeStepIndex, size_t variableIndex, size_t offset, size_t count )
 {
-  if ( !mParsed )
-    parseFile();
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    if ( !mParsed )
+      parseFile();
+  }
   if ( variableIndex < mVariableStreamPosition.size() &&  timeStepIndex < mVariableStreamPosition[variableIndex].size() )
     return readDoubleArr( mVariableStreamPosition[variableIndex][timeStepIndex], offset, count );
   else
     return std::vector<double>();
 }
 
+size_t MDAL::SelafinFile::datasetValuesAt( size_t timeStepIndex, size_t variableIndex, const size_t *indices, size_t count, double *buffer )
+{
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    if ( !mParsed )
+      parseFile();
+  }
+  if ( variableIndex >= mVariableStreamPosition.size() ||  timeStepIndex >= mVariableStreamPosition[variableIndex].size() )
+    return 0;
+
+  const std::streampos position = mVariableStreamPosition[variableIndex][timeStepIndex];
+  const size_t valueSize = mStreamInFloatPrecision ? 4 : 8;
+  StreamPool::Stream stream = mStreams.acquire();
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( indices[i] >= mVerticesCount )
+      return i;
+    stream->seekg( position + static_cast<std::streamoff>( indices[i] * valueSize ) );
+    readDoubles( *stream, buffer + i, 1 );
+  }
+  return count;
+}
+
 void MDAL::SelafinFile::populateDataset( MDAL::Mesh *mesh, std::shared_ptr<MDAL::SelafinFile> reader )
 {
   std::map<std::string, std::shared_ptr<DatasetGroup>> groupsByName;
@@ -398,19 +426,6 @@ void MDAL::SelafinFile::populateDataset( MDAL::Mesh *mesh, std::shared_ptr<MDAL:
     }
   }
 
-  // now calculate statistics
-  for ( const std::shared_ptr<DatasetGroup> &group : groupsInOrder )
-  {
-    for ( const std::shared_ptr<Dataset> &dataset : group->datasets )
-    {
-      MDAL::Statistics stats = MDAL::calculateStatistics( dataset );
-      dataset->setStatistics( stats );
-    }
-
-    MDAL::Statistics stats = MDAL::calculateStatistics( group );
-    group->setStatistics( stats );
-  }
-
   // As everything seems to be ok (no exception thrown), push the groups in the mesh
   for ( const std::shared_ptr<DatasetGroup> &group : groupsInOrder )
     mesh->datasetGroups.push_back( group );
@@ -439,10 +454,7 @@ std::vector<double> MDAL::SelafinFile::readDoubleArr( size_t len )
       throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "File format problem while reading double array" );
   }
   std::vector<double> ret( len );
-  for ( size_t i = 0; i < len; ++i )
-  {
-    ret[i] = readDouble();
-  }
+  readDoubles( mIn, ret.data(), len );
   ignoreArrayLength();
   return ret;
 }
@@ -456,9 +468,9 @@ std::vector<double> MDAL::SelafinFile::readDoubleArr( const std::streampos &posi
   else
     off = offset * 8;
 
-  mIn.seekg( position + off );
-  for ( size_t i = 0; i < len; ++i )
-    ret[i] = readDouble();
+  StreamPool::Stream stream = mStreams.acquire();
+  stream->seekg( position + off );
+  readDoubles( *stream, ret.data(), len );
 
   return ret;
 }
@@ -468,10 +480,7 @@ std::vector<int> MDAL::SelafinFile::readIntArr( size_t len )
   size_t length = readSizeT();
   if ( length != len * 4 ) throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "File format problem while reading int array" );
   std::vector<int> ret( len );
-  for ( size_t i = 0; i < len; ++i )
-  {
-    ret[i] = readInt();
-  }
+  readInts( mIn, ret.data(), len );
   ignoreArrayLength();
   return ret;
 }
@@ -481,9 +490,9 @@ std::vector<int> MDAL::SelafinFile::readIntArr( const std::streampos &position,
   std::vector<int> ret( len );
   std::streamoff off = offset * 4;
 
-  mIn.seekg( position + off );
-  for ( size_t i = 0; i < len; ++i )
-    ret[i] = readInt();
+  StreamPool::Stream stream = mStreams.acquire();
+  stream->seekg( position + off );
+  readInts( *stream, ret.data(), len );
 
   return ret;
 }
@@ -528,6 +537,24 @@ double MDAL::SelafinFile::readDouble( )
 }
 
 
+void MDAL::SelafinFile::readDoubles( std::ifstream &in, double *buffer, size_t count )
+{
+  bool ok;
+  if ( mStreamInFloatPrecision )
+    ok = readValues<float>( buffer, count, in, mChangeEndianness );
+  else
+    ok = readValues<double>( buffer, count, in, mChangeEndianness );
+
+  if ( !ok )
+    throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Reading double array failed" );
+}
+
+void MDAL::SelafinFile::readInts( std::ifstream &in, int *buffer, size_t count )
+{
+  if ( !readValues<int>( buffer, count, in, mChangeEndianness ) )
+    throw MDAL::Error( MDAL_Status::Err_UnknownFormat, "Reading int array failed" );
+}
+
 int MDAL::SelafinFile::readInt( )
 {
   unsigned char data[4];
@@ -778,6 +805,7 @@ void MDAL::MeshSelafin::closeSource()
   if ( mReader )
   {
     mReader->mIn.close();
+    mReader->mStreams.clear();
     mReader->mParsed = false;
   }
 }
@@ -911,6 +939,28 @@ size_t MDAL::DatasetSelafin::vectorData( size_t indexStart, size_t count, double
   return count;
 }
 
+size_t MDAL::DatasetSelafin::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  return mReader->datasetValuesAt( mTimeStepIndex, mXVariableIndex, indices, count, buffer );
+}
+
+size_t MDAL::DatasetSelafin::vectorDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  std::vector<double> xValues( count );
+  std::vector<double> yValues( count );
+  size_t xCount = mReader->datasetValuesAt( mTimeStepIndex, mXVariableIndex, indices, count, xValues.data() );
+  size_t yCount = mReader->datasetValuesAt( mTimeStepIndex, mYVariableIndex, indices, count, yValues.data() );
+  count = std::min( xCount, yCount );
+
+  for ( size_t i = 0; i < count; ++i )
+  {
+    buffer[2 * i] = xValues[i];
+    buffer[2 * i + 1] = yValues[i];
+  }
+
+  return count;
+}
+
 void MDAL::DatasetSelafin::setXVariableIndex( size_t index )
 {
   mXVariableIndex = index;
@@ -1283,6 +1333,7 @@ bool MDAL::SelafinFile::addDatasetGroup( MDAL::DatasetGroup *datasetGroup )
 
   out.close();
   mIn.close();
+  mStreams.clear();
 
   // if the uri of the dataset group is the same than the file name, be sure to close it before replace it
   if ( datasetGroup->uri() == mFileName )
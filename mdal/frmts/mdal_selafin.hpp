@@ -11,11 +11,13 @@
 #include <map>
 #include <iostream>
 #include <fstream>
+#include <mutex>
 
 #include "mdal_data_model.hpp"
 #include "mdal_memory_data_model.hpp"
 #include "mdal.h"
 #include "mdal_driver.hpp"
+#include "mdal_utils.hpp"
 
 namespace MDAL
 {
@@ -24,7 +26,8 @@ namespace MDAL
    * The file is opened with initialize() and stay opened until this object is destroyed
    *
    * \note SelafinFile object is shared between different datasets, with the mesh and its iterators.
-   *       As SelafinFile is not thread safe, it has to be shared in the same thread.
+   *       The lazy loading access methods (datasetValues(), connectivityIndex() and vertices()) read with
+   *       a stream of an internal pool, so the datasets can be read from different threads at once.
    *
    * This class can be used to create a mesh with all the dataset contained in a file with the static method createMessh()
    * It is also pôssible to add all the dataset of a file in a separate existing mesh with the static method populateDataset()
@@ -72,6 +75,12 @@ namespace MDAL
 
       //! Returns \a count values at \a timeStepIndex and \a variableIndex, and an \a offset from the start
       std::vector<double> datasetValues( size_t timeStepIndex, size_t variableIndex, size_t offset, size_t count );
+
+      /**
+       * Reads in \a buffer the values at the \a count \a indices at \a timeStepIndex and \a variableIndex,
+       * each one at its offset in the file with the same stream. Returns the count of values read before the first invalid index
+       */
+      size_t datasetValuesAt( size_t timeStepIndex, size_t variableIndex, const size_t *indices, size_t count, double *buffer );
       //! Returns \a count vertex indexex in face with an \a offset from the start
       std::vector<int> connectivityIndex( size_t offset, size_t count );
       //! Returns \a count vertices with an \a offset from the start
@@ -94,13 +103,15 @@ namespace MDAL
 
       /**
        * Reads some values in a double array record. The values count is \a len,
-       * the reading begin at the stream \a position with the \a offset
+       * the reading begin at the stream \a position with the \a offset.
+       * The values are read with a stream of the pool, so this can be called from different threads
        */
       std::vector<double> readDoubleArr( const std::streampos &position, size_t offset, size_t len );
 
       /**
        * Reads some values in a int array record. The values count is \a len,
-       * the reading begin at the stream \a position with the \a offset
+       * the reading begin at the stream \a position with the \a offset.
+       * The values are read with a stream of the pool, so this can be called from different threads
        */
       std::vector<int> readIntArr( const std::streampos &position, size_t offset, size_t len );
 
@@ -127,6 +138,10 @@ namespace MDAL
 
       double readDouble( );
       int readInt( );
+      //! Reads \a count values stored as double (or float) in one block from the current position in the stream \a in
+      void readDoubles( std::ifstream &in, double *buffer, size_t count );
+      //! Reads \a count int values in one block from the current position in the stream \a in
+      void readInts( std::ifstream &in, int *buffer, size_t count );
       size_t readSizeT( );
 
       void ignoreArrayLength( );
@@ -160,7 +175,9 @@ namespace MDAL
       bool mChangeEndianness = true;
       long long mFileSize = -1;
 
-      std::ifstream mIn;
+      std::ifstream mIn; //! stream used to parse and to save the file
+      StreamPool mStreams; //! streams used by the lazy loading reads, one per concurrent read
+      std::mutex mMutex; //! protects the parsing of the file when triggered by lazy loading reads
       bool mParsed = false;
 
 
@@ -177,7 +194,6 @@ namespace MDAL
        * Contructs a dataset with a SelafinFile object and the index of the time step
        *
        * \note SelafinFile object is shared between different dataset, with the mesh and its iterators.
-       *       As SerafinStreamReader is not thread safe, it has to be shared in the same thread.
        *
        * Position of array(s) in the stream has to be set after construction (default = begin of the stream),
        * see setXStreamPosition() and setYStreamPosition()  (X for scalar dataset, X and Y for vector dataset)
@@ -188,6 +204,8 @@ namespace MDAL
 
       size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
       size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
+      size_t scalarDataAt( const size_t *indices, size_t count, double *buffer ) override;
+      size_t vectorDataAt( const size_t *indices, size_t count, double *buffer ) override;
 
       //! Sets the position of the X array in the stream
       void setXVariableIndex( size_t index );
@@ -209,7 +227,6 @@ namespace MDAL
        * Contructs a vertex iterator with a SerafinFile instance
        *
        * \note SerafinFile instance is shared between different dataset, with the mesh and its iterators.
-       *       As SerafinStreamReader is not thread safe, it has to be shared in the same thread.
        */
       MeshSelafinVertexIterator( std::shared_ptr<SelafinFile> reader );
 
@@ -227,7 +244,6 @@ namespace MDAL
        * Contructs a face iterator with a SerafinFile instance
        *
        * \note SerafinFile instance is shared between different dataset, with the mesh and its iterators.
-       *       As SerafinFile is not thread safe, it has to be shared in the same thread.
        */
       MeshSelafinFaceIterator( std::shared_ptr<SelafinFile> reader );
 
@@ -245,7 +261,6 @@ namespace MDAL
        * Contructs a dataset with a SerafinFile instance \a reader
        *
        * \note SerafinFile instance is shared between different dataset, with the mesh and its iterators.
-       *       As SerafinFile is not thread safe, it has to be shared in the same thread.
       */
       MeshSelafin( const std::string &uri,
                    std::shared_ptr<SelafinFile> reader );
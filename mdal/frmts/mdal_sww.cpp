@@ -58,6 +58,8 @@ bool MDAL::DriverSWW::canReadMesh( const std::string &uri )
 
 std::vector<double> MDAL::DriverSWW::readZCoords( const NetCDFFile &ncFile ) const
 {
+  // the netCDF library is called directly
+  NetCDFLock lock;
   size_t nPoints = getVertexCount( ncFile );
 
   std::vector<double> pz;
@@ -157,13 +159,15 @@ MDAL::Faces MDAL::DriverSWW::readFaces( const NetCDFFile &ncFile ) const
 
   std::vector<int> pvolumes = ncFile.readIntArr( "volumes", nVertices * nVolumes );
 
-  MDAL::Faces faces( nVolumes );
+  MDAL::Faces faces;
+  faces.reserve( nVolumes, 3 * nVolumes );
+  size_t face[3];
   for ( size_t i = 0; i < nVolumes; ++i )
   {
-    faces[i].resize( 3 );
-    faces[i][0] = static_cast<size_t>( pvolumes[3 * i + 0] );
-    faces[i][1] = static_cast<size_t>( pvolumes[3 * i + 1] );
-    faces[i][2] = static_cast<size_t>( pvolumes[3 * i + 2] );
+    face[0] = static_cast<size_t>( pvolumes[3 * i + 0] );
+    face[1] = static_cast<size_t>( pvolumes[3 * i + 1] );
+    face[2] = static_cast<size_t>( pvolumes[3 * i + 2] );
+    faces.addFace( face, 3 );
   }
   return faces;
 }
@@ -286,6 +290,8 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readScalarGroup(
   const std::string arrName
 ) const
 {
+  // the netCDF library is called directly
+  NetCDFLock lock;
   size_t nPoints = getVertexCount( ncFile );
   std::shared_ptr<MDAL::DatasetGroup> mds;
 
@@ -314,7 +320,6 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readScalarGroup(
       {
         o->setScalarValue( i, valuesX[i] );
       }
-      o->setStatistics( MDAL::calculateStatistics( o ) );
       mds->datasets.push_back( o );
     }
     else
@@ -334,11 +339,9 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readScalarGroup(
         count[0] = 1;
         count[1] = nPoints;
         nc_get_vars_double( ncFile.handle(), varxid, start, count, stride, values );
-        mto->setStatistics( MDAL::calculateStatistics( mto ) );
         mds->datasets.push_back( mto );
       }
     }
-    mds->setStatistics( MDAL::calculateStatistics( mds ) );
   }
 
   return mds;
@@ -353,6 +356,8 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readVectorGroup(
   const std::string arrYName
 ) const
 {
+  // the netCDF library is called directly
+  NetCDFLock lock;
   size_t nPoints = getVertexCount( ncFile );
   std::shared_ptr<MDAL::DatasetGroup> mds;
 
@@ -390,7 +395,6 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readVectorGroup(
       {
         o->setVectorValue( i, valuesX[i], valuesY[i] );
       }
-      o->setStatistics( MDAL::calculateStatistics( o ) );
       mds->datasets.push_back( o );
     }
     else
@@ -417,11 +421,9 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverSWW::readVectorGroup(
           mto->setVectorValue( i, static_cast<double>( valuesX[i] ),  static_cast<double>( valuesY[i] ) );
         }
 
-        mto->setStatistics( MDAL::calculateStatistics( mto ) );
         mds->datasets.push_back( mto );
       }
     }
-    mds->setStatistics( MDAL::calculateStatistics( mds ) );
   }
 
   return mds;
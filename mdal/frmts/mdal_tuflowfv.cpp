@@ -371,17 +371,19 @@ void MDAL::DriverTuflowFV::populateFaces( MDAL::Faces &faces )
   size_t faceCount = mDimensions.size( CFDimensions::Face );
   size_t vertexCount = mDimensions.size( CFDimensions::Vertex );
   ( void )vertexCount;
-  faces.resize( faceCount );
 
   // Parse 2D Mesh
   size_t verticesInFace = mDimensions.size( CFDimensions::MaxVerticesInFace );
   std::vector<int> face_nodes_conn = mNcFile->readIntArr( "cell_node", faceCount * verticesInFace );
   std::vector<int> face_vertex_counts = mNcFile->readIntArr( "cell_Nvert", faceCount );
 
+  faces.reserve( faceCount, faceCount * verticesInFace );
+  Face idxs;
+  idxs.reserve( verticesInFace );
   for ( size_t i = 0; i < faceCount; ++i )
   {
     size_t nVertices = static_cast<size_t>( face_vertex_counts[i] );
-    std::vector<size_t> idxs;
+    idxs.clear();
 
     for ( size_t j = 0; j < nVertices; ++j )
     {
@@ -390,7 +392,7 @@ void MDAL::DriverTuflowFV::populateFaces( MDAL::Faces &faces )
       assert( val < vertexCount );
       idxs.push_back( val );
     }
-    faces[i] = idxs;
+    faces.addFace( idxs );
   }
 }
 
@@ -432,6 +434,18 @@ void MDAL::DriverTuflowFV::addBedElevation( MDAL::MemoryMesh *mesh )
   MDAL::addBedElevationDatasetGroup( mesh, mesh->vertices() );
 }
 
+bool MDAL::DriverTuflowFV::populateSummary( MDAL::MeshSummary &summary )
+{
+  size_t vertexCount = mDimensions.size( CFDimensions::Vertex );
+  const std::vector<double> vertices2D_x = mNcFile->readDoubleArr( "node_X", vertexCount );
+  const std::vector<double> vertices2D_y = mNcFile->readDoubleArr( "node_Y", vertexCount );
+  populateSummaryElements( summary, vertices2D_x, vertices2D_y );
+
+  addBedElevationSummary( summary );
+
+  return true;
+}
+
 std::string MDAL::DriverTuflowFV::getCoordinateSystemVariableName()
 {
   const std::string projFile = MDAL::replace( mFileName, ".nc", ".prj" );
@@ -539,7 +553,6 @@ std::shared_ptr<MDAL::Dataset> MDAL::DriverTuflowFV::create2DDataset(
         ts,
         mNcFile
       );
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   return std::move( dataset );
 }
 
@@ -565,7 +578,6 @@ std::shared_ptr<MDAL::Dataset> MDAL::DriverTuflowFV::create3DDataset( std::share
         mNcFile
       );
 
-  dataset->setStatistics( MDAL::calculateStatistics( dataset ) );
   return std::move( dataset );
 }
 
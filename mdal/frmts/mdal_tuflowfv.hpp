@@ -122,6 +122,7 @@ namespace MDAL
       CFDimensions populateDimensions( ) override;
       void populateElements( Vertices &vertices, Edges &, Faces &faces ) override;
       void addBedElevation( MemoryMesh *mesh ) override;
+      bool populateSummary( MeshSummary &summary ) override;
       std::string getCoordinateSystemVariableName() override;
       std::set<std::string> ignoreNetCDFVariables() override;
       void parseNetCDFVariableMetadata( int varid,
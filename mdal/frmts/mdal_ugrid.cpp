@@ -327,7 +327,6 @@ void MDAL::DriverUgrid::populateFaces( MDAL::Faces &faces )
 {
   assert( faces.empty() );
   size_t faceCount = mDimensions.size( CFDimensions::Face );
-  faces.resize( faceCount );
 
   // Parse 2D Mesh
   // face_node_connectivity is usually something like Mesh2D_face_nodes
@@ -340,9 +339,12 @@ void MDAL::DriverUgrid::populateFaces( MDAL::Faces &faces )
   int startIndex = mNcFile->getAttrInt( mesh2dFaceNodeConnectivity, "start_index" );
   std::vector<int> faceNodesConn = mNcFile->readIntArr( mesh2dFaceNodeConnectivity, faceCount * verticesInFace );
 
+  faces.reserve( faceCount, faceCount * verticesInFace );
+  Face idxs;
+  idxs.reserve( verticesInFace );
   for ( size_t i = 0; i < faceCount; ++i )
   {
-    std::vector<size_t> idxs;
+    idxs.clear();
 
     for ( size_t j = 0; j < verticesInFace; ++j )
     {
@@ -359,10 +361,30 @@ void MDAL::DriverUgrid::populateFaces( MDAL::Faces &faces )
         idxs.push_back( static_cast<size_t>( val - startIndex ) );
       }
     }
-    faces[i] = idxs;
+    faces.addFace( idxs );
   }
 }
 
+bool MDAL::DriverUgrid::populateSummary( MDAL::MeshSummary &summary )
+{
+  size_t vertexCount = mDimensions.size( CFDimensions::Vertex );
+
+  std::string verticesXName, verticesYName;
+  if ( mMeshDimension == 1 )
+    parseCoordinatesFrom1DMesh( mMeshName, "node_coordinates", verticesXName, verticesYName );
+  else
+    parse2VariablesFromAttribute( mMeshName, "node_coordinates", verticesXName, verticesYName, false );
+
+  const std::vector<double> verticesX = mNcFile->readDoubleArr( verticesXName, vertexCount );
+  const std::vector<double> verticesY = mNcFile->readDoubleArr( verticesYName, vertexCount );
+  populateSummaryElements( summary, verticesX, verticesY );
+
+  if ( mNcFile->hasArr( nodeZVariableName() ) )
+    addBedElevationSummary( summary );
+
+  return true;
+}
+
 void MDAL::DriverUgrid::addBedElevation( MDAL::MemoryMesh *mesh )
 {
   if ( mNcFile->hasArr( nodeZVariableName() ) ) MDAL::addBedElevationDatasetGroup( mesh, mesh->vertices() );
@@ -767,7 +789,10 @@ void MDAL::DriverUgrid::writeVariables( MDAL::Mesh *mesh )
   mNcFile->putAttrStr( timeId, "units", "hours since 2000-01-01 00:00:00" );
 
   // Turning off define mode - allows data write
-  nc_enddef( mNcFile->handle() );
+  {
+    NetCDFLock lock;
+    nc_enddef( mNcFile->handle() );
+  }
 
   // Write vertices
 
@@ -845,7 +870,10 @@ void MDAL::DriverUgrid::writeVariables( MDAL::Mesh *mesh )
   mNcFile->putDataDouble( timeId, 0, 0.0 );
 
   // Turning on define mode
-  nc_redef( mNcFile->handle() );
+  {
+    NetCDFLock lock;
+    nc_redef( mNcFile->handle() );
+  }
 }
 
 void MDAL::DriverUgrid::writeGlobals()
@@ -47,6 +47,7 @@ namespace MDAL
                                         bool *is_x ) override;
       std::vector<std::pair<double, double>> parseClassification( int varid ) const override;
       std::string getTimeVariableName() const override;
+      bool populateSummary( MeshSummary &summary ) override;
 
       void parse2VariablesFromAttribute( const std::string &name, const std::string &attr_name,
                                          std::string &var1, std::string &var2,
@@ -70,12 +70,8 @@ size_t MDAL::XdmfDataset::scalarData( size_t indexStart, size_t count, double *b
 
   std::vector<hsize_t> off = offsets( indexStart );
   std::vector<hsize_t> counts = selections( copyValues );
-  std::vector<double> values = mHdf5DatasetValues.readArrayDouble( off, counts );
-  if ( values.empty() )
+  if ( !mHdf5DatasetValues.readArray( off, counts, buffer ) )
     return 0;
-
-  const double *input = values.data();
-  memcpy( buffer, input, copyValues * sizeof( double ) );
   return copyValues;
 }
 
@@ -47,12 +47,9 @@ size_t MDAL::XmdfDataset::scalarData( size_t indexStart, size_t count, double *b
   assert( group()->isScalar() ); //checked in C API interface
   std::vector<hsize_t> offsets = {timeIndex(), indexStart};
   std::vector<hsize_t> counts = {1, count};
-  std::vector<float> values = dsValues().readArray( offsets, counts );
-  const float *input = values.data();
-  for ( size_t j = 0; j < count; ++j )
-  {
-    buffer[j] = double( input[j] );
-  }
+  // values are stored as float, converted by HDF5 while reading
+  if ( !dsValues().readArray( offsets, counts, buffer ) )
+    return 0;
   return count;
 }
 
@@ -61,15 +58,47 @@ size_t MDAL::XmdfDataset::vectorData( size_t indexStart, size_t count, double *b
   assert( !group()->isScalar() ); //checked in C API interface
   std::vector<hsize_t> offsets = {timeIndex(), indexStart, 0};
   std::vector<hsize_t> counts = {1, count, 2};
-  std::vector<float> values = dsValues().readArray( offsets, counts );
-  const float *input = values.data();
-  for ( size_t j = 0; j < count; ++j )
+  if ( !dsValues().readArray( offsets, counts, buffer ) )
+    return 0;
+  return count;
+}
+
+size_t MDAL::XmdfDataset::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( group()->isScalar() ); //checked in C API interface
+  size_t nValues = valuesCount();
+  std::vector<hsize_t> coordinates;
+  coordinates.reserve( 2 * count );
+  for ( size_t i = 0; i < count && indices[i] < nValues; ++i )
   {
-    buffer[2 * j] = double( input[2 * j] );
-    buffer[2 * j + 1] = double( input[2 * j + 1] );
+    coordinates.push_back( timeIndex() );
+    coordinates.push_back( indices[i] );
   }
 
-  return count;
+  if ( !dsValues().readElements( 2, coordinates, buffer ) )
+    return 0;
+  return coordinates.size() / 2;
+}
+
+size_t MDAL::XmdfDataset::vectorDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( !group()->isScalar() ); //checked in C API interface
+  size_t nValues = valuesCount();
+  std::vector<hsize_t> coordinates;
+  coordinates.reserve( 6 * count );
+  for ( size_t i = 0; i < count && indices[i] < nValues; ++i )
+  {
+    for ( hsize_t component = 0; component < 2; ++component )
+    {
+      coordinates.push_back( timeIndex() );
+      coordinates.push_back( indices[i] );
+      coordinates.push_back( component );
+    }
+  }
+
+  if ( !dsValues().readElements( 3, coordinates, buffer ) )
+    return 0;
+  return coordinates.size() / 6;
 }
 
 size_t MDAL::XmdfDataset::activeData( size_t indexStart, size_t count, int *buffer )
@@ -78,11 +107,11 @@ size_t MDAL::XmdfDataset::activeData( size_t indexStart, size_t count, int *buff
     return 0;
   std::vector<hsize_t> offsets = {timeIndex(), indexStart};
   std::vector<hsize_t> counts = {1, count};
-  std::vector<uchar> active = dsActive().readArrayUint8( offsets, counts );
-  const uchar *input = active.data();
+  if ( !dsActive().readArray( offsets, counts, buffer ) )
+    return 0;
   for ( size_t j = 0; j < count; ++j )
   {
-    buffer[j] = bool( input[ j ] );
+    buffer[j] = bool( buffer[ j ] );
   }
   return count;
 }
@@ -218,6 +247,9 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverXmdf::readXmdfGroupAsDatasetGrou
   const HdfGroup &rootGroup, const std::string &groupName, size_t vertexCount, size_t faceCount ) const
 {
   std::shared_ptr<DatasetGroup> group;
+  if ( !openOptions().acceptsGroup( groupName ) )
+    return group;
+
   std::vector<std::string> gDataNames = rootGroup.datasets();
   if ( !MDAL::contains( gDataNames, "Times" ) ||
        !MDAL::contains( gDataNames, "Values" ) ||
@@ -305,18 +337,18 @@ std::shared_ptr<MDAL::DatasetGroup> MDAL::DriverXmdf::readXmdfGroupAsDatasetGrou
       group->setReferenceTime( DateTime( refTime, DateTime::JulianDay ) );
   }
 
-  // lazy loading of min and max of the dataset group
+  // min and max of the datasets are stored in the file, the statistics of the group are combined from them
   std::vector<float> mins = dsMins.readArray();
   std::vector<float> maxs = dsMaxs.readArray();
-  Statistics grpStats;
-  grpStats.minimum = static_cast<double>( *std::min_element( mins.begin(), mins.end() ) );
-  grpStats.maximum = static_cast<double>( *std::max_element( maxs.begin(), maxs.end() ) );
-  group->setStatistics( grpStats );
 
   for ( hsize_t i = 0; i < nTimeSteps; ++i )
   {
+    const RelativeTimestamp time( times[i], timeUnit );
+    if ( !openOptions().acceptsTime( time, static_cast<size_t>( nTimeSteps ) ) )
+      continue;
+
     std::shared_ptr<XmdfDataset> dataset = std::make_shared< XmdfDataset >( group.get(), dsValues, dsActive, i );
-    dataset->setTime( times[i], timeUnit );
+    dataset->setTime( time );
     dataset->setSupportsActiveFlag( activeFlagSupported );
     Statistics stats;
     stats.minimum = static_cast<double>( mins[i] );
@@ -47,6 +47,10 @@ namespace MDAL
       size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
       size_t vectorData( size_t indexStart, size_t count, double *buffer ) override;
       size_t activeData( size_t indexStart, size_t count, int *buffer ) override;
+      //! Reads the values with one HDF5 read of the selected points
+      size_t scalarDataAt( const size_t *indices, size_t count, double *buffer ) override;
+      //! Reads the values with one HDF5 read of the selected points
+      size_t vectorDataAt( const size_t *indices, size_t count, double *buffer ) override;
 
       const HdfDataset &dsValues() const;
       const HdfDataset &dsActive() const;
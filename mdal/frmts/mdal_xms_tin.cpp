@@ -115,7 +115,9 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverXmsTin::load( const std::string &meshFil
     return nullptr;
   }
   size_t faceCount = MDAL::toSizeT( chunks[1] );
-  Faces faces( faceCount );
+  Faces faces;
+  faces.reserve( faceCount, faceCount * MAX_VERTICES_PER_FACE_TIN );
+  size_t face[MAX_VERTICES_PER_FACE_TIN];
   for ( size_t i = 0; i < faceCount; ++i )
   {
     if ( !std::getline( in, line ) )
@@ -131,11 +133,10 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverXmsTin::load( const std::string &meshFil
       return nullptr;
     }
 
-    Face &face = faces[i];
-    face.resize( MAX_VERTICES_PER_FACE_TIN );
     face[0] = MDAL::toSizeT( chunks[0] ) - 1;
     face[1] = MDAL::toSizeT( chunks[1] ) - 1;
     face[2] = MDAL::toSizeT( chunks[2] ) - 1;
+    faces.addFace( face, MAX_VERTICES_PER_FACE_TIN );
   }
 
   // Final keyword
@@ -8,17 +8,33 @@
 #include <limits>
 #include <assert.h>
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #include "mdal.h"
+#include "mdal_config.hpp"
 #include "mdal_driver_manager.hpp"
 #include "mdal_data_model.hpp"
 #include "mdal_utils.hpp"
 #include "mdal_logger.hpp"
+#include "mdal_statistics_cache.hpp"
+#include "mdal_histogram.hpp"
+
+#ifdef HAVE_HDF5
+#include "frmts/mdal_hdf5.hpp"
+#endif
+
+#ifdef HAVE_NETCDF
+#include "frmts/mdal_netcdf.hpp"
+#endif
 
 #define NODATA std::numeric_limits<double>::quiet_NaN()
 
 static const char *EMPTY_STR = "";
 
+// count of elements read at once from the drivers by the 64 bits API functions
+static const size_t API_CHUNK_SIZE = 1 << 20;
+
 const char *MDAL_Version()
 {
   return "0.7.2";
@@ -39,6 +55,63 @@ void MDAL_SetLogVerbosity( MDAL_LogLevel verbosity )
   MDAL::Log::setLogVerbosity( verbosity );
 }
 
+void MDAL_SetHdf5DatasetChunkCacheSize( int64_t bytes )
+{
+  if ( bytes < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Chunk cache size cannot be negative" );
+    return;
+  }
+#ifdef HAVE_HDF5
+  HdfFile::setDatasetChunkCacheSize( static_cast<size_t>( bytes ) );
+#endif
+}
+
+void MDAL_SetHdf5FileDriver( MDAL_Hdf5FileDriver driver )
+{
+#ifdef HAVE_HDF5
+  HdfFile::setCoreDriver( driver == MDAL_Hdf5FileDriver::Hdf5Core );
+#else
+  MDAL_UNUSED( driver );
+#endif
+}
+
+void MDAL_SetNetCDFBlockCacheSize( int64_t bytes )
+{
+  if ( bytes < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Block cache size cannot be negative" );
+    return;
+  }
+#ifdef HAVE_NETCDF
+  NetCDFFile::setBlockCacheSize( static_cast<size_t>( bytes ) );
+#endif
+}
+
+int64_t MDAL_NetCDFBlockCacheSize()
+{
+#ifdef HAVE_NETCDF
+  return static_cast<int64_t>( NetCDFFile::blockCacheSize() );
+#else
+  return 0;
+#endif
+}
+
+void MDAL_SetThreadCount( int count )
+{
+  if ( count < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Thread count cannot be negative" );
+    return;
+  }
+  MDAL::setThreadCount( static_cast<size_t>( count ) );
+}
+
+int MDAL_ThreadCount()
+{
+  return MDAL::toInt( MDAL::threadCount() );
+}
+
 // helper to return string data - without having to deal with memory too much.
 // returned pointer is valid only next call. also not thread-safe.
 const char *_return_str( const std::string &str )
@@ -48,6 +121,26 @@ const char *_return_str( const std::string &str )
   return lastStr.c_str();
 }
 
+void MDAL_SetStatisticsCacheEnabled( bool enabled )
+{
+  MDAL::StatisticsCache::setEnabled( enabled );
+}
+
+bool MDAL_StatisticsCacheEnabled()
+{
+  return MDAL::StatisticsCache::isEnabled();
+}
+
+void MDAL_SetStatisticsCacheDirectory( const char *directory )
+{
+  MDAL::StatisticsCache::setDirectory( directory ? std::string( directory ) : std::string() );
+}
+
+const char *MDAL_StatisticsCacheDirectory()
+{
+  return _return_str( MDAL::StatisticsCache::directory() );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// DRIVERS
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +248,11 @@ const char *MDAL_DR_filters( MDAL_DriverH driver )
 ///////////////////////////////////////////////////////////////////////////////////////
 
 MDAL_MeshH MDAL_LoadMesh( const char *uri )
+{
+  return MDAL_LoadMeshWithOptions( uri, nullptr );
+}
+
+MDAL_MeshH MDAL_LoadMeshWithOptions( const char *uri, const char *const *options )
 {
   if ( !uri )
   {
@@ -166,12 +264,14 @@ MDAL_MeshH MDAL_LoadMesh( const char *uri )
 
   MDAL::parseDriverAndMeshFromUri( uriString, driverName, meshFile, meshName );
 
+  const MDAL::OpenOptions openOptions( options );
+
   if ( !driverName.empty() )
   {
-    return static_cast< MDAL_MeshH >( MDAL::DriverManager::instance().load( driverName, meshFile, meshName ).release() );
+    return static_cast< MDAL_MeshH >( MDAL::DriverManager::instance().load( driverName, meshFile, meshName, openOptions ).release() );
   }
   else
-    return static_cast< MDAL_MeshH >( MDAL::DriverManager::instance().load( meshFile, meshName ).release() );
+    return static_cast< MDAL_MeshH >( MDAL::DriverManager::instance().load( meshFile, meshName, openOptions ).release() );
 }
 
 const char *MDAL_MeshNames( const char *uri )
@@ -231,6 +331,7 @@ void MDAL_CloseMesh( MDAL_MeshH mesh )
   if ( mesh )
   {
     MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
+    MDAL::StatisticsCache::save( m->datasetGroups );
     delete m;
   }
 }
@@ -269,6 +370,11 @@ void MDAL_M_extent( MDAL_MeshH mesh, double *minX, double *maxX, double *minY, d
 }
 
 int MDAL_M_vertexCount( MDAL_MeshH mesh )
+{
+  return static_cast<int>( MDAL_M_vertexCount64( mesh ) );
+}
+
+int64_t MDAL_M_vertexCount64( MDAL_MeshH mesh )
 {
   if ( !mesh )
   {
@@ -277,12 +383,17 @@ int MDAL_M_vertexCount( MDAL_MeshH mesh )
   }
 
   MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
-  int len = static_cast<int>( m->verticesCount() );
+  int64_t len = static_cast<int64_t>( m->verticesCount() );
   return len;
 }
 
 
 int MDAL_M_edgeCount( MDAL_MeshH mesh )
+{
+  return static_cast<int>( MDAL_M_edgeCount64( mesh ) );
+}
+
+int64_t MDAL_M_edgeCount64( MDAL_MeshH mesh )
 {
   if ( !mesh )
   {
@@ -291,11 +402,16 @@ int MDAL_M_edgeCount( MDAL_MeshH mesh )
   }
 
   MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
-  int len = static_cast<int>( m->edgesCount() );
+  int64_t len = static_cast<int64_t>( m->edgesCount() );
   return len;
 }
 
 int MDAL_M_faceCount( MDAL_MeshH mesh )
+{
+  return static_cast<int>( MDAL_M_faceCount64( mesh ) );
+}
+
+int64_t MDAL_M_faceCount64( MDAL_MeshH mesh )
 {
   if ( !mesh )
   {
@@ -303,7 +419,7 @@ int MDAL_M_faceCount( MDAL_MeshH mesh )
     return 0;
   }
   MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
-  int len = static_cast<int>( m->facesCount() );
+  int64_t len = static_cast<int64_t>( m->facesCount() );
   return len;
 }
 
@@ -320,6 +436,11 @@ int MDAL_M_faceVerticesMaximumCount( MDAL_MeshH mesh )
 }
 
 void MDAL_M_LoadDatasets( MDAL_MeshH mesh, const char *datasetFile )
+{
+  MDAL_M_LoadDatasetsWithOptions( mesh, datasetFile, nullptr );
+}
+
+void MDAL_M_LoadDatasetsWithOptions( MDAL_MeshH mesh, const char *datasetFile, const char *const *options )
 {
   if ( !datasetFile )
   {
@@ -335,8 +456,7 @@ void MDAL_M_LoadDatasets( MDAL_MeshH mesh, const char *datasetFile )
 
   MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
 
-  std::string filename( datasetFile );
-  MDAL::DriverManager::instance().loadDatasets( m, datasetFile );
+  MDAL::DriverManager::instance().loadDatasets( m, datasetFile, MDAL::OpenOptions( options ) );
 }
 
 int MDAL_M_datasetGroupCount( MDAL_MeshH mesh )
@@ -442,6 +562,207 @@ const char *MDAL_M_driverName( MDAL_MeshH mesh )
   return _return_str( m->driverName() );
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+/// MESH SUMMARY
+///////////////////////////////////////////////////////////////////////////////////////
+
+MDAL_MeshSummaryH MDAL_LoadMeshSummary( const char *uri )
+{
+  if ( !uri )
+  {
+    MDAL::Log::error( MDAL_Status::Err_FileNotFound, "Mesh file is not valid (null)" );
+    return nullptr;
+  }
+
+  std::string uriString( uri ), driverName, meshFile, meshName;
+
+  MDAL::parseDriverAndMeshFromUri( uriString, driverName, meshFile, meshName );
+
+  if ( !driverName.empty() )
+    return static_cast< MDAL_MeshSummaryH >( MDAL::DriverManager::instance().loadSummary( driverName, meshFile, meshName ).release() );
+  else
+    return static_cast< MDAL_MeshSummaryH >( MDAL::DriverManager::instance().loadSummary( meshFile, meshName ).release() );
+}
+
+void MDAL_CloseMeshSummary( MDAL_MeshSummaryH summary )
+{
+  if ( summary )
+  {
+    MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+    delete s;
+  }
+}
+
+const char *MDAL_MS_driverName( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return nullptr;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return _return_str( s->driverName );
+}
+
+const char *MDAL_MS_projection( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return EMPTY_STR;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return _return_str( s->crs );
+}
+
+void MDAL_MS_extent( MDAL_MeshSummaryH summary, double *minX, double *maxX, double *minY, double *maxY )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    *minX = std::numeric_limits<double>::quiet_NaN();
+    *maxX = std::numeric_limits<double>::quiet_NaN();
+    *minY = std::numeric_limits<double>::quiet_NaN();
+    *maxY = std::numeric_limits<double>::quiet_NaN();
+  }
+  else
+  {
+    MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+    *minX = s->extent.minX;
+    *maxX = s->extent.maxX;
+    *minY = s->extent.minY;
+    *maxY = s->extent.maxY;
+  }
+}
+
+int64_t MDAL_MS_vertexCount( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return static_cast<int64_t>( s->verticesCount );
+}
+
+int64_t MDAL_MS_edgeCount( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return static_cast<int64_t>( s->edgesCount );
+}
+
+int64_t MDAL_MS_faceCount( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return static_cast<int64_t>( s->facesCount );
+}
+
+int MDAL_MS_datasetGroupCount( MDAL_MeshSummaryH summary )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  return static_cast<int>( s->groups.size() );
+}
+
+//! Returns the summary of the dataset group with \a index, or nullptr with an error logged if it does not exist
+static const MDAL::DatasetGroupSummary *_datasetGroupSummary( MDAL_MeshSummaryH summary, int index )
+{
+  if ( !summary )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh summary is not valid (null)" );
+    return nullptr;
+  }
+
+  MDAL::MeshSummary *s = static_cast< MDAL::MeshSummary * >( summary );
+  if ( index < 0 || static_cast<size_t>( index ) >= s->groups.size() )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDatasetGroup, "Requested index is not valid: " + std::to_string( index ) );
+    return nullptr;
+  }
+
+  return &s->groups[static_cast<size_t>( index )];
+}
+
+const char *MDAL_MS_datasetGroupName( MDAL_MeshSummaryH summary, int index )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+    return EMPTY_STR;
+
+  return _return_str( g->name );
+}
+
+MDAL_DataLocation MDAL_MS_datasetGroupDataLocation( MDAL_MeshSummaryH summary, int index )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+    return MDAL_DataLocation::DataInvalidLocation;
+
+  return g->dataLocation;
+}
+
+bool MDAL_MS_datasetGroupHasScalarData( MDAL_MeshSummaryH summary, int index )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+    return true;
+
+  return g->isScalar;
+}
+
+int MDAL_MS_datasetGroupDatasetCount( MDAL_MeshSummaryH summary, int index )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+    return 0;
+
+  return static_cast<int>( g->datasetsCount );
+}
+
+void MDAL_MS_datasetGroupTimeRange( MDAL_MeshSummaryH summary, int index, double *startTime, double *endTime )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+  {
+    *startTime = std::numeric_limits<double>::quiet_NaN();
+    *endTime = std::numeric_limits<double>::quiet_NaN();
+    return;
+  }
+
+  *startTime = g->startTime.value( MDAL::RelativeTimestamp::hours );
+  *endTime = g->endTime.value( MDAL::RelativeTimestamp::hours );
+}
+
+const char *MDAL_MS_datasetGroupReferenceTime( MDAL_MeshSummaryH summary, int index )
+{
+  const MDAL::DatasetGroupSummary *g = _datasetGroupSummary( summary, index );
+  if ( !g )
+    return EMPTY_STR;
+
+  return _return_str( g->referenceTime.toStandardCalendarISO8601() );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// MESH VERTICES
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -460,7 +781,17 @@ MDAL_MeshVertexIteratorH MDAL_M_vertexIterator( MDAL_MeshH mesh )
 
 int MDAL_VI_next( MDAL_MeshVertexIteratorH iterator, int verticesCount, double *coordinates )
 {
-  if ( verticesCount < 1 )
+  return static_cast<int>( MDAL_VI_next64( iterator, verticesCount, coordinates ) );
+}
+
+int64_t MDAL_VI_next64( MDAL_MeshVertexIteratorH iterator, int64_t verticesCount, double *coordinates )
+{
+  if ( verticesCount < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Vertices count cannot be negative" );
+    return 0;
+  }
+  if ( verticesCount == 0 )
     return 0;
 
   if ( !iterator )
@@ -476,7 +807,7 @@ int MDAL_VI_next( MDAL_MeshVertexIteratorH iterator, int verticesCount, double *
   MDAL::MeshVertexIterator *it = static_cast< MDAL::MeshVertexIterator * >( iterator );
   size_t size = static_cast<size_t>( verticesCount );
   size_t ret = it->next( size, coordinates );
-  return static_cast<int>( ret );
+  return static_cast<int64_t>( ret );
 }
 
 void MDAL_VI_close( MDAL_MeshVertexIteratorH iterator )
@@ -488,6 +819,33 @@ void MDAL_VI_close( MDAL_MeshVertexIteratorH iterator )
   }
 }
 
+const double *MDAL_M_verticesView( MDAL_MeshH mesh, int64_t *vertexCount )
+{
+  if ( vertexCount )
+    *vertexCount = 0;
+
+  if ( !mesh )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh is not valid (null)" );
+    return nullptr;
+  }
+
+  if ( !vertexCount )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Vertex count pointer is not valid (null)" );
+    return nullptr;
+  }
+
+  MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
+  const double *view = m->verticesView();
+  // not an error, the vertices are not stored in memory, they can be read with MDAL_M_vertexIterator()
+  if ( !view )
+    return nullptr;
+
+  *vertexCount = static_cast<int64_t>( m->verticesCount() );
+  return view;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// MESH EDGES
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -527,6 +885,50 @@ int MDAL_EI_next( MDAL_MeshEdgeIteratorH iterator, int edgesCount, int *startVer
   return static_cast<int>( ret );
 }
 
+int64_t MDAL_EI_next64( MDAL_MeshEdgeIteratorH iterator, int64_t edgesCount, int64_t *startVertexIndices, int64_t *endVertexIndices )
+{
+  if ( edgesCount < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Edges count cannot be negative" );
+    return 0;
+  }
+  if ( edgesCount == 0 )
+    return 0;
+
+  if ( !iterator )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh Edge Iterator is not valid (null)" );
+    return 0;
+  }
+
+  if ( !startVertexIndices || !endVertexIndices )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Start or End Vertex Index is not valid (null)" );
+    return 0;
+  }
+
+  // drivers iterate with int buffers, edges are read by chunks and copied in the 64 bits buffers
+  MDAL::MeshEdgeIterator *it = static_cast< MDAL::MeshEdgeIterator * >( iterator );
+  size_t size = static_cast<size_t>( edgesCount );
+  size_t chunkSize = std::min( size, API_CHUNK_SIZE );
+  std::vector<int> startChunk( chunkSize );
+  std::vector<int> endChunk( chunkSize );
+
+  size_t edgesRead = 0;
+  while ( edgesRead < size )
+  {
+    size_t ret = it->next( std::min( size - edgesRead, chunkSize ), startChunk.data(), endChunk.data() );
+    if ( ret == 0 )
+      break;
+
+    std::copy( startChunk.begin(), startChunk.begin() + ret, startVertexIndices + edgesRead );
+    std::copy( endChunk.begin(), endChunk.begin() + ret, endVertexIndices + edgesRead );
+    edgesRead += ret;
+  }
+
+  return static_cast<int64_t>( edgesRead );
+}
+
 void MDAL_EI_close( MDAL_MeshEdgeIteratorH iterator )
 {
   if ( iterator )
@@ -575,6 +977,58 @@ int MDAL_FI_next( MDAL_MeshFaceIteratorH iterator,
 }
 
 
+int64_t MDAL_FI_next64( MDAL_MeshFaceIteratorH iterator,
+                        int64_t faceOffsetsBufferLen,
+                        int64_t *faceOffsetsBuffer,
+                        int64_t vertexIndicesBufferLen,
+                        int64_t *vertexIndicesBuffer )
+{
+  if ( ( faceOffsetsBufferLen < 0 ) || ( vertexIndicesBufferLen < 0 ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Buffer lengths cannot be negative" );
+    return 0;
+  }
+  if ( ( faceOffsetsBufferLen == 0 ) || ( vertexIndicesBufferLen == 0 ) )
+    return 0;
+
+  if ( !iterator )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh Face Iterator is not valid (null)" );
+    return 0;
+  }
+
+  // drivers iterate with int buffers, faces are read by chunks
+  // and the offsets are shifted by the vertex indices already written in the 64 bits buffers
+  MDAL::MeshFaceIterator *it = static_cast< MDAL::MeshFaceIterator * >( iterator );
+  size_t facesSize = static_cast<size_t>( faceOffsetsBufferLen );
+  size_t indicesSize = static_cast<size_t>( vertexIndicesBufferLen );
+  std::vector<int> offsetsChunk( std::min( facesSize, API_CHUNK_SIZE ) );
+  std::vector<int> indicesChunk( std::min( indicesSize, API_CHUNK_SIZE ) );
+
+  size_t facesRead = 0;
+  size_t indicesRead = 0;
+  while ( facesRead < facesSize && indicesRead < indicesSize )
+  {
+    size_t ret = it->next( std::min( facesSize - facesRead, offsetsChunk.size() ),
+                           offsetsChunk.data(),
+                           std::min( indicesSize - indicesRead, indicesChunk.size() ),
+                           indicesChunk.data() );
+    if ( ret == 0 )
+      break;
+
+    for ( size_t i = 0; i < ret; ++i )
+      faceOffsetsBuffer[facesRead + i] = static_cast<int64_t>( indicesRead ) + offsetsChunk[i];
+
+    size_t chunkIndicesCount = static_cast<size_t>( offsetsChunk[ret - 1] );
+    std::copy( indicesChunk.begin(), indicesChunk.begin() + chunkIndicesCount, vertexIndicesBuffer + indicesRead );
+
+    facesRead += ret;
+    indicesRead += chunkIndicesCount;
+  }
+
+  return static_cast<int64_t>( facesRead );
+}
+
 void MDAL_FI_close( MDAL_MeshFaceIteratorH iterator )
 {
   if ( iterator )
@@ -585,6 +1039,39 @@ void MDAL_FI_close( MDAL_MeshFaceIteratorH iterator )
 }
 
 
+int64_t MDAL_M_faceAtPoint( MDAL_MeshH mesh, double x, double y )
+{
+  if ( !mesh )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh is not valid (null)" );
+    return -1;
+  }
+
+  MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
+  return m->faceAt( x, y );
+}
+
+int64_t MDAL_M_facesAtPoints( MDAL_MeshH mesh, int64_t pointsCount, const double *coordinates, int64_t *faceIndexes )
+{
+  if ( !mesh )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleMesh, "Mesh is not valid (null)" );
+    return 0;
+  }
+
+  if ( pointsCount < 1 )
+    return 0;
+
+  if ( !coordinates || !faceIndexes )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Coordinates or face indexes buffer is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::Mesh *m = static_cast< MDAL::Mesh * >( mesh );
+  return static_cast<int64_t>( m->facesAt( static_cast<size_t>( pointsCount ), coordinates, faceIndexes ) );
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 /// DATASET GROUPS
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -753,6 +1240,121 @@ void MDAL_G_minimumMaximum( MDAL_DatasetGroupH group, double *min, double *max )
   *max = stats.maximum;
 }
 
+//! Sets the \a binCount \a counts from \a histogram
+static void _histogramCounts( const MDAL::Histogram &histogram, double minimum, double maximum, int binCount, int64_t *counts )
+{
+  std::vector<uint64_t> binCounts( static_cast<size_t>( binCount ) );
+  histogram.counts( minimum, maximum, binCounts.size(), binCounts.data() );
+  for ( size_t i = 0; i < binCounts.size(); ++i )
+    counts[i] = static_cast<int64_t>( binCounts[i] );
+}
+
+//! Sets \a quantiles from \a histogram
+static void _quantiles( const MDAL::Histogram &histogram, int count, const double *probabilities, double *quantiles )
+{
+  for ( int i = 0; i < count; ++i )
+    quantiles[i] = histogram.quantile( probabilities[i] );
+}
+
+void MDAL_G_histogram( MDAL_DatasetGroupH group, double minimum, double maximum, int binCount, int64_t *counts )
+{
+  if ( !counts || binCount <= 0 || !( minimum <= maximum ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Invalid histogram bins or counts (null)" );
+    return;
+  }
+
+  if ( !group )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset Group is not valid (null)" );
+    std::fill( counts, counts + binCount, 0 );
+    return;
+  }
+
+  MDAL::DatasetGroup *g = static_cast< MDAL::DatasetGroup * >( group );
+  _histogramCounts( *g->histogram(), minimum, maximum, binCount, counts );
+}
+
+void MDAL_G_quantiles( MDAL_DatasetGroupH group, int count, const double *probabilities, double *quantiles )
+{
+  if ( !probabilities || !quantiles || count < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Passed pointers probabilities or quantiles are not valid (null)" );
+    return;
+  }
+
+  if ( !group )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset Group is not valid (null)" );
+    std::fill( quantiles, quantiles + count, NODATA );
+    return;
+  }
+
+  MDAL::DatasetGroup *g = static_cast< MDAL::DatasetGroup * >( group );
+  _quantiles( *g->histogram(), count, probabilities, quantiles );
+}
+
+int MDAL_G_timeSeries( MDAL_DatasetGroupH group, const int *indices, int indicesCount, double *buffer )
+{
+  if ( !group )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDatasetGroup, "Dataset group is not valid (null)" );
+    return 0;
+  }
+
+  if ( !indices || !buffer || indicesCount < 1 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Indices or buffer are not valid" );
+    return 0;
+  }
+
+  MDAL::DatasetGroup *g = static_cast< MDAL::DatasetGroup * >( group );
+  const MDAL_DataLocation location = g->dataLocation();
+  if ( ( location != MDAL_DataLocation::DataOnVertices ) && ( location != MDAL_DataLocation::DataOnFaces ) && ( location != MDAL_DataLocation::DataOnEdges ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDatasetGroup, "Time series only supported on dataset groups with data on vertices, faces or edges" );
+    return 0;
+  }
+
+  if ( g->datasets.empty() )
+    return 0;
+
+  size_t count = static_cast<size_t>( indicesCount );
+  size_t valuesCount = g->datasets.front()->valuesCount();
+  std::vector<size_t> indicesSizeT( count );
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( indices[i] < 0 || static_cast<size_t>( indices[i] ) >= valuesCount )
+    {
+      MDAL::Log::error( MDAL_Status::Err_InvalidData, "Index " + std::to_string( indices[i] ) + " is out of values limit" );
+      return 0;
+    }
+    indicesSizeT[i] = static_cast<size_t>( indices[i] );
+  }
+
+  bool isScalar = g->isScalar();
+  size_t valuesPerDataset = isScalar ? count : 2 * count;
+  int datasetsWritten = 0;
+  for ( const std::shared_ptr<MDAL::Dataset> &dataset : g->datasets )
+  {
+    double *datasetBuffer = buffer + static_cast<size_t>( datasetsWritten ) * valuesPerDataset;
+    size_t written;
+    if ( isScalar )
+      written = dataset->scalarDataAt( indicesSizeT.data(), count, datasetBuffer );
+    else
+      written = dataset->vectorDataAt( indicesSizeT.data(), count, datasetBuffer );
+
+    if ( written != count )
+    {
+      MDAL::Log::error( MDAL_Status::Err_InvalidData, "Unable to read values of dataset " + std::to_string( datasetsWritten ) );
+      break;
+    }
+    ++datasetsWritten;
+  }
+
+  return datasetsWritten;
+}
+
 MDAL_DatasetH MDAL_G_addDataset( MDAL_DatasetGroupH group, double time, const double *values, const int *active )
 {
   if ( !group )
@@ -839,7 +1441,7 @@ void MDAL_G_closeEditMode( MDAL_DatasetGroupH group )
     return;
   }
 
-  g->setStatistics( MDAL::calculateStatistics( g ) );
+  g->invalidateStatistics();
   g->stopEditing();
 
   const std::string driverName = g->driverName();
@@ -949,6 +1551,11 @@ double MDAL_D_time( MDAL_DatasetH dataset )
 }
 
 int MDAL_D_volumesCount( MDAL_DatasetH dataset )
+{
+  return static_cast<int>( MDAL_D_volumesCount64( dataset ) );
+}
+
+int64_t MDAL_D_volumesCount64( MDAL_DatasetH dataset )
 {
   if ( !dataset )
   {
@@ -956,7 +1563,7 @@ int MDAL_D_volumesCount( MDAL_DatasetH dataset )
     return 0;
   }
   MDAL::Dataset *d = static_cast< MDAL::Dataset * >( dataset );
-  int len = static_cast<int>( d->volumesCount() );
+  int64_t len = static_cast<int64_t>( d->volumesCount() );
   return len;
 }
 
@@ -973,6 +1580,11 @@ int MDAL_D_maximumVerticalLevelCount( MDAL_DatasetH dataset )
 }
 
 int MDAL_D_valueCount( MDAL_DatasetH dataset )
+{
+  return static_cast<int>( MDAL_D_valueCount64( dataset ) );
+}
+
+int64_t MDAL_D_valueCount64( MDAL_DatasetH dataset )
 {
   if ( !dataset )
   {
@@ -980,7 +1592,7 @@ int MDAL_D_valueCount( MDAL_DatasetH dataset )
     return 0;
   }
   MDAL::Dataset *d = static_cast< MDAL::Dataset * >( dataset );
-  int len = static_cast<int>( d->valuesCount() );
+  int64_t len = static_cast<int64_t>( d->valuesCount() );
   return len;
 }
 
@@ -996,12 +1608,22 @@ bool MDAL_D_isValid( MDAL_DatasetH dataset )
 }
 
 int MDAL_D_data( MDAL_DatasetH dataset, int indexStart, int count, MDAL_DataType dataType, void *buffer )
+{
+  return static_cast<int>( MDAL_D_data64( dataset, indexStart, count, dataType, buffer ) );
+}
+
+int64_t MDAL_D_data64( MDAL_DatasetH dataset, int64_t indexStart, int64_t count, MDAL_DataType dataType, void *buffer )
 {
   if ( !dataset )
   {
     MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset is not valid (null)" );
     return 0;
   }
+  if ( indexStart < 0 || count < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Start index and count cannot be negative" );
+    return 0;
+  }
   MDAL::Dataset *d = static_cast< MDAL::Dataset * >( dataset );
   size_t indexStartSizeT = static_cast<size_t>( indexStart );
   size_t countSizeT = static_cast<size_t>( count );
@@ -1145,7 +1767,63 @@ int MDAL_D_data( MDAL_DatasetH dataset, int indexStart, int count, MDAL_DataType
       break;
   }
 
-  return static_cast<int>( writtenValuesCount );
+  return static_cast<int64_t>( writtenValuesCount );
+}
+
+const void *MDAL_D_dataView( MDAL_DatasetH dataset, MDAL_DataType dataType, int64_t *count )
+{
+  if ( count )
+    *count = 0;
+
+  if ( !dataset )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset is not valid (null)" );
+    return nullptr;
+  }
+
+  if ( !count )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Count pointer is not valid (null)" );
+    return nullptr;
+  }
+
+  MDAL::Dataset *d = static_cast< MDAL::Dataset * >( dataset );
+  size_t viewCount = 0;
+  const void *view = d->dataView( dataType, viewCount );
+  // not an error, the values are not stored in memory with this layout, they can be read with MDAL_D_data()
+  if ( !view )
+    return nullptr;
+
+  *count = static_cast<int64_t>( viewCount );
+  return view;
+}
+
+int64_t MDAL_D_valuesAtPoints( MDAL_DatasetH dataset, int64_t pointsCount, const double *coordinates, double *buffer )
+{
+  if ( !dataset )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset is not valid (null)" );
+    return 0;
+  }
+
+  if ( pointsCount < 1 )
+    return 0;
+
+  if ( !coordinates || !buffer )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Coordinates or values buffer is not valid (null)" );
+    return 0;
+  }
+
+  MDAL::Dataset *d = static_cast< MDAL::Dataset * >( dataset );
+  const MDAL_DataLocation location = d->group()->dataLocation();
+  if ( location != MDAL_DataLocation::DataOnVertices && location != MDAL_DataLocation::DataOnFaces )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Values at points are only available for data on vertices or faces" );
+    return 0;
+  }
+
+  return static_cast<int64_t>( d->valuesAtPoints( static_cast<size_t>( pointsCount ), coordinates, buffer ) );
 }
 
 void MDAL_D_minimumMaximum( MDAL_DatasetH dataset, double *min, double *max )
@@ -1170,6 +1848,44 @@ void MDAL_D_minimumMaximum( MDAL_DatasetH dataset, double *min, double *max )
   *max = stats.maximum;
 }
 
+void MDAL_D_histogram( MDAL_DatasetH dataset, double minimum, double maximum, int binCount, int64_t *counts )
+{
+  if ( !counts || binCount <= 0 || !( minimum <= maximum ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Invalid histogram bins or counts (null)" );
+    return;
+  }
+
+  if ( !dataset )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset is not valid (null)" );
+    std::fill( counts, counts + binCount, 0 );
+    return;
+  }
+
+  MDAL::Dataset *ds = static_cast< MDAL::Dataset * >( dataset );
+  _histogramCounts( *ds->histogram(), minimum, maximum, binCount, counts );
+}
+
+void MDAL_D_quantiles( MDAL_DatasetH dataset, int count, const double *probabilities, double *quantiles )
+{
+  if ( !probabilities || !quantiles || count < 0 )
+  {
+    MDAL::Log::error( MDAL_Status::Err_InvalidData, "Passed pointers probabilities or quantiles are not valid (null)" );
+    return;
+  }
+
+  if ( !dataset )
+  {
+    MDAL::Log::error( MDAL_Status::Err_IncompatibleDataset, "Dataset is not valid (null)" );
+    std::fill( quantiles, quantiles + count, NODATA );
+    return;
+  }
+
+  MDAL::Dataset *ds = static_cast< MDAL::Dataset * >( dataset );
+  _quantiles( *ds->histogram(), count, probabilities, quantiles );
+}
+
 bool MDAL_D_hasActiveFlagCapability( MDAL_DatasetH dataset )
 {
   if ( !dataset )
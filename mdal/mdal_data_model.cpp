@@ -7,7 +7,10 @@
 #include <assert.h>
 #include <math.h>
 #include <algorithm>
+#include <atomic>
 #include "mdal_utils.hpp"
+#include "mdal_histogram.hpp"
+#include "mdal_spatial_index.hpp"
 
 MDAL::Dataset::~Dataset() = default;
 
@@ -37,14 +40,211 @@ size_t MDAL::Dataset::activeData( size_t, size_t, int * )
   return 0;
 }
 
+size_t MDAL::Dataset::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( scalarData( indices[i], 1, buffer + i ) != 1 )
+      return i;
+  }
+  return count;
+}
+
+size_t MDAL::Dataset::vectorDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( vectorData( indices[i], 1, buffer + 2 * i ) != 1 )
+      return i;
+  }
+  return count;
+}
+
+const void *MDAL::Dataset::dataView( MDAL_DataType, size_t &count ) const
+{
+  count = 0;
+  return nullptr;
+}
+
+size_t MDAL::Dataset::valuesAtPoints( size_t count, const double *coordinates, double *buffer )
+{
+  const MDAL_DataLocation location = group()->dataLocation();
+  const bool isScalar = group()->isScalar();
+  const size_t valuesPerItem = isScalar ? 1 : 2;
+  std::fill( buffer, buffer + count * valuesPerItem, std::numeric_limits<double>::quiet_NaN() );
+
+  if ( location != MDAL_DataLocation::DataOnVertices && location != MDAL_DataLocation::DataOnFaces )
+    return 0;
+
+  // values and active flags of the whole dataset, without copy when stored in memory
+  const size_t valuesCount = this->valuesCount();
+  if ( valuesCount == 0 )
+    return 0;
+
+  size_t viewCount = 0;
+  const double *values = static_cast<const double *>( dataView( isScalar ? MDAL_DataType::SCALAR_DOUBLE : MDAL_DataType::VECTOR_2D_DOUBLE, viewCount ) );
+  std::vector<double> valuesBuffer;
+  if ( !values || viewCount != valuesCount )
+  {
+    valuesBuffer.resize( valuesCount * valuesPerItem );
+    const size_t read = isScalar ? scalarData( 0, valuesCount, valuesBuffer.data() ) : vectorData( 0, valuesCount, valuesBuffer.data() );
+    if ( read != valuesCount )
+      return 0;
+    values = valuesBuffer.data();
+  }
+
+  const int *active = nullptr;
+  std::vector<int> activeBuffer;
+  if ( supportsActiveFlag() )
+  {
+    const size_t facesCount = mesh()->facesCount();
+    active = static_cast<const int *>( dataView( MDAL_DataType::ACTIVE_INTEGER, viewCount ) );
+    if ( !active || viewCount != facesCount )
+    {
+      activeBuffer.resize( facesCount );
+      if ( activeData( 0, facesCount, activeBuffer.data() ) != facesCount )
+        return 0;
+      active = activeBuffer.data();
+    }
+  }
+
+  std::shared_ptr<const MeshSpatialIndex> index = mesh()->spatialIndex();
+  std::atomic<size_t> located( 0 );
+
+  parallelFor( count, 1 << 14, [&]( size_t begin, size_t end )
+  {
+    // points are located by blocks, then the values of the block are interpolated in one loop without branch,
+    // points outside the mesh or in inactive faces get NaN weights
+    const size_t blockSize = 256;
+    size_t vertexIndexes[blockSize * 3];
+    double weights[blockSize * 3];
+    size_t threadLocated = 0;
+
+    for ( size_t blockStart = begin; blockStart < end; blockStart += blockSize )
+    {
+      const size_t blockCount = std::min( blockSize, end - blockStart );
+      const double *blockCoordinates = coordinates + blockStart * 2;
+      double *blockBuffer = buffer + blockStart * valuesPerItem;
+
+      for ( size_t i = 0; i < blockCount; ++i )
+      {
+        const double x = blockCoordinates[i * 2];
+        const double y = blockCoordinates[i * 2 + 1];
+        int64_t faceIndex;
+        if ( location == MDAL_DataLocation::DataOnVertices )
+        {
+          faceIndex = index->interpolationAt( x, y, vertexIndexes + i * 3, weights + i * 3 );
+        }
+        else
+        {
+          faceIndex = index->faceAt( x, y );
+          vertexIndexes[i * 3] = static_cast<size_t>( faceIndex );
+          weights[i * 3] = 1;
+        }
+
+        if ( faceIndex < 0 || ( active && active[faceIndex] == 0 ) )
+        {
+          vertexIndexes[i * 3] = vertexIndexes[i * 3 + 1] = vertexIndexes[i * 3 + 2] = 0;
+          weights[i * 3] = weights[i * 3 + 1] = weights[i * 3 + 2] = std::numeric_limits<double>::quiet_NaN();
+        }
+        else
+        {
+          ++threadLocated;
+        }
+      }
+
+      if ( location == MDAL_DataLocation::DataOnFaces )
+      {
+        for ( size_t i = 0; i < blockCount; ++i )
+          for ( size_t j = 0; j < valuesPerItem; ++j )
+            blockBuffer[i * valuesPerItem + j] = weights[i * 3] * values[vertexIndexes[i * 3] * valuesPerItem + j];
+      }
+      else
+      {
+        for ( size_t i = 0; i < blockCount; ++i )
+          for ( size_t j = 0; j < valuesPerItem; ++j )
+            blockBuffer[i * valuesPerItem + j] = weights[i * 3] * values[vertexIndexes[i * 3] * valuesPerItem + j] +
+                                                 weights[i * 3 + 1] * values[vertexIndexes[i * 3 + 1] * valuesPerItem + j] +
+                                                 weights[i * 3 + 2] * values[vertexIndexes[i * 3 + 2] * valuesPerItem + j];
+      }
+    }
+
+    located += threadLocated;
+  } );
+
+  return located;
+}
+
+bool MDAL::Dataset::supportsConcurrentReads() const
+{
+  return true;
+}
+
 MDAL::Statistics MDAL::Dataset::statistics() const
 {
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  if ( !mHasStatistics )
+  {
+    // reading the values does not modify the dataset. The histogram is computed in the same read,
+    // so it does not need to read the values again
+    std::shared_ptr<Histogram> histogram;
+    if ( !mHistogram )
+      histogram = std::make_shared<Histogram>();
+    mStatistics = MDAL::calculateStatistics( const_cast<Dataset *>( this ), histogram.get() );
+    mHasStatistics = true;
+    if ( histogram )
+      mHistogram = histogram;
+  }
   return mStatistics;
 }
 
 void MDAL::Dataset::setStatistics( const MDAL::Statistics &statistics )
 {
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
   mStatistics = statistics;
+  mHasStatistics = true;
+}
+
+void MDAL::Dataset::invalidateStatistics()
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  mHasStatistics = false;
+  mHistogram.reset();
+}
+
+bool MDAL::Dataset::hasStatistics() const
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  return mHasStatistics;
+}
+
+std::shared_ptr<const MDAL::Histogram> MDAL::Dataset::histogram() const
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  if ( !mHistogram )
+  {
+    std::shared_ptr<Histogram> histogram = std::make_shared<Histogram>();
+    const Statistics statistics = MDAL::calculateStatistics( const_cast<Dataset *>( this ), histogram.get() );
+    if ( !mHasStatistics )
+    {
+      mStatistics = statistics;
+      mHasStatistics = true;
+    }
+    mHistogram = histogram;
+  }
+  return mHistogram;
+}
+
+void MDAL::Dataset::setHistogram( std::shared_ptr<const MDAL::Histogram> histogram )
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  mHistogram = histogram;
+}
+
+bool MDAL::Dataset::hasHistogram() const
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  return static_cast<bool>( mHistogram );
 }
 
 MDAL::DatasetGroup *MDAL::Dataset::group() const
@@ -220,12 +420,35 @@ void MDAL::DatasetGroup::replaceUri( std::string uri )
 
 MDAL::Statistics MDAL::DatasetGroup::statistics() const
 {
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  if ( !mHasStatistics )
+  {
+    mStatistics = MDAL::calculateStatistics( const_cast<DatasetGroup *>( this ) );
+    mHasStatistics = true;
+  }
   return mStatistics;
 }
 
 void MDAL::DatasetGroup::setStatistics( const Statistics &statistics )
 {
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
   mStatistics = statistics;
+  mHasStatistics = true;
+}
+
+void MDAL::DatasetGroup::invalidateStatistics()
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  mHasStatistics = false;
+  mHistogram.reset();
+}
+
+std::shared_ptr<const MDAL::Histogram> MDAL::DatasetGroup::histogram() const
+{
+  std::lock_guard<std::mutex> lock( mStatisticsMutex );
+  if ( !mHistogram )
+    mHistogram = std::make_shared<const Histogram>( MDAL::calculateHistogram( const_cast<DatasetGroup *>( this ) ) );
+  return mHistogram;
 }
 
 MDAL::DateTime MDAL::DatasetGroup::referenceTime() const
@@ -332,6 +555,24 @@ std::string MDAL::Mesh::driverName() const
 
 MDAL::Mesh::~Mesh() = default;
 
+int64_t MDAL::Mesh::faceAt( double x, double y )
+{
+  return spatialIndex()->faceAt( x, y );
+}
+
+size_t MDAL::Mesh::facesAt( size_t count, const double *coordinates, int64_t *faceIndexes )
+{
+  return spatialIndex()->facesAt( count, coordinates, faceIndexes );
+}
+
+std::shared_ptr<const MDAL::MeshSpatialIndex> MDAL::Mesh::spatialIndex()
+{
+  std::lock_guard<std::mutex> lock( mSpatialIndexMutex );
+  if ( !mSpatialIndex || !mSpatialIndex->isUpToDate( this ) )
+    mSpatialIndex = std::make_shared<const MeshSpatialIndex>( this );
+  return mSpatialIndex;
+}
+
 std::shared_ptr<MDAL::DatasetGroup> MDAL::Mesh::group( const std::string &name )
 {
   for ( auto grp : datasetGroups )
@@ -402,3 +643,32 @@ MDAL::MeshVertexIterator::~MeshVertexIterator() = default;
 MDAL::MeshFaceIterator::~MeshFaceIterator() = default;
 
 MDAL::MeshEdgeIterator::~MeshEdgeIterator() = default;
+
+MDAL::MeshSummary::MeshSummary( MDAL::Mesh *mesh )
+  : driverName( mesh->driverName() )
+  , uri( mesh->uri() )
+  , crs( mesh->crs() )
+  , verticesCount( mesh->verticesCount() )
+  , edgesCount( mesh->edgesCount() )
+  , facesCount( mesh->facesCount() )
+  , extent( mesh->extent() )
+{
+  for ( const std::shared_ptr<DatasetGroup> &group : mesh->datasetGroups )
+  {
+    DatasetGroupSummary groupSummary;
+    groupSummary.name = group->name();
+    groupSummary.dataLocation = group->dataLocation();
+    groupSummary.isScalar = group->isScalar();
+    groupSummary.datasetsCount = group->datasets.size();
+    groupSummary.referenceTime = group->referenceTime();
+    for ( size_t i = 0; i < group->datasets.size(); ++i )
+    {
+      const RelativeTimestamp time = group->datasets[i]->timestamp();
+      if ( i == 0 || time < groupSummary.startTime )
+        groupSummary.startTime = time;
+      if ( i == 0 || groupSummary.endTime < time )
+        groupSummary.endTime = time;
+    }
+    groups.push_back( groupSummary );
+  }
+}
@@ -12,12 +12,15 @@
 #include <map>
 #include <string>
 #include <limits>
+#include <mutex>
 #include "mdal.h"
 #include "mdal_datetime.hpp"
 
 namespace MDAL
 {
   class DatasetGroup;
+  class Histogram;
+  class MeshSpatialIndex;
   class Mesh;
 
   struct BBox
@@ -55,6 +58,33 @@ namespace MDAL
       //! For drivers that supports it, see supportsActiveFlag()
       virtual size_t activeData( size_t indexStart, size_t count, int *buffer );
 
+      /**
+       * For DataOnVertices or DataOnFaces, reads the scalar values of the \a count elements at \a indices.
+       * Default implementation reads the values one by one with scalarData()
+       */
+      virtual size_t scalarDataAt( const size_t *indices, size_t count, double *buffer );
+
+      /**
+       * For DataOnVertices or DataOnFaces, reads the vector values of the \a count elements at \a indices.
+       * Default implementation reads the values one by one with vectorData()
+       */
+      virtual size_t vectorDataAt( const size_t *indices, size_t count, double *buffer );
+
+      /**
+       * Returns a read-only pointer to the data of \a dataType stored in memory, with the same layout as the data returned
+       * by the corresponding xxxData() method, and sets \a count with the number of values.
+       * Returns nullptr if the data are not stored in memory with this layout (default implementation)
+       */
+      virtual const void *dataView( MDAL_DataType dataType, size_t &count ) const;
+
+      /**
+       * For DataOnVertices or DataOnFaces, sets in \a buffer the values of the dataset at the \a count points stored
+       * in \a coordinates in form x1, y1, ..., xN, yN, one value per point for scalar datasets and x, y pairs for vector datasets.
+       * Values on vertices are interpolated in the face containing the point, see MeshSpatialIndex::interpolationAt().
+       * Values of points outside the mesh or in inactive faces are NaN. Returns the count of points located in an active face
+       */
+      size_t valuesAtPoints( size_t count, const double *coordinates, double *buffer );
+
       //! For DataOnVolumes
       virtual size_t verticalLevelCountData( size_t indexStart, size_t count, int *buffer ) = 0;
       //! For DataOnVolumes
@@ -69,9 +99,35 @@ namespace MDAL
       virtual size_t volumesCount() const = 0;
       virtual size_t maximumVerticalLevelsCount() const = 0;
 
+      /**
+       * Returns whether the values can be read from different threads at the same time, which is the case
+       * for the drivers serializing their reads internally (default implementation returns true)
+       */
+      virtual bool supportsConcurrentReads() const;
+
+      /**
+       * Returns the statistics of the dataset. If they have not been set by the driver, they are computed
+       * from the values on first call, with the histogram, and kept until invalidateStatistics() is called
+       */
       Statistics statistics() const;
       void setStatistics( const Statistics &statistics );
 
+      //! Discards the statistics and the histogram, to be called when the values are modified
+      void invalidateStatistics();
+
+      //! Returns whether the statistics are known, set by the driver or already computed
+      bool hasStatistics() const;
+
+      /**
+       * Returns the histogram of the values, or of the magnitudes for vector datasets. It is computed with the statistics,
+       * in the same read of the values, on first call of statistics() or histogram() and kept until invalidateStatistics() is called
+       */
+      std::shared_ptr<const Histogram> histogram() const;
+      void setHistogram( std::shared_ptr<const Histogram> histogram );
+
+      //! Returns whether the histogram is known, already computed or read from the statistics cache
+      bool hasHistogram() const;
+
       bool isValid() const;
 
       DatasetGroup *group() const;
@@ -90,7 +146,10 @@ namespace MDAL
       bool mIsValid = true;
       bool mSupportsActiveFlag = false;
       DatasetGroup *mParent = nullptr;
-      Statistics mStatistics;
+      mutable Statistics mStatistics;
+      mutable bool mHasStatistics = false;
+      mutable std::shared_ptr<const Histogram> mHistogram;
+      mutable std::mutex mStatisticsMutex;
   };
 
   class Dataset2D: public Dataset
@@ -169,9 +228,19 @@ namespace MDAL
       std::string uri() const;
       void replaceUri( std::string uri );
 
+      /**
+       * Returns the statistics of the group. If they have not been set by the driver, they are combined
+       * from the statistics of the datasets on first call and kept until invalidateStatistics() is called
+       */
       Statistics statistics() const;
       void setStatistics( const Statistics &statistics );
 
+      //! Discards the statistics and the histogram, to be called when datasets are added, removed or modified
+      void invalidateStatistics();
+
+      //! Returns the histogram of the values of all the datasets, merged from the histograms of the datasets on first call
+      std::shared_ptr<const Histogram> histogram() const;
+
       DateTime referenceTime() const;
       void setReferenceTime( const DateTime &referenceTime );
 
@@ -199,7 +268,10 @@ namespace MDAL
       std::pair<double, double> mReferenceAngles = {-360, 0}; //default full rotation is negative to be consistent with usual geographical clockwise
       MDAL_DataLocation mDataLocation = MDAL_DataLocation::DataOnVertices;
       std::string mUri; // file/uri from where it came
-      Statistics mStatistics;
+      mutable Statistics mStatistics;
+      mutable bool mHasStatistics = false;
+      mutable std::shared_ptr<const Histogram> mHistogram;
+      mutable std::mutex mStatisticsMutex;
       DateTime mReferenceTime;
   };
 
@@ -274,6 +346,27 @@ namespace MDAL
       virtual void addVertices( size_t vertexCount, double *coordinates );
       virtual void addFaces( size_t faceCount, size_t driverMaxVerticesPerFace, int *faceSizes, int *vertexIndices );
 
+      /**
+       * Returns a read-only pointer to the vertex coordinates stored in memory in form x1, y1, z1, ..., xN, yN, zN.
+       * Returns nullptr if the vertices are not stored in memory with this layout (default implementation)
+       */
+      virtual const double *verticesView() const {return nullptr;}
+
+      /**
+       * Returns the index of the face containing the point (\a x, \a y), or -1 if no face contains it.
+       * The spatial index of the faces is built on first call and rebuilt if the mesh has been modified
+       */
+      int64_t faceAt( double x, double y );
+
+      /**
+       * Sets in \a faceIndexes the index of the face containing each of the \a count points stored in \a coordinates
+       * in form x1, y1, ..., xN, yN, or -1 for points outside the mesh. Returns the count of points located in a face
+       */
+      size_t facesAt( size_t count, const double *coordinates, int64_t *faceIndexes );
+
+      //! Returns the spatial index of the faces, builds it if it does not exist or is out of date
+      virtual std::shared_ptr<const MeshSpatialIndex> spatialIndex();
+
     protected:
       void setFaceVerticesMaximumCount( const size_t &faceVerticesMaximumCount );
 
@@ -282,6 +375,41 @@ namespace MDAL
       size_t mFaceVerticesMaximumCount = 0; //typically 3 or 4, sometimes up to 9
       const std::string mUri; // file/uri from where it came
       std::string mCrs;
+
+      std::shared_ptr<const MeshSpatialIndex> mSpatialIndex;
+      std::mutex mSpatialIndexMutex;
+  };
+
+  //! Summary of a dataset group, see MeshSummary
+  struct DatasetGroupSummary
+  {
+    std::string name;
+    MDAL_DataLocation dataLocation = MDAL_DataLocation::DataInvalidLocation;
+    bool isScalar = true;
+    size_t datasetsCount = 0;
+    RelativeTimestamp startTime; //!< earliest time of the datasets
+    RelativeTimestamp endTime; //!< latest time of the datasets
+    DateTime referenceTime;
+  };
+
+  /**
+   * Description of a mesh and of its dataset groups without the topology and the values, see Driver::loadSummary()
+   */
+  struct MeshSummary
+  {
+    MeshSummary() = default;
+
+    //! Builds the summary of the loaded \a mesh
+    explicit MeshSummary( Mesh *mesh );
+
+    std::string driverName;
+    std::string uri;
+    std::string crs;
+    size_t verticesCount = 0;
+    size_t edgesCount = 0;
+    size_t facesCount = 0;
+    BBox extent;
+    std::vector<DatasetGroupSummary> groups;
   };
 } // namespace MDAL
 #endif //MDAL_DATA_MODEL_HPP
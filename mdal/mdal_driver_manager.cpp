@@ -14,6 +14,7 @@
 #include "frmts/mdal_ply.hpp"
 #include "frmts/mdal_dynamic_driver.hpp"
 #include "mdal_utils.hpp"
+#include "mdal_statistics_cache.hpp"
 
 #ifdef HAVE_HDF5
 #include "frmts/mdal_xmdf.hpp"
@@ -79,7 +80,9 @@ std::string MDAL::DriverManager::getUris( const std::string &file, const std::st
   return std::string();
 }
 
-std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load( const std::string &meshFile, const std::string &meshName ) const
+std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load( const std::string &meshFile,
+    const std::string &meshName,
+    const OpenOptions &options ) const
 {
   std::unique_ptr<MDAL::Mesh> mesh;
 
@@ -95,6 +98,7 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load( const std::string &meshFi
          driver->canReadMesh( meshFile ) )
     {
       std::unique_ptr<MDAL::Driver> drv( driver->create() );
+      drv->setOpenOptions( options );
 
       mesh = drv->load( meshFile, meshName );
       if ( mesh ) // stop if he have the mesh
@@ -103,7 +107,14 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load( const std::string &meshFi
   }
 
   if ( !mesh )
+  {
     MDAL::Log::error( MDAL_Status::Err_UnknownFormat, "Unable to load mesh (null)" );
+  }
+  else
+  {
+    options.filterDatasetGroups( mesh->datasetGroups );
+    StatisticsCache::apply( mesh->datasetGroups );
+  }
 
   return mesh;
 }
@@ -111,7 +122,8 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load( const std::string &meshFi
 std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load(
   const std::string &driverName,
   const std::string &meshFile,
-  const std::string &meshName ) const
+  const std::string &meshName,
+  const OpenOptions &options ) const
 {
   std::unique_ptr<MDAL::Mesh> mesh;
 
@@ -130,12 +142,18 @@ std::unique_ptr<MDAL::Mesh> MDAL::DriverManager::load(
   }
 
   std::unique_ptr<Driver> drv( requestedDriver->create() );
+  drv->setOpenOptions( options );
   mesh = drv->load( meshFile, meshName );
+  if ( mesh )
+  {
+    options.filterDatasetGroups( mesh->datasetGroups );
+    StatisticsCache::apply( mesh->datasetGroups );
+  }
 
   return mesh;
 }
 
-void MDAL::DriverManager::loadDatasets( Mesh *mesh, const std::string &datasetFile ) const
+void MDAL::DriverManager::loadDatasets( Mesh *mesh, const std::string &datasetFile, const OpenOptions &options ) const
 {
   if ( !MDAL::fileExists( datasetFile ) )
   {
@@ -155,7 +173,11 @@ void MDAL::DriverManager::loadDatasets( Mesh *mesh, const std::string &datasetFi
          driver->canReadDatasets( datasetFile ) )
     {
       std::unique_ptr<Driver> drv( driver->create() );
+      drv->setOpenOptions( options );
+      const size_t groupsCount = mesh->datasetGroups.size();
       drv->load( datasetFile, mesh );
+      options.filterDatasetGroups( mesh->datasetGroups, groupsCount );
+      StatisticsCache::apply( mesh->datasetGroups, groupsCount );
       return;
     }
   }
@@ -163,6 +185,59 @@ void MDAL::DriverManager::loadDatasets( Mesh *mesh, const std::string &datasetFi
   MDAL::Log::error( MDAL_Status::Err_UnknownFormat, "No driver was able to load requested file: " + datasetFile );
 }
 
+std::unique_ptr<MDAL::MeshSummary> MDAL::DriverManager::loadSummary( const std::string &meshFile, const std::string &meshName ) const
+{
+  std::unique_ptr<MDAL::MeshSummary> summary;
+
+  if ( !MDAL::fileExists( meshFile ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_FileNotFound, "File " + meshFile + " could not be found" );
+    return summary;
+  }
+
+  for ( const auto &driver : mDrivers )
+  {
+    if ( ( driver->hasCapability( Capability::ReadMesh ) ) &&
+         driver->canReadMesh( meshFile ) )
+    {
+      std::unique_ptr<MDAL::Driver> drv( driver->create() );
+
+      summary = drv->loadSummary( meshFile, meshName );
+      if ( summary ) // stop if he have the mesh
+        break;
+    }
+  }
+
+  if ( !summary )
+    MDAL::Log::error( MDAL_Status::Err_UnknownFormat, "Unable to load mesh summary (null)" );
+
+  return summary;
+}
+
+std::unique_ptr<MDAL::MeshSummary> MDAL::DriverManager::loadSummary(
+  const std::string &driverName,
+  const std::string &meshFile,
+  const std::string &meshName ) const
+{
+  std::unique_ptr<MDAL::MeshSummary> summary;
+
+  if ( !MDAL::fileExists( meshFile ) )
+  {
+    MDAL::Log::error( MDAL_Status::Err_FileNotFound, "File " + meshFile + " could not be found" );
+    return summary;
+  }
+
+  std::shared_ptr<MDAL::Driver> requestedDriver = driver( driverName );
+  if ( !requestedDriver )
+  {
+    MDAL::Log::error( MDAL_Status::Err_MissingDriver, "Could not find driver with name: " + driverName );
+    return summary;
+  }
+
+  std::unique_ptr<Driver> drv( requestedDriver->create() );
+  return drv->loadSummary( meshFile, meshName );
+}
+
 void MDAL::DriverManager::save( MDAL::Mesh *mesh, const std::string &uri, const std::string &driverName ) const
 {
   auto selectedDriver = driver( driverName );
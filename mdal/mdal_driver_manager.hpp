@@ -14,6 +14,7 @@
 #include "mdal.h"
 #include "mdal_data_model.hpp"
 #include "mdal_logger.hpp"
+#include "mdal_open_options.hpp"
 #include "frmts/mdal_driver.hpp"
 
 namespace MDAL
@@ -32,11 +33,20 @@ namespace MDAL
 
       std::string getUris( const std::string &file, const std::string &driverName = "" ) const;
 
-      std::unique_ptr< Mesh > load( const std::string &meshFile, const std::string &meshName ) const;
+      std::unique_ptr< Mesh > load( const std::string &meshFile,
+                                    const std::string &meshName,
+                                    const OpenOptions &options = OpenOptions() ) const;
       std::unique_ptr< Mesh > load( const std::string &driverName,
                                     const std::string &meshFile,
-                                    const std::string &meshName ) const;
-      void loadDatasets( Mesh *mesh, const std::string &datasetFile ) const;
+                                    const std::string &meshName,
+                                    const OpenOptions &options = OpenOptions() ) const;
+      void loadDatasets( Mesh *mesh, const std::string &datasetFile, const OpenOptions &options = OpenOptions() ) const;
+
+      //! Loads the summary of the mesh, see Driver::loadSummary()
+      std::unique_ptr< MeshSummary > loadSummary( const std::string &meshFile, const std::string &meshName ) const;
+      std::unique_ptr< MeshSummary > loadSummary( const std::string &driverName,
+          const std::string &meshFile,
+          const std::string &meshName ) const;
 
       void save( Mesh *mesh, const std::string &uri, const std::string &driver ) const;
 
@@ -0,0 +1,272 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#include "mdal_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+const size_t MDAL::Histogram::BINS_COUNT;
+
+// limits of the bin width exponent, so that the width, its inverse and the range of the bins are finite
+static const int MIN_EXPONENT = -1000;
+static const int MAX_EXPONENT = 1000;
+
+static bool isFinite( double value )
+{
+  return std::abs( value ) <= std::numeric_limits<double>::max();
+}
+
+static double magnitude( const double *values, size_t i, bool isVector )
+{
+  if ( isVector )
+    return std::sqrt( values[2 * i] * values[2 * i] + values[2 * i + 1] * values[2 * i + 1] );
+  return values[i];
+}
+
+//! Returns the exponent of the smallest power of two bin width covering [ minimum, maximum ] with the bins
+static int exponentFor( double minimum, double maximum )
+{
+  const double range = maximum - minimum;
+  double width = range / MDAL::Histogram::BINS_COUNT;
+  if ( !( width > 0 ) )
+    width = std::max( std::abs( minimum ), 1.0 ) * 1e-12; // single value
+  if ( !isFinite( width ) )
+    return MAX_EXPONENT;
+
+  return std::max( MIN_EXPONENT, std::min( MAX_EXPONENT, std::ilogb( width ) + 1 ) );
+}
+
+static double alignedOrigin( double minimum, int exponent )
+{
+  return std::ldexp( std::floor( std::ldexp( minimum, -exponent ) ), exponent );
+}
+
+double MDAL::Histogram::binWidth() const
+{
+  return std::ldexp( 1.0, mExponent );
+}
+
+size_t MDAL::Histogram::binIndex( double value ) const
+{
+  const double index = std::ldexp( value - mOrigin, -mExponent );
+  if ( !( index > 0 ) )
+    return 0;
+  return std::min( BINS_COUNT - 1, static_cast<size_t>( index ) );
+}
+
+void MDAL::Histogram::extend( double minimum, double maximum, int minExponent )
+{
+  if ( mCounts.empty() )
+  {
+    mExponent = std::max( minExponent, exponentFor( minimum, maximum ) );
+    mOrigin = alignedOrigin( minimum, mExponent );
+    while ( mExponent < MAX_EXPONENT && maximum >= mOrigin + BINS_COUNT * binWidth() )
+    {
+      ++mExponent;
+      mOrigin = alignedOrigin( minimum, mExponent );
+    }
+    mCounts.assign( BINS_COUNT, 0 );
+    return;
+  }
+
+  if ( minExponent <= mExponent && minimum >= mOrigin && maximum < mOrigin + BINS_COUNT * binWidth() )
+    return;
+
+  // the new bins are sized for the range of the values, not of the current bins, so the width does not grow
+  // more than needed when extended many times. The new width being a multiple of the current one, with aligned
+  // bins, each current bin is included in a new bin
+  const double oldOrigin = mOrigin;
+  const double oldWidth = binWidth();
+  minimum = std::min( minimum, mMinimum );
+  maximum = std::max( maximum, mMaximum );
+
+  int exponent = std::max( std::max( minExponent, mExponent ), exponentFor( minimum, maximum ) );
+  double origin = alignedOrigin( minimum, exponent );
+  while ( exponent < MAX_EXPONENT && maximum >= origin + BINS_COUNT * std::ldexp( 1.0, exponent ) )
+  {
+    ++exponent;
+    origin = alignedOrigin( minimum, exponent );
+  }
+
+  std::vector<uint64_t> oldCounts( BINS_COUNT, 0 );
+  oldCounts.swap( mCounts );
+  mExponent = exponent;
+  mOrigin = origin;
+  for ( size_t i = 0; i < BINS_COUNT; ++i )
+  {
+    if ( oldCounts[i] )
+      mCounts[binIndex( oldOrigin + static_cast<double>( i ) * oldWidth )] += oldCounts[i];
+  }
+}
+
+void MDAL::Histogram::addValues( const double *values, size_t count, bool isVector )
+{
+  // range of the finite values, to extend the bins once for all the values
+  double minimum = std::numeric_limits<double>::max();
+  double maximum = -std::numeric_limits<double>::max();
+  for ( size_t i = 0; i < count; ++i )
+  {
+    const double value = magnitude( values, i, isVector );
+    if ( !isFinite( value ) )
+      continue;
+    minimum = std::min( minimum, value );
+    maximum = std::max( maximum, value );
+  }
+
+  if ( minimum > maximum )
+    return; // no finite value
+
+  extend( minimum, maximum, MIN_EXPONENT );
+
+  uint64_t added = 0;
+  for ( size_t i = 0; i < count; ++i )
+  {
+    const double value = magnitude( values, i, isVector );
+    if ( !isFinite( value ) )
+      continue;
+    ++mCounts[binIndex( value )];
+    ++added;
+  }
+
+  if ( mValuesCount == 0 )
+  {
+    mMinimum = minimum;
+    mMaximum = maximum;
+  }
+  else
+  {
+    mMinimum = std::min( mMinimum, minimum );
+    mMaximum = std::max( mMaximum, maximum );
+  }
+  mValuesCount += added;
+}
+
+void MDAL::Histogram::merge( const MDAL::Histogram &other )
+{
+  if ( other.mValuesCount == 0 )
+    return;
+
+  if ( mValuesCount == 0 )
+  {
+    *this = other;
+    return;
+  }
+
+  const double otherWidth = other.binWidth();
+  extend( other.mMinimum, other.mMaximum, other.mExponent );
+  for ( size_t i = 0; i < BINS_COUNT; ++i )
+  {
+    if ( other.mCounts[i] )
+      mCounts[binIndex( other.mOrigin + static_cast<double>( i ) * otherWidth )] += other.mCounts[i];
+  }
+
+  mMinimum = std::min( mMinimum, other.mMinimum );
+  mMaximum = std::max( mMaximum, other.mMaximum );
+  mValuesCount += other.mValuesCount;
+}
+
+double MDAL::Histogram::quantile( double probability ) const
+{
+  if ( mValuesCount == 0 || std::isnan( probability ) )
+    return std::numeric_limits<double>::quiet_NaN();
+
+  probability = std::max( 0.0, std::min( 1.0, probability ) );
+  const double rank = probability * static_cast<double>( mValuesCount );
+  const double width = binWidth();
+
+  // values are considered evenly spread in their bin
+  double cumulated = 0;
+  double ret = mMaximum;
+  for ( size_t i = 0; i < BINS_COUNT; ++i )
+  {
+    if ( mCounts[i] == 0 )
+      continue;
+
+    const double binCount = static_cast<double>( mCounts[i] );
+    if ( cumulated + binCount >= rank )
+    {
+      ret = mOrigin + ( static_cast<double>( i ) + ( rank - cumulated ) / binCount ) * width;
+      break;
+    }
+    cumulated += binCount;
+  }
+
+  return std::max( mMinimum, std::min( mMaximum, ret ) );
+}
+
+void MDAL::Histogram::counts( double minimum, double maximum, size_t binCount, uint64_t *counts ) const
+{
+  std::fill( counts, counts + binCount, 0 );
+  if ( binCount == 0 || mValuesCount == 0 || !( minimum <= maximum ) )
+    return;
+
+  const double width = binWidth();
+  const double requestedWidth = ( maximum - minimum ) / static_cast<double>( binCount );
+  for ( size_t i = 0; i < BINS_COUNT; ++i )
+  {
+    if ( mCounts[i] == 0 )
+      continue;
+
+    // middle of the part of the bin containing values
+    const double binStart = std::max( mMinimum, mOrigin + static_cast<double>( i ) * width );
+    const double binEnd = std::min( mMaximum, mOrigin + static_cast<double>( i + 1 ) * width );
+    const double middle = ( binStart + binEnd ) / 2;
+    if ( middle < minimum || middle > maximum )
+      continue;
+
+    size_t index = binCount - 1;
+    if ( requestedWidth > 0 )
+      index = std::min( binCount - 1, static_cast<size_t>( ( middle - minimum ) / requestedWidth ) );
+    counts[index] += mCounts[i];
+  }
+}
+
+void MDAL::Histogram::write( std::ostream &out ) const
+{
+  const int32_t exponent = mExponent;
+  out.write( reinterpret_cast<const char *>( &mValuesCount ), sizeof( uint64_t ) );
+  if ( mValuesCount == 0 )
+    return;
+
+  out.write( reinterpret_cast<const char *>( &exponent ), sizeof( int32_t ) );
+  out.write( reinterpret_cast<const char *>( &mOrigin ), sizeof( double ) );
+  out.write( reinterpret_cast<const char *>( &mMinimum ), sizeof( double ) );
+  out.write( reinterpret_cast<const char *>( &mMaximum ), sizeof( double ) );
+  out.write( reinterpret_cast<const char *>( mCounts.data() ), static_cast<std::streamsize>( BINS_COUNT * sizeof( uint64_t ) ) );
+}
+
+bool MDAL::Histogram::read( std::istream &in )
+{
+  *this = Histogram();
+
+  uint64_t valuesCount;
+  in.read( reinterpret_cast<char *>( &valuesCount ), sizeof( uint64_t ) );
+  if ( !in )
+    return false;
+  if ( valuesCount == 0 )
+    return true;
+
+  int32_t exponent;
+  std::vector<uint64_t> counts( BINS_COUNT );
+  in.read( reinterpret_cast<char *>( &exponent ), sizeof( int32_t ) );
+  in.read( reinterpret_cast<char *>( &mOrigin ), sizeof( double ) );
+  in.read( reinterpret_cast<char *>( &mMinimum ), sizeof( double ) );
+  in.read( reinterpret_cast<char *>( &mMaximum ), sizeof( double ) );
+  in.read( reinterpret_cast<char *>( counts.data() ), static_cast<std::streamsize>( BINS_COUNT * sizeof( uint64_t ) ) );
+  if ( !in || exponent < MIN_EXPONENT || exponent > MAX_EXPONENT )
+  {
+    *this = Histogram();
+    return false;
+  }
+
+  mExponent = exponent;
+  mCounts.swap( counts );
+  mValuesCount = valuesCount;
+  return true;
+}
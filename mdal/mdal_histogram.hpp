@@ -0,0 +1,75 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#ifndef MDAL_HISTOGRAM_HPP
+#define MDAL_HISTOGRAM_HPP
+
+#include <iosfwd>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace MDAL
+{
+  /**
+   * Histogram of values built in a single pass, without knowing the range of the values in advance
+   *
+   * The histogram has BINS_COUNT bins whose width is a power of two and whose limits are multiples of this width.
+   * When values fall outside of the bins, the width is increased and the bins are merged, each bin being included
+   * in a bin of the new width. So histograms of different values can be merged whatever their ranges.
+   *
+   * The bins are sized for the minimum and maximum of the values added, so the bin width is at most 4 times the range
+   * of the values divided by BINS_COUNT, whatever the order the values are added or the histograms merged in.
+   * Quantiles and histograms with other bins derived from it are accurate to this width. NaN and infinite values are ignored.
+   */
+  class Histogram
+  {
+    public:
+      static const size_t BINS_COUNT = 1024;
+
+      //! Adds \a count values, or the magnitudes of \a count x/y pairs if \a isVector
+      void addValues( const double *values, size_t count, bool isVector );
+
+      //! Adds the values of \a other
+      void merge( const Histogram &other );
+
+      //! Returns the count of values added
+      uint64_t valuesCount() const {return mValuesCount;}
+
+      //! Returns the value under which the values are with \a probability (between 0 and 1), NaN if there is no value
+      double quantile( double probability ) const;
+
+      /**
+       * Sets in \a counts the count of values in each of the \a binCount bins of equal width between \a minimum and \a maximum,
+       * \a maximum being included in the last bin. The values of a bin of the histogram are counted in the bin containing its middle
+       */
+      void counts( double minimum, double maximum, size_t binCount, uint64_t *counts ) const;
+
+      //! Writes the histogram to \a out, in the native byte order
+      void write( std::ostream &out ) const;
+
+      //! Reads a histogram written with write() from \a in, returns false if it is not valid
+      bool read( std::istream &in );
+
+    private:
+      //! Width of the bins
+      double binWidth() const;
+
+      //! Returns the index of the bin of the finite \a value included in the range of the bins
+      size_t binIndex( double value ) const;
+
+      //! Moves or widens the bins so they include [ \a minimum, \a maximum ] and the values added, with a width of at least 2^\a minExponent
+      void extend( double minimum, double maximum, int minExponent );
+
+      std::vector<uint64_t> mCounts; // empty until a value is added
+      int mExponent = 0; // bin width is 2^mExponent
+      double mOrigin = 0; // start of the first bin, multiple of the bin width
+      uint64_t mValuesCount = 0;
+      double mMinimum = 0;
+      double mMaximum = 0;
+  };
+
+} // namespace MDAL
+#endif //MDAL_HISTOGRAM_HPP
@@ -4,21 +4,24 @@
 */
 
 #include <iostream>
+#include <atomic>
 
 #include "mdal_logger.hpp"
 
 // Standard output for logger
 void _standardStdout( MDAL_LogLevel logLevel, MDAL_Status status, const char *mssg );
 
-static MDAL_Status sLastStatus;
-static MDAL_LoggerCallback sLoggerCallback = &_standardStdout;
-static MDAL_LogLevel sLogVerbosity = MDAL_LogLevel::Error;
+// the status is kept per thread, as datasets can be read from different threads
+static thread_local MDAL_Status sLastStatus = MDAL_Status::None;
+static std::atomic<MDAL_LoggerCallback> sLoggerCallback( &_standardStdout );
+static std::atomic<MDAL_LogLevel> sLogVerbosity( MDAL_LogLevel::Error );
 
 void _log( MDAL_LogLevel logLevel, MDAL_Status status, std::string mssg )
 {
-  if ( sLoggerCallback && logLevel <= sLogVerbosity )
+  MDAL_LoggerCallback callback = sLoggerCallback;
+  if ( callback && logLevel <= sLogVerbosity )
   {
-    sLoggerCallback( logLevel, status, mssg.c_str() );
+    callback( logLevel, status, mssg.c_str() );
   }
 }
 
@@ -75,6 +78,11 @@ void MDAL::Log::resetLastStatus()
   sLastStatus = MDAL_Status::None;
 }
 
+void MDAL::Log::setLastStatus( MDAL_Status status )
+{
+  sLastStatus = status;
+}
+
 void MDAL::Log::setLoggerCallback( MDAL_LoggerCallback callback )
 {
   sLoggerCallback = callback;
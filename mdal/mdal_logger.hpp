@@ -30,8 +30,11 @@ namespace MDAL
     void info( std::string mssg );
     void debug( std::string mssg );
 
+    //! Returns the last status set in the calling thread
     MDAL_Status getLastStatus();
     void resetLastStatus();
+    //! Sets the last status of the calling thread without logging, e.g. to report a failure of a worker thread
+    void setLastStatus( MDAL_Status status );
 
     void setLoggerCallback( MDAL_LoggerCallback callback );
     void setLogVerbosity( MDAL_LogLevel verbosity );
@@ -8,16 +8,102 @@
 #include <cmath>
 #include <cstring>
 #include <algorithm>
-#include <iterator>
 #include "mdal_utils.hpp"
 #include "mdal_logger.hpp"
 #include "mdal.h"
 
-MDAL::MemoryDataset2D::MemoryDataset2D( MDAL::DatasetGroup *grp, bool hasActiveFlag )
+MDAL::Faces::Faces()
+  : mOffsets( 1, 0 )
+{
+}
+
+void MDAL::Faces::reserve( size_t faceCount, size_t vertexIndicesCount )
+{
+  mOffsets.reserve( faceCount + 1 );
+  if ( mIsWide )
+    mIndices64.reserve( vertexIndicesCount );
+  else
+    mIndices32.reserve( vertexIndicesCount );
+}
+
+void MDAL::Faces::addFace( const size_t *vertexIndices, size_t faceSize )
+{
+  for ( size_t i = 0; i < faceSize; ++i )
+    pushVertexIndex( vertexIndices[i] );
+
+  mOffsets.push_back( mOffsets.back() + faceSize );
+}
+
+void MDAL::Faces::append( const MDAL::Faces &other )
+{
+  if ( other.mIsWide && !mIsWide )
+    widen();
+
+  const size_t start = vertexIndicesCount();
+  mOffsets.reserve( mOffsets.size() + other.size() );
+  for ( size_t i = 1; i < other.mOffsets.size(); ++i )
+    mOffsets.push_back( start + other.mOffsets[i] );
+
+  if ( mIsWide && other.mIsWide )
+    mIndices64.insert( mIndices64.end(), other.mIndices64.begin(), other.mIndices64.end() );
+  else if ( mIsWide )
+    mIndices64.insert( mIndices64.end(), other.mIndices32.begin(), other.mIndices32.end() );
+  else
+    mIndices32.insert( mIndices32.end(), other.mIndices32.begin(), other.mIndices32.end() );
+}
+
+void MDAL::Faces::setVertexIndex( size_t faceIndex, size_t position, size_t vertexIndex )
+{
+  assert( position < faceSize( faceIndex ) );
+  if ( !mIsWide && vertexIndex > std::numeric_limits<uint32_t>::max() )
+    widen();
+
+  const size_t i = mOffsets[faceIndex] + position;
+  if ( mIsWide )
+    mIndices64[i] = vertexIndex;
+  else
+    mIndices32[i] = static_cast<uint32_t>( vertexIndex );
+}
+
+MDAL::Face MDAL::Faces::face( size_t faceIndex ) const
+{
+  const size_t count = faceSize( faceIndex );
+  Face f( count );
+  for ( size_t i = 0; i < count; ++i )
+    f[i] = vertexIndex( faceIndex, i );
+  return f;
+}
+
+void MDAL::Faces::pushVertexIndex( size_t vertexIndex )
+{
+  if ( !mIsWide && vertexIndex > std::numeric_limits<uint32_t>::max() )
+    widen();
+
+  if ( mIsWide )
+    mIndices64.push_back( vertexIndex );
+  else
+    mIndices32.push_back( static_cast<uint32_t>( vertexIndex ) );
+}
+
+void MDAL::Faces::widen()
+{
+  assert( !mIsWide );
+  mIndices64.reserve( std::max( mIndices32.capacity(), mIndices32.size() + 1 ) );
+  mIndices64.assign( mIndices32.begin(), mIndices32.end() );
+  std::vector<uint32_t>().swap( mIndices32 );
+  mIsWide = true;
+}
+
+MDAL::MemoryDataset2D::MemoryDataset2D( MDAL::DatasetGroup *grp, bool hasActiveFlag, bool singlePrecision )
   : Dataset2D( grp )
-  , mValues( group()->isScalar() ? valuesCount() : 2 * valuesCount(),
-             std::numeric_limits<double>::quiet_NaN() )
+  , mSinglePrecision( singlePrecision )
 {
+  const size_t size = group()->isScalar() ? valuesCount() : 2 * valuesCount();
+  if ( mSinglePrecision )
+    mFloatValues.resize( size, std::numeric_limits<float>::quiet_NaN() );
+  else
+    mValues.resize( size, std::numeric_limits<double>::quiet_NaN() );
+
   setSupportsActiveFlag( hasActiveFlag );
   if ( hasActiveFlag )
   {
@@ -41,6 +127,60 @@ size_t MDAL::MemoryDataset2D::activeData( size_t indexStart, size_t count, int *
   return copyValues;
 }
 
+size_t MDAL::MemoryDataset2D::scalarDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( group()->isScalar() ); //checked in C API interface
+  size_t nValues = valuesCount();
+
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( indices[i] >= nValues )
+      return i;
+    buffer[i] = value( indices[i] );
+  }
+  return count;
+}
+
+size_t MDAL::MemoryDataset2D::vectorDataAt( const size_t *indices, size_t count, double *buffer )
+{
+  assert( !group()->isScalar() ); //checked in C API interface
+  size_t nValues = valuesCount();
+
+  for ( size_t i = 0; i < count; ++i )
+  {
+    if ( indices[i] >= nValues )
+      return i;
+    buffer[2 * i] = value( 2 * indices[i] );
+    buffer[2 * i + 1] = value( 2 * indices[i] + 1 );
+  }
+  return count;
+}
+
+const void *MDAL::MemoryDataset2D::dataView( MDAL_DataType dataType, size_t &count ) const
+{
+  count = 0;
+  switch ( dataType )
+  {
+    case MDAL_DataType::SCALAR_DOUBLE:
+      if ( !group()->isScalar() || mSinglePrecision )
+        return nullptr;
+      count = mValues.size();
+      return mValues.data();
+    case MDAL_DataType::VECTOR_2D_DOUBLE:
+      if ( group()->isScalar() || mSinglePrecision )
+        return nullptr;
+      count = mValues.size() / 2;
+      return mValues.data();
+    case MDAL_DataType::ACTIVE_INTEGER:
+      if ( !supportsActiveFlag() )
+        return nullptr;
+      count = mActive.size();
+      return mActive.data();
+    default:
+      return nullptr;
+  }
+}
+
 void MDAL::MemoryDataset2D::activateFaces( MDAL::MemoryMesh *mesh )
 {
   assert( mesh );
@@ -53,16 +193,15 @@ void MDAL::MemoryDataset2D::activateFaces( MDAL::MemoryMesh *mesh )
   const size_t nFaces = mesh->facesCount();
 
   const Faces &faces = mesh->faces();
-  for ( unsigned int idx = 0; idx < nFaces; ++idx )
+  for ( size_t idx = 0; idx < nFaces; ++idx )
   {
-    const Face &elem = faces.at( idx );
-    const std::size_t elemSize = elem.size();
+    const std::size_t elemSize = faces.faceSize( idx );
     for ( size_t i = 0; i < elemSize; ++i )
     {
-      const size_t vertexIndex = elem[i];
+      const size_t vertexIndex = faces.vertexIndex( idx, i );
       if ( isScalar )
       {
-        const double val = mValues[vertexIndex];
+        const double val = value( vertexIndex );
         if ( std::isnan( val ) )
         {
           mActive[idx] = 0; //NOT ACTIVE
@@ -71,8 +210,8 @@ void MDAL::MemoryDataset2D::activateFaces( MDAL::MemoryMesh *mesh )
       }
       else
       {
-        const double x = mValues[2 * vertexIndex];
-        const double y = mValues[2 * vertexIndex + 1];
+        const double x = value( 2 * vertexIndex );
+        const double y = value( 2 * vertexIndex + 1 );
         if ( std::isnan( x ) || std::isnan( y ) )
         {
           mActive[idx] = 0; //NOT ACTIVE
@@ -83,6 +222,47 @@ void MDAL::MemoryDataset2D::activateFaces( MDAL::MemoryMesh *mesh )
   }
 }
 
+void MDAL::MemoryDataset2D::activateFaces( MDAL::Mesh *mesh )
+{
+  assert( mesh );
+  assert( supportsActiveFlag() );
+  assert( group()->dataLocation() == MDAL_DataLocation::DataOnVertices );
+
+  bool isScalar = group()->isScalar();
+
+  const size_t nFaces = mesh->facesCount();
+  const size_t chunkSize = std::min<size_t>( nFaces, 1 << 16 );
+  std::vector<int> faceOffsets( chunkSize );
+  std::vector<int> vertexIndices( chunkSize * std::max<size_t>( 1, mesh->faceVerticesMaximumCount() ) );
+  std::unique_ptr<MDAL::MeshFaceIterator> faceIterator = mesh->readFaces();
+
+  size_t faceIndex = 0;
+  while ( faceIndex < nFaces )
+  {
+    const size_t count = faceIterator->next( faceOffsets.size(), faceOffsets.data(), vertexIndices.size(), vertexIndices.data() );
+    if ( count == 0 )
+      break;
+
+    int faceStart = 0;
+    for ( size_t i = 0; i < count; ++i, ++faceIndex )
+    {
+      for ( int j = faceStart; j < faceOffsets[i]; ++j )
+      {
+        const size_t vertexIndex = static_cast<size_t>( vertexIndices[static_cast<size_t>( j )] );
+        const bool isValid = isScalar ?
+                             !std::isnan( value( vertexIndex ) ) :
+                             !std::isnan( value( 2 * vertexIndex ) ) && !std::isnan( value( 2 * vertexIndex + 1 ) );
+        if ( !isValid )
+        {
+          mActive[faceIndex] = 0; //NOT ACTIVE
+          break;
+        }
+      }
+      faceStart = faceOffsets[i];
+    }
+  }
+}
+
 void MDAL::MemoryDataset2D::setActive( const int *activeBuffer )
 {
   assert( supportsActiveFlag() );
@@ -93,13 +273,13 @@ size_t MDAL::MemoryDataset2D::scalarData( size_t indexStart, size_t count, doubl
 {
   assert( group()->isScalar() ); //checked in C API interface
   size_t nValues = valuesCount();
-  assert( mValues.size() == nValues );
+  assert( valuesSize() == nValues );
 
   if ( ( count < 1 ) || ( indexStart >= nValues ) )
     return 0;
 
   size_t copyValues = std::min( nValues - indexStart, count );
-  memcpy( buffer, mValues.data() + indexStart, copyValues * sizeof( double ) );
+  copyToBuffer( indexStart, copyValues, buffer );
   return copyValues;
 }
 
@@ -107,16 +287,30 @@ size_t MDAL::MemoryDataset2D::vectorData( size_t indexStart, size_t count, doubl
 {
   assert( !group()->isScalar() ); //checked in C API interface
   size_t nValues = valuesCount();
-  assert( mValues.size() == nValues * 2 );
+  assert( valuesSize() == nValues * 2 );
 
   if ( ( count < 1 ) || ( indexStart >= nValues ) )
     return 0;
 
   size_t copyValues = std::min( nValues - indexStart, count );
-  memcpy( buffer, mValues.data() + 2 * indexStart, 2 * copyValues * sizeof( double ) );
+  copyToBuffer( 2 * indexStart, 2 * copyValues, buffer );
   return copyValues;
 }
 
+void MDAL::MemoryDataset2D::copyToBuffer( size_t start, size_t count, double *buffer ) const
+{
+  if ( mSinglePrecision )
+  {
+    const float *src = mFloatValues.data() + start;
+    for ( size_t i = 0; i < count; ++i )
+      buffer[i] = static_cast<double>( src[i] );
+  }
+  else
+  {
+    memcpy( buffer, mValues.data() + start, count * sizeof( double ) );
+  }
+}
+
 MDAL::MemoryMesh::MemoryMesh( const std::string &driverName,
                               size_t faceVerticesMaximumCount,
                               const std::string &uri )
@@ -159,6 +353,12 @@ void MDAL::MemoryMesh::setEdges( MDAL::Edges edges )
   mEdges = std::move( edges );
 }
 
+const double *MDAL::MemoryMesh::verticesView() const
+{
+  static_assert( sizeof( Vertex ) == 3 * sizeof( double ), "Vertex must be stored as 3 contiguous doubles" );
+  return reinterpret_cast<const double *>( mVertices.data() );
+}
+
 MDAL::BBox MDAL::MemoryMesh::extent() const
 {
   return mExtent;
@@ -189,7 +389,9 @@ void MDAL::MemoryMesh::addVertices( size_t vertexCount, double *coordinates )
 void MDAL::MemoryMesh::addFaces( size_t faceCount, size_t driverMaxVerticesPerFace, int *faceSizes, int *vertexIndices )
 {
   size_t indicesIndex = 0;
-  Faces newFaces( faceCount );
+  Faces newFaces;
+  newFaces.reserve( faceCount, faceCount * driverMaxVerticesPerFace );
+  Face face;
   for ( size_t faceIndex = 0; faceIndex < faceCount; ++faceIndex )
   {
     size_t faceSize = faceSizes[faceIndex];
@@ -202,7 +404,7 @@ void MDAL::MemoryMesh::addFaces( size_t faceCount, size_t driverMaxVerticesPerFa
     if ( faceSize > faceVerticesMaximumCount() )
       setFaceVerticesMaximumCount( faceSize );
 
-    Face face( faceSize );
+    face.resize( faceSize );
     for ( size_t i = 0; i < faceSize; ++i )
     {
       const int indice = vertexIndices[indicesIndex + i];
@@ -221,11 +423,11 @@ void MDAL::MemoryMesh::addFaces( size_t faceCount, size_t driverMaxVerticesPerFa
       }
     }
     indicesIndex = indicesIndex + faceSize;
-    newFaces[faceIndex] = std::move( face );
+    newFaces.addFace( face );
   }
 
   // if everything is ok
-  std::move( newFaces.begin(), newFaces.end(), std::back_inserter( mFaces ) );
+  mFaces.append( newFaces );
 }
 
 MDAL::MemoryMesh::~MemoryMesh() = default;
@@ -350,12 +552,12 @@ size_t MDAL::MemoryMeshFaceIterator::next(
     if ( mLastFaceIndex + faceIndex >= maxFaces )
       break;
 
-    const Face &f = faces[mLastFaceIndex + faceIndex];
-    const std::size_t faceSize = f.size();
+    const size_t meshFaceIndex = mLastFaceIndex + faceIndex;
+    const std::size_t faceSize = faces.faceSize( meshFaceIndex );
     for ( size_t faceVertexIndex = 0; faceVertexIndex < faceSize; ++faceVertexIndex )
     {
       assert( vertexIndex < vertexIndicesBufferLen );
-      vertexIndicesBuffer[vertexIndex] = static_cast<int>( f[faceVertexIndex] );
+      vertexIndicesBuffer[vertexIndex] = static_cast<int>( faces.vertexIndex( meshFaceIndex, faceVertexIndex ) );
       ++vertexIndex;
     }
 
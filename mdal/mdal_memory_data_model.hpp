@@ -7,6 +7,7 @@
 #define MDAL_MEMORY_DATA_MODEL_HPP
 
 #include <stddef.h>
+#include <stdint.h>
 #include <assert.h>
 #include <vector>
 #include <memory>
@@ -36,15 +37,93 @@ namespace MDAL
   typedef std::vector<size_t> Face;
   typedef std::vector<Vertex> Vertices;
   typedef std::vector<Edge> Edges;
-  typedef std::vector<Face> Faces;
+
+  /**
+   * Faces of the mesh stored in compressed sparse row layout
+   *
+   * Vertex indices of all the faces are stored in one flat array and the face i
+   * spans the range [ offsets[i], offsets[i + 1] ) of this array. Vertex indices
+   * are stored as 32-bit integers, the storage is promoted to 64-bit integers
+   * only when an index that does not fit is added.
+   *
+   * Faces can only be appended, but vertex indices of existing faces can be modified
+   */
+  class Faces
+  {
+    public:
+      //! Constructs an empty faces array
+      Faces();
+
+      //! Preallocates memory for faceCount faces with vertexIndicesCount vertex indices in total
+      void reserve( size_t faceCount, size_t vertexIndicesCount );
+
+      //! Appends face with faceSize vertices
+      void addFace( const size_t *vertexIndices, size_t faceSize );
+
+      //! Appends face
+      void addFace( const Face &face )
+      {
+        addFace( face.data(), face.size() );
+      }
+
+      //! Appends all faces of other
+      void append( const Faces &other );
+
+      //! Returns number of faces
+      size_t size() const {return mOffsets.size() - 1;}
+
+      //! Returns whether there are no faces
+      bool empty() const {return size() == 0;}
+
+      //! Returns number of vertex indices of all faces
+      size_t vertexIndicesCount() const {return mOffsets.back();}
+
+      //! Returns number of vertices of the face
+      size_t faceSize( size_t faceIndex ) const
+      {
+        assert( faceIndex < size() );
+        return mOffsets[faceIndex + 1] - mOffsets[faceIndex];
+      }
+
+      //! Returns vertex index of the vertex at position in the face
+      size_t vertexIndex( size_t faceIndex, size_t position ) const
+      {
+        assert( position < faceSize( faceIndex ) );
+        const size_t i = mOffsets[faceIndex] + position;
+        return mIsWide ? mIndices64[i] : mIndices32[i];
+      }
+
+      //! Sets vertex index of the vertex at position in the face
+      void setVertexIndex( size_t faceIndex, size_t position, size_t vertexIndex );
+
+      //! Returns copy of the face
+      Face face( size_t faceIndex ) const;
+
+      //! Returns whether the vertex indices are stored as 64-bit integers
+      bool isWide() const {return mIsWide;}
+
+    private:
+      void pushVertexIndex( size_t vertexIndex );
+      void widen();
+
+      std::vector<size_t> mOffsets; //size() + 1 items, first is always 0
+      std::vector<uint32_t> mIndices32; //used when mIsWide is false
+      std::vector<size_t> mIndices64; //used when mIsWide is true
+      bool mIsWide = false;
+  };
 
   /**
    * The MemoryDataset stores all the data in the memory
+   *
+   * Values are stored in double precision by default. Drivers reading
+   * sources stored in single precision should create the dataset with
+   * singlePrecision set to true to halve the memory used by the values,
+   * values are then converted to double only when copied to the caller buffer.
    */
   class MemoryDataset2D: public Dataset2D
   {
     public:
-      MemoryDataset2D( DatasetGroup *grp, bool hasActiveFlag = false );
+      MemoryDataset2D( DatasetGroup *grp, bool hasActiveFlag = false, bool singlePrecision = false );
       ~MemoryDataset2D() override;
 
       size_t scalarData( size_t indexStart, size_t count, double *buffer ) override;
@@ -53,12 +132,21 @@ namespace MDAL
       //! Returns 0 for datasets that does not support active flags
       size_t activeData( size_t indexStart, size_t count, int *buffer ) override;
 
+      size_t scalarDataAt( const size_t *indices, size_t count, double *buffer ) override;
+      size_t vectorDataAt( const size_t *indices, size_t count, double *buffer ) override;
+
+      //! Returns the internal buffers, not available for single precision values
+      const void *dataView( MDAL_DataType dataType, size_t &count ) const override;
+
       /**
        * Loop through all faces and activate those which has all 4 values on vertices valid
        * Dataset must support active flags and be defined on vertices
        */
       void activateFaces( MDAL::MemoryMesh *mesh );
 
+      //! Same as above for any mesh, the faces are read with the mesh iterator
+      void activateFaces( MDAL::Mesh *mesh );
+
       /**
        * Sets active flag for index
        *
@@ -85,64 +173,99 @@ namespace MDAL
 
       void setScalarValue( size_t index, double value )
       {
-        assert( mValues.size() > index );
+        assert( valuesSize() > index );
         assert( group()->isScalar() );
-        mValues[index] = value;
+        setValue( index, value );
       }
 
       void setVectorValue( size_t index, double x, double y )
       {
-        assert( mValues.size() > 2 * index + 1 );
+        assert( valuesSize() > 2 * index + 1 );
         assert( !group()->isScalar() );
-        mValues[2 * index] = x;
-        mValues[2 * index + 1] = y;
+        setValue( 2 * index, x );
+        setValue( 2 * index + 1, y );
       }
 
       void setValueX( size_t index, double x )
       {
-        assert( mValues.size() > 2 * index );
+        assert( valuesSize() > 2 * index );
         assert( !group()->isScalar() );
-
-        mValues[2 * index] = x;
+        setValue( 2 * index, x );
       }
 
       void setValueY( size_t index, double x )
       {
-        assert( mValues.size() > 2 * index + 1 );
+        assert( valuesSize() > 2 * index + 1 );
         assert( !group()->isScalar() );
-        mValues[2 * index + 1] = x;
+        setValue( 2 * index + 1, x );
       }
 
       double valueX( size_t index ) const
       {
-        assert( mValues.size() > 2 * index + 1 );
+        assert( valuesSize() > 2 * index + 1 );
         assert( !group()->isScalar() );
-        return mValues[2 * index];
+        return value( 2 * index );
       }
 
       double valueY( size_t index ) const
       {
-        assert( mValues.size() > 2 * index + 1 );
+        assert( valuesSize() > 2 * index + 1 );
         assert( !group()->isScalar() );
-        return mValues[2 * index + 1];
+        return value( 2 * index + 1 );
       }
 
       double scalarValue( size_t index ) const
       {
-        assert( mValues.size() > index );
+        assert( valuesSize() > index );
         assert( group()->isScalar() );
-        return mValues[index];
+        return value( index );
       }
 
+      //! Returns whether the values are stored in single precision
+      bool isSinglePrecision() const {return mSinglePrecision;}
+
       //! Returns pointer to internal buffer with values
       //! Never null, already allocated
       //! for vector datasets in form x1, y1, ..., xN, yN
+      //! Dataset must not be single precision
       double *values()
       {
+        assert( !mSinglePrecision );
         return mValues.data();
       }
 
+      //! Returns pointer to internal buffer with single precision values
+      //! Never null, already allocated
+      //! for vector datasets in form x1, y1, ..., xN, yN
+      //! Dataset must be single precision
+      float *singlePrecisionValues()
+      {
+        assert( mSinglePrecision );
+        return mFloatValues.data();
+      }
+
     private:
+      size_t valuesSize() const
+      {
+        return mSinglePrecision ? mFloatValues.size() : mValues.size();
+      }
+
+      double value( size_t i ) const
+      {
+        return mSinglePrecision ? static_cast<double>( mFloatValues[i] ) : mValues[i];
+      }
+
+      void setValue( size_t i, double val )
+      {
+        if ( mSinglePrecision )
+          mFloatValues[i] = static_cast<float>( val );
+        else
+          mValues[i] = val;
+      }
+
+      //! Copies count values starting at start to buffer
+      void copyToBuffer( size_t start, size_t count, double *buffer ) const;
+
       /**
        * Stores vector2d/scalar data for dataset in form
        * scalars: x1, x2, x3, ..., xN
@@ -155,9 +278,16 @@ namespace MDAL
        *   - vertex count if isOnVertices & isScalar
        *   - face count * 2 if isOnFaces & isVector
        *   - vertex count * 2 if isOnVertices & isVector
+       *
+       * empty when the dataset is single precision
        */
       std::vector<double> mValues;
 
+      //! Same as mValues, used instead of mValues when the dataset is single precision
+      std::vector<float> mFloatValues;
+
+      bool mSinglePrecision = false;
+
       /**
        * Active flag, whether the face is active or not (disabled)
        * Only make sense for dataset defined on vertices
@@ -201,6 +331,7 @@ namespace MDAL
       BBox extent() const override;
       void addVertices( size_t vertexCount, double *coordinates ) override;
       void addFaces( size_t faceCount, size_t driverMaxVerticesPerFace, int *faceSizes, int *vertexIndices ) override;
+      const double *verticesView() const override;
 
       bool isEditable() const override {return true;}
 
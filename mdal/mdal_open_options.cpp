@@ -0,0 +1,133 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#include "mdal_open_options.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "mdal_utils.hpp"
+#include "mdal_logger.hpp"
+
+//! Parses \a value as a number of hours, returns false if it is not a number
+static bool parseHours( const std::string &value, double &hours )
+{
+  const std::string trimmed = MDAL::trim( value );
+  if ( trimmed.empty() )
+    return false;
+
+  char *end = nullptr;
+  hours = std::strtod( trimmed.c_str(), &end );
+  return end == trimmed.c_str() + trimmed.size();
+}
+
+MDAL::OpenOptions::OpenOptions( const char *const *options )
+{
+  if ( !options )
+    return;
+
+  for ( ; *options; ++options )
+  {
+    const std::string option( *options );
+    const size_t separator = option.find( '=' );
+    if ( separator == std::string::npos )
+    {
+      MDAL::Log::warning( MDAL_Status::Err_InvalidData, "Open option " + option + " is not in form KEY=VALUE, ignored" );
+      continue;
+    }
+
+    const std::string key = MDAL::toLower( MDAL::trim( option.substr( 0, separator ) ) );
+    const std::string value = option.substr( separator + 1 );
+
+    if ( key == "groups" )
+    {
+      for ( const std::string &group : MDAL::split( value, ',' ) )
+      {
+        const std::string name = MDAL::toLower( MDAL::trim( group ) );
+        if ( !name.empty() )
+          mGroups.push_back( name );
+      }
+    }
+    else if ( key == "time_start" )
+    {
+      mHasTimeStart = parseHours( value, mTimeStart );
+      if ( !mHasTimeStart )
+        MDAL::Log::warning( MDAL_Status::Err_InvalidData, "Open option " + option + " is not a number of hours, ignored" );
+    }
+    else if ( key == "time_end" )
+    {
+      mHasTimeEnd = parseHours( value, mTimeEnd );
+      if ( !mHasTimeEnd )
+        MDAL::Log::warning( MDAL_Status::Err_InvalidData, "Open option " + option + " is not a number of hours, ignored" );
+    }
+    else
+    {
+      MDAL::Log::debug( "Unknown open option " + option + ", ignored" );
+    }
+  }
+}
+
+bool MDAL::OpenOptions::isEmpty() const
+{
+  return mGroups.empty() && !mHasTimeStart && !mHasTimeEnd;
+}
+
+bool MDAL::OpenOptions::acceptsGroup( const std::string &groupName ) const
+{
+  if ( mGroups.empty() )
+    return true;
+
+  return std::find( mGroups.begin(), mGroups.end(), MDAL::toLower( groupName ) ) != mGroups.end();
+}
+
+bool MDAL::OpenOptions::acceptsTime( const MDAL::RelativeTimestamp &time, size_t datasetsCount ) const
+{
+  if ( datasetsCount < 2 )
+    return true;
+
+  const double hours = time.value( RelativeTimestamp::hours );
+  if ( mHasTimeStart && hours < mTimeStart )
+    return false;
+  if ( mHasTimeEnd && hours > mTimeEnd )
+    return false;
+
+  return true;
+}
+
+void MDAL::OpenOptions::filterDatasetGroups( MDAL::DatasetGroups &groups, size_t firstIndex ) const
+{
+  if ( isEmpty() || firstIndex >= groups.size() )
+    return;
+
+  DatasetGroups accepted;
+  for ( size_t i = firstIndex; i < groups.size(); ++i )
+  {
+    std::shared_ptr<DatasetGroup> group = groups[i];
+    if ( !acceptsGroup( group->name() ) )
+      continue;
+
+    const size_t datasetsCount = group->datasets.size();
+    Datasets datasets;
+    for ( const std::shared_ptr<Dataset> &dataset : group->datasets )
+    {
+      if ( acceptsTime( dataset->timestamp(), datasetsCount ) )
+        datasets.push_back( dataset );
+    }
+
+    if ( datasets.size() != datasetsCount )
+    {
+      if ( datasets.empty() )
+        continue;
+
+      group->datasets = std::move( datasets );
+      group->invalidateStatistics();
+    }
+
+    accepted.push_back( group );
+  }
+
+  groups.erase( groups.begin() + static_cast<std::ptrdiff_t>( firstIndex ), groups.end() );
+  groups.insert( groups.end(), accepted.begin(), accepted.end() );
+}
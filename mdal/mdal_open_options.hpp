@@ -0,0 +1,63 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#ifndef MDAL_OPEN_OPTIONS_HPP
+#define MDAL_OPEN_OPTIONS_HPP
+
+#include <string>
+#include <vector>
+#include <stddef.h>
+
+#include "mdal_data_model.hpp"
+#include "mdal_datetime.hpp"
+
+namespace MDAL
+{
+  /**
+   * Options restricting what is loaded from a mesh or dataset file, parsed from a list of KEY=VALUE strings
+   *
+   * Supported keys:
+   *  - GROUPS: comma separated names of the dataset groups to load, compared case insensitively
+   *  - TIME_START, TIME_END: bounds in hours, relative to the reference time, of the time window of the datasets to load
+   *
+   * Groups with a single dataset are considered time independent (bed elevation, maximums) and are not restricted by the time window.
+   *
+   * Drivers can use acceptsGroup() and acceptsTime() to skip the parsing of what is excluded, the remaining groups and
+   * datasets are removed after the load with filterDatasetGroups().
+   */
+  class OpenOptions
+  {
+    public:
+      //! Constructs options that accept everything
+      OpenOptions() = default;
+
+      //! Parses the null terminated list of KEY=VALUE \a options, can be null
+      explicit OpenOptions( const char *const *options );
+
+      //! Returns whether the options accept everything
+      bool isEmpty() const;
+
+      //! Returns whether the dataset group named \a groupName has to be loaded
+      bool acceptsGroup( const std::string &groupName ) const;
+
+      //! Returns whether the dataset at \a time of a group with \a datasetsCount datasets has to be loaded
+      bool acceptsTime( const RelativeTimestamp &time, size_t datasetsCount ) const;
+
+      /**
+       * Removes from \a groups, starting at \a firstIndex, the groups and the datasets not accepted by the options.
+       * Statistics of the groups with removed datasets are updated and the groups without remaining dataset are removed
+       */
+      void filterDatasetGroups( DatasetGroups &groups, size_t firstIndex = 0 ) const;
+
+    private:
+      std::vector<std::string> mGroups; // lower case
+      bool mHasTimeStart = false;
+      bool mHasTimeEnd = false;
+      double mTimeStart = 0; // hours
+      double mTimeEnd = 0; // hours
+  };
+
+} // namespace MDAL
+#endif //MDAL_OPEN_OPTIONS_HPP
@@ -0,0 +1,403 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#include "mdal_regular_grid_mesh.hpp"
+
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static const size_t NO_SKIPPED_COLUMN = std::numeric_limits<size_t>::max();
+
+MDAL::RegularGridMesh::RegularGridMesh( const std::string &driverName,
+                                        const std::string &uri,
+                                        size_t xSize,
+                                        size_t ySize,
+                                        const double *geoTransform,
+                                        bool longitudeShifted )
+  : Mesh( driverName, 4, uri )
+  , mXSize( xSize )
+  , mYSize( ySize )
+  , mLongitudeShifted( longitudeShifted )
+{
+  std::copy( geoTransform, geoTransform + 6, mGT );
+
+  if ( mXSize > 1 && mYSize > 1 )
+  {
+    if ( mLongitudeShifted )
+      initShiftedFaces();
+    else
+      mFacesCount = ( mXSize - 1 ) * ( mYSize - 1 );
+  }
+
+  initExtent();
+
+  if ( !mLongitudeShifted )
+    mGridIndex = std::make_shared<const RegularGridSpatialIndex>( this );
+}
+
+MDAL::RegularGridMesh::~RegularGridMesh() = default;
+
+double MDAL::RegularGridMesh::vertexX( size_t x, size_t y ) const
+{
+  double vx = mGT[0] + ( static_cast<double>( x ) + 0.5 ) * mGT[1] + ( static_cast<double>( y ) + 0.5 ) * mGT[2];
+  if ( mLongitudeShifted && vx > 180.0 )
+    vx -= 360.0;
+  return vx;
+}
+
+void MDAL::RegularGridMesh::initShiftedFaces()
+{
+  // in each row, the face between a positive and a negative longitude crosses the antimeridian and is removed,
+  // a face is added to connect the last and the first columns, unless the first face of the row is the removed one
+  mSkippedColumns.resize( mYSize - 1 );
+  mRowFaceOffsets.resize( mYSize );
+  mRowFaceOffsets[0] = 0;
+
+  for ( size_t y = 0; y < mYSize - 1; ++y )
+  {
+    if ( y > 0 && mGT[2] == 0 )
+    {
+      // the longitudes of the columns are the same in all rows
+      mSkippedColumns[y] = mSkippedColumns[0];
+    }
+    else
+    {
+      mSkippedColumns[y] = NO_SKIPPED_COLUMN;
+      for ( size_t x = 0; x < mXSize - 1; ++x )
+      {
+        if ( vertexX( x, y ) > 0.0 && vertexX( x + 1, y ) < 0.0 )
+        {
+          mSkippedColumns[y] = x;
+          break;
+        }
+      }
+    }
+
+    size_t rowFacesCount = mXSize - 1;
+    if ( mSkippedColumns[y] != NO_SKIPPED_COLUMN )
+      --rowFacesCount;
+    if ( mSkippedColumns[y] != 0 )
+      ++rowFacesCount;
+    mRowFaceOffsets[y + 1] = mRowFaceOffsets[y] + rowFacesCount;
+  }
+
+  mFacesCount = mRowFaceOffsets.back();
+}
+
+void MDAL::RegularGridMesh::initExtent()
+{
+  if ( mXSize == 0 || mYSize == 0 )
+    return;
+
+  // the grid is affine, the extent of the coordinates is given by the corners
+  const size_t corners[4][2] = {{0, 0}, {mXSize - 1, 0}, {0, mYSize - 1}, {mXSize - 1, mYSize - 1}};
+  for ( const size_t *corner : corners )
+  {
+    double x, y;
+    vertexCoordinates( corner[0] + mXSize * corner[1], x, y );
+    mExtent.minX = std::min( mExtent.minX, x );
+    mExtent.maxX = std::max( mExtent.maxX, x );
+    mExtent.minY = std::min( mExtent.minY, y );
+    mExtent.maxY = std::max( mExtent.maxY, y );
+  }
+
+  if ( !mLongitudeShifted )
+    return;
+
+  // shifted longitudes are not affine anymore, go through all the columns
+  mExtent.minX = std::numeric_limits<double>::max();
+  mExtent.maxX = -std::numeric_limits<double>::max();
+  const size_t rows = mGT[2] == 0 ? 1 : mYSize;
+  for ( size_t y = 0; y < rows; ++y )
+  {
+    for ( size_t x = 0; x < mXSize; ++x )
+    {
+      const double vx = vertexX( x, y );
+      mExtent.minX = std::min( mExtent.minX, vx );
+      mExtent.maxX = std::max( mExtent.maxX, vx );
+    }
+  }
+}
+
+void MDAL::RegularGridMesh::initEditedMesh()
+{
+  mEditedMesh.reset( new MemoryMesh( driverName(), faceVerticesMaximumCount(), uri() ) );
+
+  const size_t verticesCount = mXSize * mYSize;
+  std::vector<double> coordinates( 3 * verticesCount, 0.0 );
+  for ( size_t i = 0; i < verticesCount; ++i )
+    vertexCoordinates( i, coordinates[3 * i], coordinates[3 * i + 1] );
+  mEditedMesh->addVertices( verticesCount, coordinates.data() );
+
+  std::vector<int> faceSizes( mFacesCount, 4 );
+  std::vector<int> vertexIndices( 4 * mFacesCount );
+  for ( size_t i = 0; i < mFacesCount; ++i )
+  {
+    size_t faceVertexIndexes[4];
+    faceVertices( i, faceVertexIndexes );
+    for ( size_t j = 0; j < 4; ++j )
+      vertexIndices[4 * i + j] = static_cast<int>( faceVertexIndexes[j] );
+  }
+  mEditedMesh->addFaces( mFacesCount, 4, faceSizes.data(), vertexIndices.data() );
+}
+
+std::unique_ptr<MDAL::MeshVertexIterator> MDAL::RegularGridMesh::readVertices()
+{
+  if ( mEditedMesh )
+    return mEditedMesh->readVertices();
+
+  return std::unique_ptr<MeshVertexIterator>( new RegularGridMeshVertexIterator( this ) );
+}
+
+std::unique_ptr<MDAL::MeshEdgeIterator> MDAL::RegularGridMesh::readEdges()
+{
+  if ( mEditedMesh )
+    return mEditedMesh->readEdges();
+
+  return std::unique_ptr<MeshEdgeIterator>( new RegularGridMeshEdgeIterator() );
+}
+
+std::unique_ptr<MDAL::MeshFaceIterator> MDAL::RegularGridMesh::readFaces()
+{
+  if ( mEditedMesh )
+    return mEditedMesh->readFaces();
+
+  return std::unique_ptr<MeshFaceIterator>( new RegularGridMeshFaceIterator( this ) );
+}
+
+size_t MDAL::RegularGridMesh::verticesCount() const
+{
+  if ( mEditedMesh )
+    return mEditedMesh->verticesCount();
+
+  return mXSize * mYSize;
+}
+
+size_t MDAL::RegularGridMesh::edgesCount() const
+{
+  if ( mEditedMesh )
+    return mEditedMesh->edgesCount();
+
+  return 0;
+}
+
+size_t MDAL::RegularGridMesh::facesCount() const
+{
+  if ( mEditedMesh )
+    return mEditedMesh->facesCount();
+
+  return mFacesCount;
+}
+
+MDAL::BBox MDAL::RegularGridMesh::extent() const
+{
+  if ( mEditedMesh )
+    return mEditedMesh->extent();
+
+  return mExtent;
+}
+
+void MDAL::RegularGridMesh::addVertices( size_t vertexCount, double *coordinates )
+{
+  if ( !mEditedMesh )
+    initEditedMesh();
+
+  mEditedMesh->addVertices( vertexCount, coordinates );
+}
+
+void MDAL::RegularGridMesh::addFaces( size_t faceCount, size_t driverMaxVerticesPerFace, int *faceSizes, int *vertexIndices )
+{
+  if ( !mEditedMesh )
+    initEditedMesh();
+
+  mEditedMesh->addFaces( faceCount, driverMaxVerticesPerFace, faceSizes, vertexIndices );
+  setFaceVerticesMaximumCount( mEditedMesh->faceVerticesMaximumCount() );
+}
+
+const double *MDAL::RegularGridMesh::verticesView() const
+{
+  if ( mEditedMesh )
+    return mEditedMesh->verticesView();
+
+  return nullptr;
+}
+
+std::shared_ptr<const MDAL::MeshSpatialIndex> MDAL::RegularGridMesh::spatialIndex()
+{
+  if ( mEditedMesh )
+    return mEditedMesh->spatialIndex();
+
+  if ( mLongitudeShifted )
+    return Mesh::spatialIndex();
+
+  return mGridIndex;
+}
+
+void MDAL::RegularGridMesh::vertexCoordinates( size_t vertexIndex, double &x, double &y ) const
+{
+  const size_t column = vertexIndex % mXSize;
+  const size_t row = vertexIndex / mXSize;
+  x = vertexX( column, row );
+  y = mGT[3] + ( static_cast<double>( column ) + 0.5 ) * mGT[4] + ( static_cast<double>( row ) + 0.5 ) * mGT[5];
+}
+
+void MDAL::RegularGridMesh::faceVertices( size_t faceIndex, size_t *vertexIndexes ) const
+{
+  assert( faceIndex < mFacesCount );
+
+  size_t row;
+  size_t column;
+  if ( mLongitudeShifted )
+  {
+    row = static_cast<size_t>( std::upper_bound( mRowFaceOffsets.begin(), mRowFaceOffsets.end(), faceIndex ) - mRowFaceOffsets.begin() ) - 1;
+    size_t rowFaceIndex = faceIndex - mRowFaceOffsets[row];
+    const size_t skippedColumn = mSkippedColumns[row];
+
+    if ( skippedColumn != 0 )
+    {
+      if ( rowFaceIndex == 0 )
+      {
+        // face around the prime meridian
+        vertexIndexes[0] = mXSize * ( row + 1 );
+        vertexIndexes[1] = mXSize - 1 + mXSize * ( row + 1 );
+        vertexIndexes[2] = mXSize - 1 + mXSize * row;
+        vertexIndexes[3] = mXSize * row;
+        return;
+      }
+      --rowFaceIndex;
+    }
+
+    column = rowFaceIndex < skippedColumn ? rowFaceIndex : rowFaceIndex + 1;
+  }
+  else
+  {
+    row = faceIndex / ( mXSize - 1 );
+    column = faceIndex % ( mXSize - 1 );
+  }
+
+  vertexIndexes[0] = column + 1 + mXSize * ( row + 1 );
+  vertexIndexes[1] = column + mXSize * ( row + 1 );
+  vertexIndexes[2] = column + mXSize * row;
+  vertexIndexes[3] = column + 1 + mXSize * row;
+}
+
+int64_t MDAL::RegularGridMesh::gridFaceAt( double x, double y ) const
+{
+  if ( mLongitudeShifted || mFacesCount == 0 )
+    return -1;
+
+  // position of the point in vertex units, vertex (i, j) is at (i, j)
+  const double det = mGT[1] * mGT[5] - mGT[2] * mGT[4];
+  if ( det == 0 )
+    return -1;
+
+  const double dx = x - mGT[0];
+  const double dy = y - mGT[3];
+  const double column = ( mGT[5] * dx - mGT[2] * dy ) / det - 0.5;
+  const double row = ( mGT[1] * dy - mGT[4] * dx ) / det - 0.5;
+
+  const double maxColumn = static_cast<double>( mXSize - 1 );
+  const double maxRow = static_cast<double>( mYSize - 1 );
+  if ( !( column >= 0 && column <= maxColumn && row >= 0 && row <= maxRow ) )
+    return -1;
+
+  const size_t faceColumn = std::min( mXSize - 2, static_cast<size_t>( column ) );
+  const size_t faceRow = std::min( mYSize - 2, static_cast<size_t>( row ) );
+  return static_cast<int64_t>( faceColumn + faceRow * ( mXSize - 1 ) );
+}
+
+MDAL::RegularGridMeshVertexIterator::RegularGridMeshVertexIterator( const MDAL::RegularGridMesh *mesh )
+  : mMesh( mesh )
+{
+}
+
+MDAL::RegularGridMeshVertexIterator::~RegularGridMeshVertexIterator() = default;
+
+size_t MDAL::RegularGridMeshVertexIterator::next( size_t vertexCount, double *coordinates )
+{
+  assert( mMesh );
+  assert( coordinates );
+
+  const size_t count = std::min( vertexCount, mMesh->verticesCount() - mLastVertexIndex );
+  for ( size_t i = 0; i < count; ++i )
+  {
+    mMesh->vertexCoordinates( mLastVertexIndex + i, coordinates[3 * i], coordinates[3 * i + 1] );
+    coordinates[3 * i + 2] = 0.0;
+  }
+
+  mLastVertexIndex += count;
+  return count;
+}
+
+MDAL::RegularGridMeshEdgeIterator::~RegularGridMeshEdgeIterator() = default;
+
+size_t MDAL::RegularGridMeshEdgeIterator::next( size_t, int *, int * )
+{
+  return 0;
+}
+
+MDAL::RegularGridMeshFaceIterator::RegularGridMeshFaceIterator( const MDAL::RegularGridMesh *mesh )
+  : mMesh( mesh )
+{
+}
+
+MDAL::RegularGridMeshFaceIterator::~RegularGridMeshFaceIterator() = default;
+
+size_t MDAL::RegularGridMeshFaceIterator::next( size_t faceOffsetsBufferLen, int *faceOffsetsBuffer,
+    size_t vertexIndicesBufferLen, int *vertexIndicesBuffer )
+{
+  assert( mMesh );
+  assert( faceOffsetsBuffer );
+  assert( vertexIndicesBuffer );
+
+  const size_t count = std::min( std::min( faceOffsetsBufferLen, vertexIndicesBufferLen / 4 ),
+                                 mMesh->facesCount() - mLastFaceIndex );
+  size_t vertexIndexes[4];
+  for ( size_t i = 0; i < count; ++i )
+  {
+    mMesh->faceVertices( mLastFaceIndex + i, vertexIndexes );
+    for ( size_t j = 0; j < 4; ++j )
+      vertexIndicesBuffer[4 * i + j] = static_cast<int>( vertexIndexes[j] );
+    faceOffsetsBuffer[i] = static_cast<int>( 4 * ( i + 1 ) );
+  }
+
+  mLastFaceIndex += count;
+  return count;
+}
+
+MDAL::RegularGridSpatialIndex::RegularGridSpatialIndex( const MDAL::RegularGridMesh *mesh )
+  : mMesh( mesh )
+{
+}
+
+bool MDAL::RegularGridSpatialIndex::isUpToDate( const MDAL::Mesh * ) const
+{
+  return true; // the grid does not change, the edited mesh has its own index
+}
+
+int64_t MDAL::RegularGridSpatialIndex::faceAt( double x, double y ) const
+{
+  return mMesh->gridFaceAt( x, y );
+}
+
+int64_t MDAL::RegularGridSpatialIndex::interpolationAt( double x, double y, size_t *vertexIndexes, double *weights ) const
+{
+  const int64_t faceIndex = faceAt( x, y );
+  if ( faceIndex < 0 )
+    return -1;
+
+  size_t faceVertices[4];
+  double coordinates[8];
+  mMesh->faceVertices( static_cast<size_t>( faceIndex ), faceVertices );
+  for ( size_t i = 0; i < 4; ++i )
+    mMesh->vertexCoordinates( faceVertices[i], coordinates[2 * i], coordinates[2 * i + 1] );
+
+  if ( !fanInterpolation( 4, faceVertices, coordinates, x, y, vertexIndexes, weights ) )
+    return -1;
+
+  return faceIndex;
+}
@@ -0,0 +1,157 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#ifndef MDAL_REGULAR_GRID_MESH_HPP
+#define MDAL_REGULAR_GRID_MESH_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stddef.h>
+
+#include "mdal_data_model.hpp"
+#include "mdal_memory_data_model.hpp"
+#include "mdal_spatial_index.hpp"
+
+namespace MDAL
+{
+  /**
+   * Mesh of a regular grid of xSize x ySize vertices defined by an affine geotransform
+   *
+   * Vertices are the centers of the raster cells, the vertex (x, y) has index x + xSize * y and coordinates
+   * ( gt[0] + ( x + 0.5 ) * gt[1] + ( y + 0.5 ) * gt[2], gt[3] + ( x + 0.5 ) * gt[4] + ( y + 0.5 ) * gt[5] ).
+   * Faces are the quads between 4 adjacent vertices, row by row.
+   *
+   * Only the dimensions and the geotransform are stored, vertices and faces are computed on the fly.
+   * The mesh is editable: on the first edit, its vertices and faces are copied to a MemoryMesh, which then holds the mesh.
+   * The grid methods (vertexCoordinates(), faceVertices(), gridFaceAt()) keep describing the grid.
+   *
+   * When the longitudes are shifted, the grid covers the whole earth with longitudes from 0 to 360 degrees:
+   * longitudes above 180 are shifted by -360 degrees, the face of each row crossing the antimeridian is removed
+   * and a face connecting the last and the first columns is added at the beginning of each row.
+   */
+  class RegularGridMesh: public Mesh
+  {
+    public:
+      RegularGridMesh( const std::string &driverName,
+                       const std::string &uri,
+                       size_t xSize,
+                       size_t ySize,
+                       const double *geoTransform,
+                       bool longitudeShifted = false );
+      ~RegularGridMesh() override;
+
+      std::unique_ptr<MDAL::MeshVertexIterator> readVertices() override;
+      std::unique_ptr<MDAL::MeshEdgeIterator> readEdges() override;
+      std::unique_ptr<MDAL::MeshFaceIterator> readFaces() override;
+
+      size_t verticesCount() const override;
+      size_t edgesCount() const override;
+      size_t facesCount() const override;
+      BBox extent() const override;
+
+      bool isEditable() const override {return true;}
+      void addVertices( size_t vertexCount, double *coordinates ) override;
+      void addFaces( size_t faceCount, size_t driverMaxVerticesPerFace, int *faceSizes, int *vertexIndices ) override;
+      const double *verticesView() const override;
+
+      //! Returns the spatial index locating the points with the geotransform, without storing the faces if the longitudes are not shifted
+      std::shared_ptr<const MeshSpatialIndex> spatialIndex() override;
+
+      //! Sets \a x and \a y with the coordinates of the vertex with index \a vertexIndex
+      void vertexCoordinates( size_t vertexIndex, double &x, double &y ) const;
+
+      //! Sets \a vertexIndexes with the 4 vertices of the face with index \a faceIndex
+      void faceVertices( size_t faceIndex, size_t *vertexIndexes ) const;
+
+      /**
+       * Returns the index of the face containing the point (\a x, \a y) computed with the inverse geotransform,
+       * or -1 if no face contains it. Not available if the longitudes are shifted, returns -1
+       */
+      int64_t gridFaceAt( double x, double y ) const;
+
+      bool isLongitudeShifted() const {return mLongitudeShifted;}
+
+    private:
+      //! Returns the x coordinate of the vertex at column \a x and row \a y
+      double vertexX( size_t x, size_t y ) const;
+      void initShiftedFaces();
+      void initExtent();
+
+      //! Copies the vertices and the faces of the grid to mEditedMesh
+      void initEditedMesh();
+
+      size_t mXSize = 0;
+      size_t mYSize = 0;
+      double mGT[6];
+      bool mLongitudeShifted = false;
+      size_t mFacesCount = 0;
+      BBox mExtent;
+
+      // only when longitudes are shifted, for each row, the column of the removed face and the index of the first face
+      std::vector<size_t> mSkippedColumns;
+      std::vector<size_t> mRowFaceOffsets;
+
+      std::shared_ptr<const MeshSpatialIndex> mGridIndex;
+
+      // set on the first edit, holds the vertices and the faces instead of the grid
+      std::unique_ptr<MemoryMesh> mEditedMesh;
+  };
+
+  class RegularGridMeshVertexIterator: public MeshVertexIterator
+  {
+    public:
+      RegularGridMeshVertexIterator( const RegularGridMesh *mesh );
+      ~RegularGridMeshVertexIterator() override;
+
+      size_t next( size_t vertexCount, double *coordinates ) override;
+
+    private:
+      const RegularGridMesh *mMesh;
+      size_t mLastVertexIndex = 0;
+  };
+
+  class RegularGridMeshEdgeIterator: public MeshEdgeIterator
+  {
+    public:
+      ~RegularGridMeshEdgeIterator() override;
+
+      size_t next( size_t edgeCount,
+                   int *startVertexIndices,
+                   int *endVertexIndices ) override;
+  };
+
+  class RegularGridMeshFaceIterator: public MeshFaceIterator
+  {
+    public:
+      RegularGridMeshFaceIterator( const RegularGridMesh *mesh );
+      ~RegularGridMeshFaceIterator() override;
+
+      size_t next( size_t faceOffsetsBufferLen,
+                   int *faceOffsetsBuffer,
+                   size_t vertexIndicesBufferLen,
+                   int *vertexIndicesBuffer ) override;
+
+    private:
+      const RegularGridMesh *mMesh;
+      size_t mLastFaceIndex = 0;
+  };
+
+  //! Spatial index of a regular grid, locates the points with the inverse geotransform of the grid
+  class RegularGridSpatialIndex: public MeshSpatialIndex
+  {
+    public:
+      RegularGridSpatialIndex( const RegularGridMesh *mesh );
+
+      bool isUpToDate( const Mesh *mesh ) const override;
+      int64_t faceAt( double x, double y ) const override;
+      int64_t interpolationAt( double x, double y, size_t *vertexIndexes, double *weights ) const override;
+
+    private:
+      const RegularGridMesh *mMesh;
+  };
+
+} // namespace MDAL
+#endif //MDAL_REGULAR_GRID_MESH_HPP
@@ -0,0 +1,343 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#include "mdal_spatial_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+
+#include "mdal_utils.hpp"
+
+// count of faces read at once from the mesh iterator
+static const size_t FACES_CHUNK_SIZE = 1 << 16;
+
+// minimum count of faces or points processed by each thread
+static const size_t PARALLEL_CHUNK_SIZE = 1 << 16;
+
+// distance from an edge under which a point is on the edge, relative to the edge length
+static const double EDGE_TOLERANCE = 1e-10;
+
+// stored in place of the vertex indices that are negative or out of range, the iterators return int indices
+// so this value is never a valid index
+static const uint32_t INVALID_VERTEX = std::numeric_limits<uint32_t>::max();
+
+MDAL::MeshSpatialIndex::MeshSpatialIndex( MDAL::Mesh *mesh )
+{
+  readMesh( mesh );
+  buildGrid();
+}
+
+MDAL::MeshSpatialIndex::~MeshSpatialIndex() = default;
+
+bool MDAL::MeshSpatialIndex::isUpToDate( const MDAL::Mesh *mesh ) const
+{
+  return mesh->verticesCount() == mVerticesCount && mesh->facesCount() == mFacesCount;
+}
+
+void MDAL::MeshSpatialIndex::readMesh( MDAL::Mesh *mesh )
+{
+  mVerticesCount = mesh->verticesCount();
+  mFacesCount = mesh->facesCount();
+
+  // vertices, only x and y are kept
+  mVertexCoordinates.resize( mVerticesCount * 2 );
+  std::unique_ptr<MeshVertexIterator> vertexIterator = mesh->readVertices();
+  std::vector<double> vertexBuffer( std::min<size_t>( mVerticesCount, FACES_CHUNK_SIZE ) * 3 );
+  size_t verticesRead = 0;
+  while ( verticesRead < mVerticesCount )
+  {
+    const size_t count = vertexIterator->next( std::min( mVerticesCount - verticesRead, vertexBuffer.size() / 3 ), vertexBuffer.data() );
+    if ( count == 0 )
+      break;
+
+    for ( size_t i = 0; i < count; ++i )
+    {
+      mVertexCoordinates[( verticesRead + i ) * 2] = vertexBuffer[i * 3];
+      mVertexCoordinates[( verticesRead + i ) * 2 + 1] = vertexBuffer[i * 3 + 1];
+    }
+    verticesRead += count;
+  }
+  mVerticesCount = verticesRead;
+  mVertexCoordinates.resize( mVerticesCount * 2 );
+
+  // faces
+  const size_t faceVerticesMaximumCount = std::max<size_t>( 1, mesh->faceVerticesMaximumCount() );
+  const bool wideOffsets = mFacesCount * faceVerticesMaximumCount > std::numeric_limits<uint32_t>::max();
+  if ( wideOffsets )
+  {
+    mWideFaceOffsets.reserve( mFacesCount + 1 );
+    mWideFaceOffsets.push_back( 0 );
+  }
+  else
+  {
+    mFaceOffsets.reserve( mFacesCount + 1 );
+    mFaceOffsets.push_back( 0 );
+  }
+  std::unique_ptr<MeshFaceIterator> faceIterator = mesh->readFaces();
+  std::vector<int> offsetsBuffer( std::min<size_t>( mFacesCount, FACES_CHUNK_SIZE ) );
+  std::vector<int> indicesBuffer( offsetsBuffer.size() * faceVerticesMaximumCount );
+  size_t facesRead = 0;
+  while ( facesRead < mFacesCount )
+  {
+    const size_t count = faceIterator->next( offsetsBuffer.size(), offsetsBuffer.data(), indicesBuffer.size(), indicesBuffer.data() );
+    if ( count == 0 )
+      break;
+
+    const size_t base = mFaceVertices.size();
+    for ( size_t i = 0; i < static_cast<size_t>( offsetsBuffer[count - 1] ); ++i )
+    {
+      const int vertexIndex = indicesBuffer[i];
+      if ( vertexIndex < 0 || static_cast<size_t>( vertexIndex ) >= mVerticesCount )
+        mFaceVertices.push_back( INVALID_VERTEX );
+      else
+        mFaceVertices.push_back( static_cast<uint32_t>( vertexIndex ) );
+    }
+    for ( size_t i = 0; i < count; ++i )
+    {
+      if ( wideOffsets )
+        mWideFaceOffsets.push_back( base + static_cast<size_t>( offsetsBuffer[i] ) );
+      else
+        mFaceOffsets.push_back( static_cast<uint32_t>( base + static_cast<size_t>( offsetsBuffer[i] ) ) );
+    }
+    facesRead += count;
+  }
+  mFacesCount = facesRead;
+  mFaceVertices.shrink_to_fit();
+}
+
+MDAL::BBox MDAL::MeshSpatialIndex::faceExtent( size_t faceIndex ) const
+{
+  BBox extent;
+  const size_t end = faceOffset( faceIndex + 1 );
+  for ( size_t i = faceOffset( faceIndex ); i < end; ++i )
+  {
+    const size_t vertexIndex = mFaceVertices[i];
+    if ( vertexIndex == INVALID_VERTEX )
+      return BBox(); // never found
+    const double x = mVertexCoordinates[vertexIndex * 2];
+    const double y = mVertexCoordinates[vertexIndex * 2 + 1];
+    extent.minX = std::min( extent.minX, x );
+    extent.maxX = std::max( extent.maxX, x );
+    extent.minY = std::min( extent.minY, y );
+    extent.maxY = std::max( extent.maxY, y );
+  }
+  return extent;
+}
+
+void MDAL::MeshSpatialIndex::buildGrid()
+{
+  for ( size_t faceIndex = 0; faceIndex < mFacesCount; ++faceIndex )
+  {
+    const BBox extent = faceExtent( faceIndex );
+    if ( extent.minX > extent.maxX )
+      continue;
+    mExtent.minX = std::min( mExtent.minX, extent.minX );
+    mExtent.maxX = std::max( mExtent.maxX, extent.maxX );
+    mExtent.minY = std::min( mExtent.minY, extent.minY );
+    mExtent.maxY = std::max( mExtent.maxY, extent.maxY );
+  }
+
+  if ( mExtent.minX > mExtent.maxX )
+    return; // no valid face
+
+  // about one cell per face, with square cells when possible
+  const double width = mExtent.maxX - mExtent.minX;
+  const double height = mExtent.maxY - mExtent.minY;
+  const double faces = static_cast<double>( mFacesCount );
+  double cellSize = std::sqrt( width * height / faces );
+  if ( !( cellSize > 0 ) )
+    cellSize = std::max( width, height ) / faces;
+
+  mColumns = 1;
+  mRows = 1;
+  if ( cellSize > 0 )
+  {
+    mColumns = static_cast<size_t>( std::min( faces, std::max( 1.0, std::ceil( width / cellSize ) ) ) );
+    mRows = static_cast<size_t>( std::min( faces, std::max( 1.0, std::ceil( height / cellSize ) ) ) );
+  }
+  mCellWidth = width > 0 ? width / static_cast<double>( mColumns ) : 1.0;
+  mCellHeight = height > 0 ? height / static_cast<double>( mRows ) : 1.0;
+
+  // each thread fills the cells of a band of rows, for the faces intersecting the band
+  const size_t rowsPerThread = mFacesCount < PARALLEL_CHUNK_SIZE ? mRows : 1;
+  // returns false for faces that are never found
+  auto cellRange = [this]( size_t faceIndex, size_t & column0, size_t & column1, size_t & row0, size_t & row1 )
+  {
+    const BBox extent = faceExtent( faceIndex );
+    if ( extent.minX > extent.maxX )
+      return false;
+    const double maxColumn = static_cast<double>( mColumns - 1 );
+    const double maxRow = static_cast<double>( mRows - 1 );
+    column0 = static_cast<size_t>( std::min( maxColumn, std::floor( ( extent.minX - mExtent.minX ) / mCellWidth ) ) );
+    column1 = static_cast<size_t>( std::min( maxColumn, std::floor( ( extent.maxX - mExtent.minX ) / mCellWidth ) ) );
+    row0 = static_cast<size_t>( std::min( maxRow, std::floor( ( extent.minY - mExtent.minY ) / mCellHeight ) ) );
+    row1 = static_cast<size_t>( std::min( maxRow, std::floor( ( extent.maxY - mExtent.minY ) / mCellHeight ) ) );
+    return true;
+  };
+
+  std::vector<size_t> cellCounts( mColumns * mRows, 0 );
+  parallelFor( mRows, rowsPerThread, [&]( size_t beginRow, size_t endRow )
+  {
+    size_t column0, column1, row0, row1;
+    for ( size_t faceIndex = 0; faceIndex < mFacesCount; ++faceIndex )
+    {
+      if ( !cellRange( faceIndex, column0, column1, row0, row1 ) )
+        continue;
+      for ( size_t row = std::max( row0, beginRow ); row <= row1 && row < endRow; ++row )
+        for ( size_t column = column0; column <= column1; ++column )
+          ++cellCounts[row * mColumns + column];
+    }
+  } );
+
+  mCellOffsets.resize( cellCounts.size() + 1 );
+  mCellOffsets[0] = 0;
+  for ( size_t i = 0; i < cellCounts.size(); ++i )
+    mCellOffsets[i + 1] = mCellOffsets[i] + cellCounts[i];
+  mCellFaces.resize( mCellOffsets.back() );
+
+  // faces are added in increasing order, so the lowest face index is found first in each cell
+  parallelFor( mRows, rowsPerThread, [&]( size_t beginRow, size_t endRow )
+  {
+    std::vector<size_t> cursors( mCellOffsets.begin() + static_cast<std::ptrdiff_t>( beginRow * mColumns ),
+                                 mCellOffsets.begin() + static_cast<std::ptrdiff_t>( endRow * mColumns ) );
+    size_t column0, column1, row0, row1;
+    for ( size_t faceIndex = 0; faceIndex < mFacesCount; ++faceIndex )
+    {
+      if ( !cellRange( faceIndex, column0, column1, row0, row1 ) )
+        continue;
+      for ( size_t row = std::max( row0, beginRow ); row <= row1 && row < endRow; ++row )
+        for ( size_t column = column0; column <= column1; ++column )
+          mCellFaces[cursors[( row - beginRow ) * mColumns + column]++] = faceIndex;
+    }
+  } );
+}
+
+bool MDAL::MeshSpatialIndex::faceContains( size_t faceIndex, double x, double y ) const
+{
+  // crossing number of an horizontal ray from the point, faces with invalid vertices are not in the grid.
+  // The crossing number alone misses the points on the right and top edges, the points on the edges are inside
+  const size_t begin = faceOffset( faceIndex );
+  const size_t end = faceOffset( faceIndex + 1 );
+  bool inside = false;
+  for ( size_t i = begin, j = end - 1; i < end; j = i++ )
+  {
+    const size_t vertexI = mFaceVertices[i];
+    const size_t vertexJ = mFaceVertices[j];
+    const double xi = mVertexCoordinates[vertexI * 2];
+    const double yi = mVertexCoordinates[vertexI * 2 + 1];
+    const double xj = mVertexCoordinates[vertexJ * 2];
+    const double yj = mVertexCoordinates[vertexJ * 2 + 1];
+
+    const double dx = xj - xi;
+    const double dy = yj - yi;
+    const double lengthSquared = dx * dx + dy * dy;
+    const double cross = dx * ( y - yi ) - dy * ( x - xi );
+    const double dot = dx * ( x - xi ) + dy * ( y - yi );
+    if ( lengthSquared > 0 &&
+         std::fabs( cross ) <= EDGE_TOLERANCE * lengthSquared &&
+         dot >= -EDGE_TOLERANCE * lengthSquared &&
+         dot <= ( 1 + EDGE_TOLERANCE ) * lengthSquared )
+      return true;
+
+    if ( ( ( yi > y ) != ( yj > y ) ) && ( x < ( xj - xi ) * ( y - yi ) / ( yj - yi ) + xi ) )
+      inside = !inside;
+  }
+  return inside;
+}
+
+int64_t MDAL::MeshSpatialIndex::faceAt( double x, double y ) const
+{
+  if ( mCellOffsets.empty() ||
+       !( x >= mExtent.minX && x <= mExtent.maxX && y >= mExtent.minY && y <= mExtent.maxY ) )
+    return -1;
+
+  const size_t column = std::min( mColumns - 1, static_cast<size_t>( ( x - mExtent.minX ) / mCellWidth ) );
+  const size_t row = std::min( mRows - 1, static_cast<size_t>( ( y - mExtent.minY ) / mCellHeight ) );
+  const size_t cell = row * mColumns + column;
+
+  for ( size_t i = mCellOffsets[cell]; i < mCellOffsets[cell + 1]; ++i )
+  {
+    if ( faceContains( mCellFaces[i], x, y ) )
+      return static_cast<int64_t>( mCellFaces[i] );
+  }
+
+  return -1;
+}
+
+int64_t MDAL::MeshSpatialIndex::interpolationAt( double x, double y, size_t *vertexIndexes, double *weights ) const
+{
+  const int64_t faceIndex = faceAt( x, y );
+  if ( faceIndex < 0 )
+    return -1;
+
+  const size_t begin = faceOffset( static_cast<size_t>( faceIndex ) );
+  const size_t faceSize = faceOffset( static_cast<size_t>( faceIndex ) + 1 ) - begin;
+  std::vector<size_t> faceVertices( faceSize );
+  std::vector<double> coordinates( faceSize * 2 );
+  for ( size_t i = 0; i < faceSize; ++i )
+  {
+    faceVertices[i] = mFaceVertices[begin + i];
+    coordinates[i * 2] = mVertexCoordinates[faceVertices[i] * 2];
+    coordinates[i * 2 + 1] = mVertexCoordinates[faceVertices[i] * 2 + 1];
+  }
+
+  if ( !fanInterpolation( faceSize, faceVertices.data(), coordinates.data(), x, y, vertexIndexes, weights ) )
+    return -1;
+
+  return faceIndex;
+}
+
+bool MDAL::MeshSpatialIndex::fanInterpolation( size_t faceSize, const size_t *faceVertices, const double *coordinates,
+    double x, double y, size_t *vertexIndexes, double *weights )
+{
+  const double x0 = coordinates[0];
+  const double y0 = coordinates[1];
+
+  // the point may lie on the border of the fan triangles, keep the triangle where it is the least outside
+  double bestMinimumWeight = -std::numeric_limits<double>::max();
+  for ( size_t i = 1; i + 1 < faceSize; ++i )
+  {
+    const double x1 = coordinates[i * 2];
+    const double y1 = coordinates[i * 2 + 1];
+    const double x2 = coordinates[i * 2 + 2];
+    const double y2 = coordinates[i * 2 + 3];
+
+    const double det = ( y1 - y2 ) * ( x0 - x2 ) + ( x2 - x1 ) * ( y0 - y2 );
+    if ( det == 0 )
+      continue; // degenerated triangle
+
+    const double w0 = ( ( y1 - y2 ) * ( x - x2 ) + ( x2 - x1 ) * ( y - y2 ) ) / det;
+    const double w1 = ( ( y2 - y0 ) * ( x - x2 ) + ( x0 - x2 ) * ( y - y2 ) ) / det;
+    const double w2 = 1.0 - w0 - w1;
+    const double minimumWeight = std::min( w0, std::min( w1, w2 ) );
+    if ( minimumWeight > bestMinimumWeight )
+    {
+      bestMinimumWeight = minimumWeight;
+      vertexIndexes[0] = faceVertices[0];
+      vertexIndexes[1] = faceVertices[i];
+      vertexIndexes[2] = faceVertices[i + 1];
+      weights[0] = w0;
+      weights[1] = w1;
+      weights[2] = w2;
+      if ( minimumWeight >= 0 )
+        break;
+    }
+  }
+
+  return bestMinimumWeight != -std::numeric_limits<double>::max();
+}
+
+size_t MDAL::MeshSpatialIndex::facesAt( size_t count, const double *coordinates, int64_t *faceIndexes ) const
+{
+  parallelFor( count, PARALLEL_CHUNK_SIZE, [this, coordinates, faceIndexes]( size_t begin, size_t end )
+  {
+    for ( size_t i = begin; i < end; ++i )
+      faceIndexes[i] = faceAt( coordinates[i * 2], coordinates[i * 2 + 1] );
+  } );
+
+  return static_cast<size_t>( std::count_if( faceIndexes, faceIndexes + count, []( int64_t faceIndex ) { return faceIndex >= 0; } ) );
+}
@@ -0,0 +1,108 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#ifndef MDAL_SPATIAL_INDEX_HPP
+#define MDAL_SPATIAL_INDEX_HPP
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mdal_data_model.hpp"
+
+namespace MDAL
+{
+  /**
+   * Spatial index of the faces of a mesh
+   *
+   * The extent of the mesh is divided in a uniform grid of about one cell per face, each cell
+   * references the faces whose bounding box intersects it. A point is located by testing only the
+   * faces of the cell containing it.
+   *
+   * The index keeps its own copy of the vertex coordinates and of the faces, so it stays valid
+   * if the mesh source is closed, but needs to be rebuilt if the mesh is modified, see isUpToDate().
+   * The faces are stored with 32 bits indices when possible and their extents are computed when needed,
+   * to keep the index small compared to the mesh.
+   * Once built, the index is read-only and can be used from different threads.
+   *
+   * Meshes that can locate points without storing their faces, like regular grids, provide a subclass
+   * overriding faceAt() and interpolationAt().
+   */
+  class MeshSpatialIndex
+  {
+    public:
+      //! Builds the index of the faces of the \a mesh, reading the vertices and faces with the mesh iterators
+      explicit MeshSpatialIndex( Mesh *mesh );
+      virtual ~MeshSpatialIndex();
+
+      //! Returns whether the index has been built with the current count of vertices and faces of the \a mesh
+      virtual bool isUpToDate( const Mesh *mesh ) const;
+
+      //! Returns the index of the face containing the point (\a x, \a y), or -1 if no face contains it
+      virtual int64_t faceAt( double x, double y ) const;
+
+      /**
+       * Sets in \a faceIndexes the index of the face containing each of the \a count points stored in \a coordinates
+       * in form x1, y1, ..., xN, yN, or -1 for points outside the mesh.
+       * Returns the count of points located in a face
+       */
+      size_t facesAt( size_t count, const double *coordinates, int64_t *faceIndexes ) const;
+
+      /**
+       * Returns the index of the face containing the point (\a x, \a y), or -1 if no face contains it,
+       * and sets in \a vertexIndexes and \a weights the 3 vertices and their barycentric weights to interpolate
+       * values defined on vertices at this point. Faces with more than 3 vertices are split in a fan of triangles
+       * from their first vertex and the triangle containing the point is used.
+       */
+      virtual int64_t interpolationAt( double x, double y, size_t *vertexIndexes, double *weights ) const;
+
+    protected:
+      //! Constructs an empty index, for subclasses that do not store the faces
+      MeshSpatialIndex() = default;
+
+      /**
+       * Sets in \a vertexIndexes and \a weights the vertices and barycentric weights of the point (\a x, \a y) in the fan
+       * of triangles from the first vertex of the face with \a faceSize vertices \a faceVertices and \a coordinates
+       * in form x1, y1, ..., xN, yN. Returns false if all the triangles are degenerated
+       */
+      static bool fanInterpolation( size_t faceSize, const size_t *faceVertices, const double *coordinates,
+                                    double x, double y, size_t *vertexIndexes, double *weights );
+
+    private:
+      void readMesh( Mesh *mesh );
+      void buildGrid();
+
+      //! Returns the offset of the first vertex of the face in mFaceVertices
+      size_t faceOffset( size_t faceIndex ) const
+      {
+        return mWideFaceOffsets.empty() ? mFaceOffsets[faceIndex] : mWideFaceOffsets[faceIndex];
+      }
+
+      //! Returns the extent of the face, empty if the face references invalid vertices
+      BBox faceExtent( size_t faceIndex ) const;
+
+      //! Returns whether the face contains the point (\a x, \a y)
+      bool faceContains( size_t faceIndex, double x, double y ) const;
+
+      size_t mVerticesCount = 0;
+      size_t mFacesCount = 0;
+
+      std::vector<double> mVertexCoordinates; // x1, y1, ..., xN, yN
+      // faces in compressed sparse row layout, the offsets are stored on 64 bits only if their count overflows 32 bits
+      std::vector<uint32_t> mFaceOffsets;
+      std::vector<size_t> mWideFaceOffsets;
+      std::vector<uint32_t> mFaceVertices; // INVALID_VERTEX for invalid indices
+
+      BBox mExtent;
+      size_t mColumns = 0;
+      size_t mRows = 0;
+      double mCellWidth = 0;
+      double mCellHeight = 0;
+      std::vector<size_t> mCellOffsets; // faces of each cell in compressed sparse row layout
+      std::vector<size_t> mCellFaces;
+  };
+
+} // namespace MDAL
+#endif //MDAL_SPATIAL_INDEX_HPP
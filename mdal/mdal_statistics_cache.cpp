@@ -0,0 +1,374 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#include "mdal_statistics_cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "mdal_utils.hpp"
+#include "mdal_histogram.hpp"
+#include "mdal_logger.hpp"
+
+static const char CACHE_MAGIC[8] = {'M', 'D', 'A', 'L', 'S', 'T', 'A', 'T'};
+static const uint32_t CACHE_VERSION = 3;
+
+static std::atomic<bool> sEnabled( false );
+static std::mutex sDirectoryMutex;
+static std::string sDirectory;
+
+// serializes the reads and writes of the cache files by the different meshes
+static std::mutex sCacheFilesMutex;
+
+namespace
+{
+  //! Identifies the state of a file, the cache is valid only for the state it was written for
+  struct FileKey
+  {
+    uint64_t size = 0;
+    int64_t modificationTime = 0; // seconds
+    int64_t modificationTimeNs = 0; // nanoseconds within the second, 0 where not available
+  };
+
+  //! Statistics of a dataset, the histogram is null if it has not been computed
+  struct DatasetEntry
+  {
+    MDAL::Statistics statistics;
+    std::shared_ptr<const MDAL::Histogram> histogram;
+  };
+
+  //! Statistics of the datasets of a group, by time in hours
+  typedef std::map<double, DatasetEntry> GroupEntry;
+
+  //! Entries of the groups of a file, by group key
+  typedef std::map<std::string, GroupEntry> CacheEntries;
+}
+
+static bool fileKey( const std::string &file, FileKey &key )
+{
+  struct stat st;
+  if ( stat( file.c_str(), &st ) != 0 )
+    return false;
+
+  key.size = static_cast<uint64_t>( st.st_size );
+  key.modificationTime = static_cast<int64_t>( st.st_mtime );
+  // a file rewritten with the same size within the same second must not match
+#if defined(WIN32)
+  key.modificationTimeNs = 0;
+#elif (defined(__APPLE__) && defined(__MACH__))
+  key.modificationTimeNs = static_cast<int64_t>( st.st_mtimespec.tv_nsec );
+#else
+  key.modificationTimeNs = static_cast<int64_t>( st.st_mtim.tv_nsec );
+#endif
+  return true;
+}
+
+//! Returns the file the group is read from, or an empty string if it is not an existing file
+static std::string groupFile( MDAL::DatasetGroup *group, std::string &meshName )
+{
+  std::string driver, file;
+  MDAL::parseDriverAndMeshFromUri( group->uri(), driver, file, meshName );
+  if ( file.empty() || !MDAL::fileExists( file ) )
+    return std::string();
+  return file;
+}
+
+static std::string groupKey( MDAL::DatasetGroup *group, const std::string &meshName )
+{
+  std::ostringstream key;
+  key << meshName << '\n' << group->name() << '\n' << static_cast<int>( group->dataLocation() ) << '\n' << group->isScalar();
+  return key.str();
+}
+
+//! Returns false if two datasets of the group have the same time, they cannot be told apart in the cache
+static bool hasDistinctTimes( MDAL::DatasetGroup *group )
+{
+  std::vector<double> times;
+  times.reserve( group->datasets.size() );
+  for ( const std::shared_ptr<MDAL::Dataset> &dataset : group->datasets )
+    times.push_back( dataset->time( MDAL::RelativeTimestamp::hours ) );
+  std::sort( times.begin(), times.end() );
+  return std::adjacent_find( times.begin(), times.end() ) == times.end();
+}
+
+static bool sameStatistics( const MDAL::Statistics &stats1, const MDAL::Statistics &stats2 )
+{
+  // NaN statistics (no valid value) are equal
+  return std::memcmp( &stats1.minimum, &stats2.minimum, sizeof( double ) ) == 0 &&
+         std::memcmp( &stats1.maximum, &stats2.maximum, sizeof( double ) ) == 0;
+}
+
+template<typename T>
+static bool readValue( std::ifstream &in, T &value )
+{
+  in.read( reinterpret_cast<char *>( &value ), sizeof( T ) );
+  return static_cast<bool>( in );
+}
+
+template<typename T>
+static void writeValue( std::ofstream &out, const T &value )
+{
+  out.write( reinterpret_cast<const char *>( &value ), sizeof( T ) );
+}
+
+//! Reads the entries of the cache file \a path, returns false if it does not exist, is invalid or is written for another \a key
+static bool readCache( const std::string &path, const FileKey &key, CacheEntries &entries )
+{
+  std::ifstream in( path, std::ifstream::in | std::ifstream::binary );
+  if ( !in )
+    return false;
+
+  char magic[8];
+  uint32_t version;
+  FileKey cachedKey;
+  uint64_t groupsCount;
+  in.read( magic, 8 );
+  if ( !in || std::memcmp( magic, CACHE_MAGIC, 8 ) != 0 ||
+       !readValue( in, version ) || version != CACHE_VERSION ||
+       !readValue( in, cachedKey.size ) || !readValue( in, cachedKey.modificationTime ) || !readValue( in, cachedKey.modificationTimeNs ) ||
+       cachedKey.size != key.size || cachedKey.modificationTime != key.modificationTime || cachedKey.modificationTimeNs != key.modificationTimeNs ||
+       !readValue( in, groupsCount ) )
+    return false;
+
+  for ( uint64_t i = 0; i < groupsCount; ++i )
+  {
+    uint32_t keyLength;
+    uint64_t datasetsCount;
+    if ( !readValue( in, keyLength ) )
+      return false;
+    std::string groupKey( keyLength, '\0' );
+    in.read( &groupKey[0], keyLength );
+    if ( !in || !readValue( in, datasetsCount ) )
+      return false;
+
+    GroupEntry &entry = entries[groupKey];
+    for ( uint64_t j = 0; j < datasetsCount; ++j )
+    {
+      double time;
+      DatasetEntry dataset;
+      uint8_t hasHistogram;
+      if ( !readValue( in, time ) || !readValue( in, dataset.statistics.minimum ) || !readValue( in, dataset.statistics.maximum ) ||
+           !readValue( in, hasHistogram ) )
+        return false;
+
+      if ( hasHistogram )
+      {
+        std::shared_ptr<MDAL::Histogram> histogram = std::make_shared<MDAL::Histogram>();
+        if ( !histogram->read( in ) )
+          return false;
+        dataset.histogram = histogram;
+      }
+      entry[time] = dataset;
+    }
+  }
+
+  return true;
+}
+
+static bool writeCache( const std::string &path, const FileKey &key, const CacheEntries &entries )
+{
+  std::ofstream out( path, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc );
+  if ( !out )
+    return false;
+
+  out.write( CACHE_MAGIC, 8 );
+  writeValue( out, CACHE_VERSION );
+  writeValue( out, key.size );
+  writeValue( out, key.modificationTime );
+  writeValue( out, key.modificationTimeNs );
+  writeValue( out, static_cast<uint64_t>( entries.size() ) );
+  for ( const auto &entry : entries )
+  {
+    writeValue( out, static_cast<uint32_t>( entry.first.size() ) );
+    out.write( entry.first.data(), static_cast<std::streamsize>( entry.first.size() ) );
+    writeValue( out, static_cast<uint64_t>( entry.second.size() ) );
+    for ( const auto &dataset : entry.second )
+    {
+      writeValue( out, dataset.first );
+      writeValue( out, dataset.second.statistics.minimum );
+      writeValue( out, dataset.second.statistics.maximum );
+      writeValue( out, static_cast<uint8_t>( dataset.second.histogram ? 1 : 0 ) );
+      if ( dataset.second.histogram )
+        dataset.second.histogram->write( out );
+    }
+  }
+
+  out.close();
+  return static_cast<bool>( out );
+}
+
+//! Writes the cache file \a path through a temporary file renamed when complete, so a partially written file is never read
+static bool replaceCache( const std::string &path, const FileKey &key, const CacheEntries &entries )
+{
+  // unique name, other processes may write the same cache file
+  std::ostringstream tmpPath;
+  tmpPath << path << "." << std::hex << std::random_device()() << ".tmp";
+
+  if ( !writeCache( tmpPath.str(), key, entries ) )
+  {
+    std::remove( tmpPath.str().c_str() );
+    return false;
+  }
+
+#if defined(WIN32)
+  // rename does not replace an existing file
+  std::remove( path.c_str() );
+#endif
+  if ( std::rename( tmpPath.str().c_str(), path.c_str() ) != 0 )
+  {
+    std::remove( tmpPath.str().c_str() );
+    return false;
+  }
+  return true;
+}
+
+//! Groups of the range, with distinct dataset times, by file they are read from, with their key
+static std::map<std::string, std::vector<std::pair<MDAL::DatasetGroup *, std::string>>> groupsByFile(
+      const MDAL::DatasetGroups &groups, size_t firstIndex )
+{
+  std::map<std::string, std::vector<std::pair<MDAL::DatasetGroup *, std::string>>> ret;
+  for ( size_t i = firstIndex; i < groups.size(); ++i )
+  {
+    MDAL::DatasetGroup *group = groups[i].get();
+    if ( group->isInEditMode() || group->datasets.empty() || !hasDistinctTimes( group ) )
+      continue;
+
+    std::string meshName;
+    const std::string file = groupFile( group, meshName );
+    if ( !file.empty() )
+      ret[file].push_back( std::make_pair( group, groupKey( group, meshName ) ) );
+  }
+  return ret;
+}
+
+void MDAL::StatisticsCache::setEnabled( bool enabled )
+{
+  sEnabled = enabled;
+}
+
+bool MDAL::StatisticsCache::isEnabled()
+{
+  return sEnabled;
+}
+
+void MDAL::StatisticsCache::setDirectory( const std::string &directory )
+{
+  std::lock_guard<std::mutex> lock( sDirectoryMutex );
+  sDirectory = directory;
+}
+
+std::string MDAL::StatisticsCache::directory()
+{
+  std::lock_guard<std::mutex> lock( sDirectoryMutex );
+  return sDirectory;
+}
+
+std::string MDAL::StatisticsCache::cachePath( const std::string &file )
+{
+  const std::string cacheDirectory = directory();
+  if ( cacheDirectory.empty() )
+    return file + ".mdalcache";
+
+  // files with the same name in different directories get different cache files
+  std::ostringstream name;
+  name << MDAL::baseName( file, true ) << "." << std::hex << std::hash<std::string>()( file ) << ".mdalcache";
+  return MDAL::pathJoin( cacheDirectory, name.str() );
+}
+
+void MDAL::StatisticsCache::apply( const DatasetGroups &groups, size_t firstIndex )
+{
+  if ( !isEnabled() )
+    return;
+
+  for ( const auto &fileGroups : groupsByFile( groups, firstIndex ) )
+  {
+    FileKey key;
+    CacheEntries entries;
+    {
+      std::lock_guard<std::mutex> lock( sCacheFilesMutex );
+      if ( !fileKey( fileGroups.first, key ) || !readCache( cachePath( fileGroups.first ), key, entries ) )
+        continue;
+    }
+
+    for ( const auto &group : fileGroups.second )
+    {
+      auto entry = entries.find( group.second );
+      if ( entry == entries.end() )
+        continue;
+
+      for ( const std::shared_ptr<Dataset> &dataset : group.first->datasets )
+      {
+        auto cached = entry->second.find( dataset->time( RelativeTimestamp::hours ) );
+        if ( cached == entry->second.end() )
+          continue;
+
+        if ( !dataset->hasStatistics() )
+          dataset->setStatistics( cached->second.statistics );
+        if ( cached->second.histogram && !dataset->hasHistogram() )
+          dataset->setHistogram( cached->second.histogram );
+      }
+    }
+  }
+}
+
+void MDAL::StatisticsCache::save( const DatasetGroups &groups )
+{
+  if ( !isEnabled() )
+    return;
+
+  for ( const auto &fileGroups : groupsByFile( groups, 0 ) )
+  {
+    std::lock_guard<std::mutex> lock( sCacheFilesMutex );
+
+    FileKey key;
+    if ( !fileKey( fileGroups.first, key ) )
+      continue;
+
+    // entries of the datasets not loaded (open options) are kept
+    const std::string path = cachePath( fileGroups.first );
+    CacheEntries entries;
+    if ( !readCache( path, key, entries ) )
+      entries.clear();
+
+    bool modified = false;
+    for ( const auto &group : fileGroups.second )
+    {
+      GroupEntry &entry = entries[group.second];
+      for ( const std::shared_ptr<Dataset> &dataset : group.first->datasets )
+      {
+        if ( !dataset->hasStatistics() )
+          continue;
+
+        DatasetEntry cached;
+        cached.statistics = dataset->statistics();
+        if ( dataset->hasHistogram() )
+          cached.histogram = dataset->histogram();
+
+        auto it = entry.find( dataset->time( RelativeTimestamp::hours ) );
+        if ( it != entry.end() && sameStatistics( it->second.statistics, cached.statistics ) &&
+             ( it->second.histogram || !cached.histogram ) )
+          continue;
+
+        entry[dataset->time( RelativeTimestamp::hours )] = cached;
+        modified = true;
+      }
+    }
+
+    if ( modified && !replaceCache( path, key, entries ) )
+      MDAL::Log::debug( "Unable to write statistics cache file " + path );
+  }
+}
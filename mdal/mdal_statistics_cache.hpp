@@ -0,0 +1,53 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+
+#ifndef MDAL_STATISTICS_CACHE_HPP
+#define MDAL_STATISTICS_CACHE_HPP
+
+#include <string>
+#include <stddef.h>
+
+#include "mdal_data_model.hpp"
+
+namespace MDAL
+{
+  /**
+   * Sidecar files keeping the statistics and the histograms of the datasets read from a file, so they are not computed again
+   * when the file is opened later. Disabled by default, see MDAL_SetStatisticsCacheEnabled()
+   *
+   * The cache file of a file is written next to it with the .mdalcache suffix, or in the cache directory if set.
+   * It stores the size and the modification time of the file, with sub-second precision where available,
+   * and is ignored when they do not match anymore. It is written to a temporary file renamed when complete.
+   * Statistics are stored per dataset group, identified by its mesh, name, data location and kind of values,
+   * and per dataset, identified by its time.
+   */
+  class StatisticsCache
+  {
+    public:
+      static void setEnabled( bool enabled );
+      static bool isEnabled();
+
+      //! Sets the directory of the cache files, empty to write them next to the files
+      static void setDirectory( const std::string &directory );
+      static std::string directory();
+
+      //! Returns the path of the cache file of \a file
+      static std::string cachePath( const std::string &file );
+
+      /**
+       * Sets the statistics and the histograms of the datasets of \a groups, starting at \a firstIndex, found in the cache
+       * files of the files they are read from. Statistics already known are kept. Does nothing if the cache is disabled
+       */
+      static void apply( const DatasetGroups &groups, size_t firstIndex = 0 );
+
+      /**
+       * Adds the statistics and the histograms known for the datasets of \a groups to the cache files of the files they are read from.
+       * Groups in edit mode are skipped. Does nothing if the cache is disabled
+       */
+      static void save( const DatasetGroups &groups );
+  };
+
+} // namespace MDAL
+#endif //MDAL_STATISTICS_CACHE_HPP
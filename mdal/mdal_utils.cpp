@@ -4,6 +4,8 @@
 */
 
 #include "mdal_utils.hpp"
+#include "mdal_histogram.hpp"
+#include "mdal_logger.hpp"
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -14,6 +16,10 @@
 #include <string.h>
 #include <stdio.h>
 #include <ctime>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
 
 bool MDAL::fileExists( const std::string &filename )
 {
@@ -385,6 +391,63 @@ MDAL::BBox MDAL::computeExtent( const MDAL::Vertices &vertices )
   return b;
 }
 
+static std::atomic<size_t> sThreadCount( 0 );
+
+void MDAL::setThreadCount( size_t count )
+{
+  sThreadCount = count;
+}
+
+size_t MDAL::threadCount()
+{
+  const size_t count = sThreadCount;
+  if ( count > 0 )
+    return count;
+
+  return std::max( 1u, std::thread::hardware_concurrency() );
+}
+
+void MDAL::parallelFor( size_t count, size_t minChunkSize, const std::function<void( size_t, size_t )> &func )
+{
+  if ( count == 0 )
+    return;
+
+  const size_t chunkCount = std::min( threadCount(), std::max<size_t>( 1, count / std::max<size_t>( 1, minChunkSize ) ) );
+
+  if ( chunkCount == 1 )
+  {
+    func( 0, count );
+    return;
+  }
+
+  const size_t chunkSize = ( count + chunkCount - 1 ) / chunkCount;
+  std::vector<std::thread> threads;
+  std::vector<MDAL_Status> statuses( chunkCount, MDAL_Status::None );
+  threads.reserve( chunkCount - 1 );
+  for ( size_t begin = chunkSize, i = 0; begin < count; begin += chunkSize, ++i )
+  {
+    const size_t end = std::min( begin + chunkSize, count );
+    MDAL_Status &status = statuses[i];
+    threads.emplace_back( [&func, &status, begin, end]()
+    {
+      func( begin, end );
+      status = MDAL::Log::getLastStatus();
+    } );
+  }
+
+  func( 0, std::min( chunkSize, count ) );
+
+  for ( std::thread &thread : threads )
+    thread.join();
+
+  // the last status is kept per thread
+  for ( MDAL_Status status : statuses )
+  {
+    if ( status != MDAL_Status::None )
+      MDAL::Log::setLastStatus( status );
+  }
+}
+
 double MDAL::safeValue( double val, double nodata, double eps )
 {
   if ( std::isnan( val ) )
@@ -447,50 +510,74 @@ std::string MDAL::getCurrentTimeStamp()
   return s;
 }
 
-MDAL::Statistics _calculateStatistics( const std::vector<double> &values, size_t count, bool isVector )
-{
-  MDAL::Statistics ret;
+//! Number of independent accumulators of the statistics kernel, fills the widest vector registers
+static const size_t STATISTICS_LANES = 8;
 
-  double min = std::numeric_limits<double>::quiet_NaN();
-  double max = std::numeric_limits<double>::quiet_NaN();
-  bool firstIteration = true;
+//! Number of values read at once when calculating the statistics of a dataset
+static const size_t STATISTICS_BLOCK_SIZE = 1 << 18;
 
-  for ( size_t i = 0; i < count; ++i )
+MDAL::Statistics MDAL::calculateStatistics( const double *values, size_t count, bool isVector )
+{
+  // The loops have no branch and a fixed number of independent accumulators, so that the compiler can
+  // vectorize them for the target instruction set. NaN values are skipped as they never compare lower or greater.
+  // Magnitudes are compared squared, the square root is taken only for the results.
+  double mins[STATISTICS_LANES];
+  double maxs[STATISTICS_LANES];
+  std::fill( mins, mins + STATISTICS_LANES, std::numeric_limits<double>::infinity() );
+  std::fill( maxs, maxs + STATISTICS_LANES, -std::numeric_limits<double>::infinity() );
+
+  const size_t lanesEnd = count - count % STATISTICS_LANES;
+  size_t i = 0;
+  if ( isVector )
   {
-    double magnitude;
-    if ( isVector )
+    for ( ; i < lanesEnd; i += STATISTICS_LANES )
     {
-      double x = values[2 * i];
-      double y = values[2 * i + 1];
-      if ( std::isnan( x ) || std::isnan( y ) )
-        continue;
-      magnitude = sqrt( x * x + y * y );
-    }
-    else
-    {
-      double x = values[i];
-      if ( std::isnan( x ) )
-        continue;
-      magnitude = x;
+      const double *block = values + 2 * i;
+      for ( size_t j = 0; j < STATISTICS_LANES; ++j )
+      {
+        const double x = block[2 * j];
+        const double y = block[2 * j + 1];
+        const double squared = x * x + y * y;
+        mins[j] = squared < mins[j] ? squared : mins[j];
+        maxs[j] = squared > maxs[j] ? squared : maxs[j];
+      }
     }
-
-    if ( firstIteration )
+    for ( ; i < count; ++i )
     {
-      firstIteration = false;
-      min = magnitude;
-      max = magnitude;
+      const double squared = values[2 * i] * values[2 * i] + values[2 * i + 1] * values[2 * i + 1];
+      mins[0] = squared < mins[0] ? squared : mins[0];
+      maxs[0] = squared > maxs[0] ? squared : maxs[0];
     }
-    else
+  }
+  else
+  {
+    for ( ; i < lanesEnd; i += STATISTICS_LANES )
     {
-      if ( magnitude < min )
+      const double *block = values + i;
+      for ( size_t j = 0; j < STATISTICS_LANES; ++j )
       {
-        min = magnitude;
-      }
-      if ( magnitude > max )
-      {
-        max = magnitude;
+        mins[j] = block[j] < mins[j] ? block[j] : mins[j];
+        maxs[j] = block[j] > maxs[j] ? block[j] : maxs[j];
       }
     }
+    for ( ; i < count; ++i )
+    {
+      mins[0] = values[i] < mins[0] ? values[i] : mins[0];
+      maxs[0] = values[i] > maxs[0] ? values[i] : maxs[0];
+    }
+  }
+
+  double min = *std::min_element( mins, mins + STATISTICS_LANES );
+  double max = *std::max_element( maxs, maxs + STATISTICS_LANES );
+
+  MDAL::Statistics ret;
+  if ( min > max )
+    return ret; // only NaN values
+
+  if ( isVector )
+  {
+    min = std::sqrt( min );
+    max = std::sqrt( max );
   }
 
   ret.minimum = min;
@@ -503,21 +590,98 @@ MDAL::Statistics MDAL::calculateStatistics( std::shared_ptr<MDAL::DatasetGroup>
   return calculateStatistics( grp.get() );
 }
 
+/**
+ * Calls \a func with the index of each dataset of \a datasets, in parallel. The calls for the datasets not supporting
+ * concurrent reads are made one at a time. The first exception thrown by \a func is rethrown in the calling thread,
+ * and the last status logged by the worker threads is set in the calling thread, see parallelFor()
+ */
+static void _forEachDataset( const MDAL::Datasets &datasets, const std::function<void( size_t )> &func )
+{
+  if ( datasets.empty() )
+    return;
+
+  // each thread gets at least a block of values, so small datasets are not spread over threads for nothing
+  const size_t valuesCount = std::max<size_t>( 1, datasets.front()->valuesCount() );
+  const size_t minDatasetsPerThread = std::max<size_t>( 1, STATISTICS_BLOCK_SIZE / valuesCount );
+
+  std::mutex readMutex;
+  std::mutex errorMutex;
+  std::exception_ptr error;
+  MDAL::parallelFor( datasets.size(), minDatasetsPerThread, [&]( size_t begin, size_t end )
+  {
+    try
+    {
+      for ( size_t i = begin; i < end; ++i )
+      {
+        if ( datasets[i]->supportsConcurrentReads() )
+        {
+          func( i );
+        }
+        else
+        {
+          std::lock_guard<std::mutex> lock( readMutex );
+          func( i );
+        }
+      }
+    }
+    catch ( ... )
+    {
+      std::lock_guard<std::mutex> lock( errorMutex );
+      if ( !error )
+        error = std::current_exception();
+    }
+  } );
+
+  if ( error )
+    std::rethrow_exception( error );
+}
+
 MDAL::Statistics MDAL::calculateStatistics( DatasetGroup *grp )
 {
   Statistics ret;
   if ( !grp )
     return ret;
 
-  for ( std::shared_ptr<Dataset> ds : grp->datasets )
+  const Datasets &datasets = grp->datasets;
+  std::vector<Statistics> datasetsStatistics( datasets.size() );
+  _forEachDataset( datasets, [&]( size_t i )
   {
-    MDAL::Statistics dsStats = ds->statistics();
+    datasetsStatistics[i] = datasets[i]->statistics();
+  } );
+
+  // combined in the order of the datasets, as in a serial computation
+  for ( const Statistics &dsStats : datasetsStatistics )
     combineStatistics( ret, dsStats );
-  }
+
+  return ret;
+}
+
+MDAL::Histogram MDAL::calculateHistogram( DatasetGroup *grp )
+{
+  Histogram ret;
+  if ( !grp )
+    return ret;
+
+  const Datasets &datasets = grp->datasets;
+  std::vector<std::shared_ptr<const Histogram>> datasetsHistograms( datasets.size() );
+  _forEachDataset( datasets, [&]( size_t i )
+  {
+    datasetsHistograms[i] = datasets[i]->histogram();
+  } );
+
+  // merged in the order of the datasets, as in a serial computation
+  for ( const std::shared_ptr<const Histogram> &histogram : datasetsHistograms )
+    ret.merge( *histogram );
+
   return ret;
 }
 
 MDAL::Statistics MDAL::calculateStatistics( std::shared_ptr<Dataset> dataset )
+{
+  return calculateStatistics( dataset.get() );
+}
+
+MDAL::Statistics MDAL::calculateStatistics( Dataset *dataset, Histogram *histogram )
 {
   Statistics ret;
   if ( !dataset )
@@ -525,7 +689,7 @@ MDAL::Statistics MDAL::calculateStatistics( std::shared_ptr<Dataset> dataset )
 
   bool isVector = !dataset->group()->isScalar();
   bool is3D = dataset->group()->dataLocation() == MDAL_DataLocation::DataOnVolumes;
-  size_t bufLen = 2000;
+  const size_t bufLen = std::max<size_t>( 1, std::min( dataset->valuesCount(), STATISTICS_BLOCK_SIZE ) );
   std::vector<double> buffer( isVector ? bufLen * 2 : bufLen );
 
   size_t i = 0;
@@ -557,8 +721,10 @@ MDAL::Statistics MDAL::calculateStatistics( std::shared_ptr<Dataset> dataset )
     if ( valsRead == 0 )
       return ret;
 
-    MDAL::Statistics dsStats = _calculateStatistics( buffer, valsRead, isVector );
+    MDAL::Statistics dsStats = calculateStatistics( buffer.data(), valsRead, isVector );
     combineStatistics( ret, dsStats );
+    if ( histogram )
+      histogram->addValues( buffer.data(), valsRead, isVector );
     i += valsRead;
   }
 
@@ -820,6 +986,55 @@ MDAL::DateTime MDAL::parseCFReferenceTime( const std::string &timeInformation, c
   return MDAL::DateTime( year, month, day, hours, minutes, seconds, calendar );
 }
 
+MDAL::StreamPool::Stream::Stream( StreamPool *pool, std::unique_ptr<std::ifstream> stream )
+  : mPool( pool )
+  , mStream( std::move( stream ) )
+{
+}
+
+MDAL::StreamPool::Stream::~Stream()
+{
+  if ( mStream )
+    mPool->release( std::move( mStream ) );
+}
+
+MDAL::StreamPool::StreamPool( const std::string &fileName )
+  : mFileName( fileName )
+{
+}
+
+MDAL::StreamPool::Stream MDAL::StreamPool::acquire()
+{
+  std::unique_ptr<std::ifstream> stream;
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    if ( !mFreeStreams.empty() )
+    {
+      stream = std::move( mFreeStreams.back() );
+      mFreeStreams.pop_back();
+    }
+  }
+
+  if ( stream )
+    stream->clear();
+  else
+    stream.reset( new std::ifstream( mFileName, std::ifstream::in | std::ifstream::binary ) );
+
+  return Stream( this, std::move( stream ) );
+}
+
+void MDAL::StreamPool::clear()
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  mFreeStreams.clear();
+}
+
+void MDAL::StreamPool::release( std::unique_ptr<std::ifstream> stream )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  mFreeStreams.push_back( std::move( stream ) );
+}
+
 bool MDAL::getHeaderLine( std::ifstream &stream, std::string &line )
 {
   if ( !stream.is_open() ) return false;
@@ -14,6 +14,9 @@
 #include <fstream>
 #include <cmath>
 #include <functional>
+#include <type_traits>
+#include <memory>
+#include <mutex>
 
 #if defined (WIN32)
 #include <windows.h>
@@ -139,13 +142,41 @@ namespace MDAL
   // statistics
   void combineStatistics( Statistics &main, const Statistics &other );
 
-  //! Calculates statistics for dataset group
+  /**
+   * Calculates statistics for dataset group, combining the statistics of its datasets. The statistics of the datasets
+   * are computed in parallel, one at a time for the datasets not supporting concurrent reads
+   */
   Statistics calculateStatistics( std::shared_ptr<DatasetGroup> grp );
   Statistics calculateStatistics( DatasetGroup *grp );
 
-  //! Calculates statistics for dataset
+  //! Calculates statistics for dataset, reading all its values
   Statistics calculateStatistics( std::shared_ptr<Dataset> dataset );
 
+  //! Calculates statistics for dataset, reading all its values, and adds the values to \a histogram if not null
+  Statistics calculateStatistics( Dataset *dataset, Histogram *histogram = nullptr );
+
+  /**
+   * Calculates the histogram of the dataset group, merging the histograms of its datasets, computed in parallel
+   * as for calculateStatistics()
+   */
+  Histogram calculateHistogram( DatasetGroup *grp );
+
+  //! Calculates statistics of \a count values, or of the magnitudes of \a count x/y pairs if \a isVector, NaN values are ignored
+  Statistics calculateStatistics( const double *values, size_t count, bool isVector );
+
+  // parallel
+  //! Sets the maximum count of threads used by parallelFor(), 0 for the count of hardware threads, see MDAL_SetThreadCount()
+  void setThreadCount( size_t count );
+  //! Returns the maximum count of threads used by parallelFor(), resolved to the count of hardware threads if not set
+  size_t threadCount();
+
+  /**
+   * Splits the range [0, count[ in chunks of at least \a minChunkSize items and calls \a func( begin, end ) on each chunk
+   * from at most threadCount() threads. Runs in the calling thread if the range fits in one chunk. \a func must not throw.
+   * The last status set by \a func in the other threads is reported as last status of the calling thread.
+   */
+  void parallelFor( size_t count, size_t minChunkSize, const std::function<void( size_t, size_t )> &func );
+
   // mesh & datasets
   //! Adds bed elevatiom dataset group to mesh
   void addBedElevationDatasetGroup( MDAL::Mesh *mesh, const Vertices &vertices );
@@ -167,6 +198,88 @@ namespace MDAL
     return true;
   }
 
+  //! Reverses the byte order of the \a count values of the \a values array
+  template<typename T>
+  void swapEndianness( T *values, size_t count )
+  {
+    char *p = reinterpret_cast<char *>( values );
+    for ( size_t i = 0; i < count; ++i, p += sizeof( T ) )
+      std::reverse( p, p + sizeof( T ) );
+  }
+
+  /**
+   * Reads \a count values of type T from the stream in one block and copies them, converted to type U, in \a buffer.
+   * Option to change the endianness is provided. Returns false if the values could not be read
+   */
+  template<typename T, typename U>
+  bool readValues( U *buffer, size_t count, std::ifstream &in, bool changeEndianness = false )
+  {
+    if ( std::is_same<T, U>::value )
+    {
+      // no conversion, read directly in the buffer
+      if ( !in.read( reinterpret_cast<char *>( buffer ), static_cast<std::streamsize>( count * sizeof( T ) ) ) )
+        return false;
+
+      if ( changeEndianness )
+        swapEndianness( buffer, count );
+
+      return true;
+    }
+
+    std::vector<T> values( count );
+
+    if ( !in.read( reinterpret_cast<char *>( values.data() ), static_cast<std::streamsize>( count * sizeof( T ) ) ) )
+      return false;
+
+    if ( changeEndianness )
+      swapEndianness( values.data(), count );
+
+    for ( size_t i = 0; i < count; ++i )
+      buffer[i] = static_cast<U>( values[i] );
+
+    return true;
+  }
+
+  /**
+   * Pool of binary input streams opened on the same file, to read it from several threads without sharing
+   * a stream position. A stream is acquired for a read and given back to the pool when the handle is destroyed,
+   * so at most one stream is opened per thread reading concurrently.
+   */
+  class StreamPool
+  {
+    public:
+      //! Handle of a stream acquired from the pool, the stream is given back to the pool on destruction
+      class Stream
+      {
+        public:
+          Stream( StreamPool *pool, std::unique_ptr<std::ifstream> stream );
+          Stream( Stream &&other ) = default;
+          ~Stream();
+
+          std::ifstream &operator*() const { return *mStream; }
+          std::ifstream *operator->() const { return mStream.get(); }
+
+        private:
+          StreamPool *mPool;
+          std::unique_ptr<std::ifstream> mStream;
+      };
+
+      explicit StreamPool( const std::string &fileName );
+
+      //! Returns a free stream of the pool, opens a new one if all are in use. The state of the stream is cleared
+      Stream acquire();
+
+      //! Closes the free streams of the pool, for example before the file is overwritten
+      void clear();
+
+    private:
+      void release( std::unique_ptr<std::ifstream> stream );
+
+      std::string mFileName;
+      std::mutex mMutex;
+      std::vector<std::unique_ptr<std::ifstream>> mFreeStreams;
+  };
+
   //! Writes all of type of value. Option to change the endianness is provided
   template<typename T>
   void writeValue( T &value, std::ofstream &out, bool changeEndianness = false )
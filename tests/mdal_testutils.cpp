@@ -9,6 +9,7 @@
 #include "mdal_config.hpp"
 #include <vector>
 #include <math.h>
+#include <cmath>
 #include <assert.h>
 #include <fstream>
 #include <stdio.h>
@@ -187,6 +188,42 @@ bool compareVectors( const std::vector<double> &a, const std::vector<double> &b
   return true;
 }
 
+static bool sameValue( double a, double b )
+{
+  if ( std::isnan( a ) || std::isnan( b ) )
+    return std::isnan( a ) && std::isnan( b );
+  return a == b;
+}
+
+bool compareTimeSeries( MDAL_DatasetGroupH group, const std::vector<int> &indices )
+{
+  const int datasetCount = MDAL_G_datasetCount( group );
+  const bool isScalar = MDAL_G_hasScalarData( group );
+  const size_t valuesPerItem = isScalar ? 1 : 2;
+  const int indicesCount = static_cast<int>( indices.size() );
+  std::vector<double> timeSeries( static_cast<size_t>( datasetCount ) * indices.size() * valuesPerItem );
+  if ( MDAL_G_timeSeries( group, indices.data(), indicesCount, timeSeries.data() ) != datasetCount )
+    return false;
+
+  for ( int d = 0; d < datasetCount; ++d )
+  {
+    MDAL_DatasetH dataset = MDAL_G_dataset( group, d );
+    for ( size_t i = 0; i < indices.size(); ++i )
+    {
+      const size_t pos = ( static_cast<size_t>( d ) * indices.size() + i ) * valuesPerItem;
+      if ( isScalar )
+      {
+        if ( !sameValue( getValue( dataset, indices[i] ), timeSeries[pos] ) )
+          return false;
+      }
+      else if ( !sameValue( getValueX( dataset, indices[i] ), timeSeries[pos] ) ||
+                !sameValue( getValueY( dataset, indices[i] ), timeSeries[pos + 1] ) )
+        return false;
+    }
+  }
+  return true;
+}
+
 void compareMeshFrames( MDAL_MeshH meshA, MDAL_MeshH meshB )
 {
   // Vertices
@@ -41,6 +41,8 @@ double getValue( MDAL_DatasetH dataset, int index );
 double getValueX( MDAL_DatasetH dataset, int index );
 double getValueY( MDAL_DatasetH dataset, int index );
 int get3DFrom2D( MDAL_DatasetH dataset, int index );
+//! Returns whether the time series of the group at \a indices have the same values as read dataset by dataset
+bool compareTimeSeries( MDAL_DatasetGroupH group, const std::vector<int> &indices );
 
 // Datasets 3D
 int getLevelsCount3D( MDAL_DatasetH dataset, int index );
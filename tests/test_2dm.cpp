@@ -56,6 +56,37 @@ TEST( Mesh2DMTest, Mixed1D2D )
   MDAL_CloseMesh( m );
 }
 
+TEST( Mesh2DMTest, MeshSummary )
+{
+  // the driver does not implement a summary, built from the loaded mesh
+  std::string path = test_file( "/2dm/quad_and_line.2dm" );
+  MDAL_MeshSummaryH summary = MDAL_LoadMeshSummary( ( "2DM:\"" + path + "\"" ).c_str() );
+  ASSERT_NE( summary, nullptr );
+  EXPECT_EQ( std::string( "2DM" ), MDAL_MS_driverName( summary ) );
+  EXPECT_EQ( 5, MDAL_MS_vertexCount( summary ) );
+  EXPECT_EQ( 1, MDAL_MS_faceCount( summary ) );
+  EXPECT_EQ( 1, MDAL_MS_edgeCount( summary ) );
+
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+  double minX, maxX, minY, maxY;
+  double sMinX, sMaxX, sMinY, sMaxY;
+  MDAL_M_extent( m, &minX, &maxX, &minY, &maxY );
+  MDAL_MS_extent( summary, &sMinX, &sMaxX, &sMinY, &sMaxY );
+  EXPECT_DOUBLE_EQ( minX, sMinX );
+  EXPECT_DOUBLE_EQ( maxX, sMaxX );
+  EXPECT_DOUBLE_EQ( minY, sMinY );
+  EXPECT_DOUBLE_EQ( maxY, sMaxY );
+
+  ASSERT_EQ( MDAL_M_datasetGroupCount( m ), MDAL_MS_datasetGroupCount( summary ) );
+  ASSERT_EQ( 1, MDAL_MS_datasetGroupCount( summary ) );
+  EXPECT_EQ( std::string( "Bed Elevation" ), MDAL_MS_datasetGroupName( summary, 0 ) );
+  EXPECT_EQ( 1, MDAL_MS_datasetGroupDatasetCount( summary, 0 ) );
+
+  MDAL_CloseMesh( m );
+  MDAL_CloseMeshSummary( summary );
+}
+
 TEST( Mesh2DMTest, MeshWithNumberingGaps )
 {
   //https://github.com/lutraconsulting/MDAL/issues/51
@@ -162,6 +193,182 @@ TEST( Mesh2DMTest, QuadAndTriangleFile )
   MDAL_CloseMesh( m );
 }
 
+TEST( Mesh2DMTest, QuadAndTriangleFile64 )
+{
+  std::string path = test_file( "/2dm/quad_and_triangle.2dm" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+
+  EXPECT_EQ( 5, MDAL_M_vertexCount64( m ) );
+  EXPECT_EQ( 2, MDAL_M_faceCount64( m ) );
+  EXPECT_EQ( 0, MDAL_M_edgeCount64( m ) );
+
+  // vertices
+  std::vector<double> coordinates( 15 );
+  std::vector<double> coordinates64( 15 );
+  MDAL_MeshVertexIteratorH vi = MDAL_M_vertexIterator( m );
+  EXPECT_EQ( 5, MDAL_VI_next( vi, 5, coordinates.data() ) );
+  MDAL_VI_close( vi );
+  vi = MDAL_M_vertexIterator( m );
+  EXPECT_EQ( 5, MDAL_VI_next64( vi, 10, coordinates64.data() ) );
+  MDAL_VI_close( vi );
+  EXPECT_EQ( coordinates, coordinates64 );
+
+  // faces
+  std::vector<int> offsets( 2 );
+  std::vector<int> indices( 8 );
+  MDAL_MeshFaceIteratorH fi = MDAL_M_faceIterator( m );
+  EXPECT_EQ( 2, MDAL_FI_next( fi, 2, offsets.data(), 8, indices.data() ) );
+  MDAL_FI_close( fi );
+
+  std::vector<int64_t> offsets64( 2 );
+  std::vector<int64_t> indices64( 8 );
+  fi = MDAL_M_faceIterator( m );
+  EXPECT_EQ( 2, MDAL_FI_next64( fi, 2, offsets64.data(), 8, indices64.data() ) );
+  MDAL_FI_close( fi );
+  for ( size_t i = 0; i < offsets.size(); ++i )
+    EXPECT_EQ( offsets[i], offsets64[i] );
+  for ( int i = 0; i < offsets.back(); ++i )
+    EXPECT_EQ( indices[static_cast<size_t>( i )], indices64[static_cast<size_t>( i )] );
+
+  // buffer too small for the second face, read it with the next call
+  fi = MDAL_M_faceIterator( m );
+  EXPECT_EQ( 1, MDAL_FI_next64( fi, 2, offsets64.data(), 5, indices64.data() ) );
+  EXPECT_EQ( 4, offsets64[0] );
+  EXPECT_EQ( 1, MDAL_FI_next64( fi, 2, offsets64.data(), 5, indices64.data() ) );
+  EXPECT_EQ( 3, offsets64[0] );
+  EXPECT_EQ( indices[4], indices64[0] );
+  EXPECT_EQ( 0, MDAL_FI_next64( fi, 2, offsets64.data(), 5, indices64.data() ) );
+  MDAL_FI_close( fi );
+
+  // dataset values
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 0 );
+  ASSERT_NE( ds, nullptr );
+  EXPECT_EQ( 5, MDAL_D_valueCount64( ds ) );
+
+  std::vector<double> values( 4 );
+  std::vector<double> values64( 4 );
+  EXPECT_EQ( 4, MDAL_D_data( ds, 1, 4, MDAL_DataType::SCALAR_DOUBLE, values.data() ) );
+  EXPECT_EQ( 4, MDAL_D_data64( ds, 1, 4, MDAL_DataType::SCALAR_DOUBLE, values64.data() ) );
+  EXPECT_EQ( values, values64 );
+  EXPECT_DOUBLE_EQ( 30, values64[0] );
+
+  // negative start index or counts are rejected
+  EXPECT_EQ( 0, MDAL_D_data64( ds, -1, 4, MDAL_DataType::SCALAR_DOUBLE, values64.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  EXPECT_EQ( 0, MDAL_D_data64( ds, 0, -4, MDAL_DataType::SCALAR_DOUBLE, values64.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  EXPECT_EQ( 0, MDAL_D_data( ds, -1, 4, MDAL_DataType::SCALAR_DOUBLE, values.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  EXPECT_EQ( values, values64 );
+
+  vi = MDAL_M_vertexIterator( m );
+  EXPECT_EQ( 0, MDAL_VI_next64( vi, -1, coordinates64.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  MDAL_VI_close( vi );
+
+  fi = MDAL_M_faceIterator( m );
+  EXPECT_EQ( 0, MDAL_FI_next64( fi, -2, offsets64.data(), 8, indices64.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  MDAL_FI_close( fi );
+
+  MDAL_MeshEdgeIteratorH ei = MDAL_M_edgeIterator( m );
+  EXPECT_EQ( 0, MDAL_EI_next64( ei, -1, indices64.data(), indices64.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  MDAL_EI_close( ei );
+
+  MDAL_CloseMesh( m );
+}
+
+TEST( Mesh2DMTest, MemoryViews )
+{
+  std::string path = test_file( "/2dm/quad_and_triangle.2dm" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+
+  int64_t vertexCount = 0;
+  const double *vertices = MDAL_M_verticesView( m, &vertexCount );
+  ASSERT_NE( vertices, nullptr );
+  ASSERT_EQ( 5, vertexCount );
+  std::vector<double> coordinates( 15 );
+  MDAL_MeshVertexIteratorH vi = MDAL_M_vertexIterator( m );
+  EXPECT_EQ( 5, MDAL_VI_next( vi, 5, coordinates.data() ) );
+  MDAL_VI_close( vi );
+  for ( size_t i = 0; i < coordinates.size(); ++i )
+    EXPECT_DOUBLE_EQ( coordinates[i], vertices[i] );
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 0 );
+  ASSERT_NE( ds, nullptr );
+
+  int64_t count = 0;
+  const double *values = static_cast<const double *>( MDAL_D_dataView( ds, MDAL_DataType::SCALAR_DOUBLE, &count ) );
+  ASSERT_NE( values, nullptr );
+  ASSERT_EQ( 5, count );
+  EXPECT_DOUBLE_EQ( 30, values[1] );
+
+  // scalar dataset without active flag
+  EXPECT_EQ( nullptr, MDAL_D_dataView( ds, MDAL_DataType::VECTOR_2D_DOUBLE, &count ) );
+  EXPECT_EQ( 0, count );
+  EXPECT_EQ( nullptr, MDAL_D_dataView( ds, MDAL_DataType::ACTIVE_INTEGER, &count ) );
+  // no view is not an error
+  EXPECT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+
+  MDAL_CloseMesh( m );
+}
+
+TEST( Mesh2DMTest, FaceAtPoint )
+{
+  std::string path = test_file( "/2dm/quad_and_triangle.2dm" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+
+  EXPECT_EQ( 0, MDAL_M_faceAtPoint( m, 1500, 2500 ) );
+  EXPECT_EQ( 1, MDAL_M_faceAtPoint( m, 2200, 2200 ) );
+  EXPECT_EQ( -1, MDAL_M_faceAtPoint( m, 2900, 2900 ) );
+  EXPECT_EQ( -1, MDAL_M_faceAtPoint( m, 500, 500 ) );
+
+  std::vector<double> coordinates = {1500, 2500, 2900, 2900, 2200, 2200};
+  std::vector<int64_t> faceIndexes( 3 );
+  EXPECT_EQ( 2, MDAL_M_facesAtPoints( m, 3, coordinates.data(), faceIndexes.data() ) );
+  EXPECT_EQ( std::vector<int64_t>( {0, -1, 1} ), faceIndexes );
+
+  EXPECT_EQ( -1, MDAL_M_faceAtPoint( nullptr, 1500, 2500 ) );
+  EXPECT_EQ( MDAL_Status::Err_IncompatibleMesh, MDAL_LastStatus() );
+
+  MDAL_CloseMesh( m );
+}
+
+TEST( Mesh2DMTest, ValuesAtPoints )
+{
+  std::string path = test_file( "/2dm/quad_and_triangle.2dm" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 0 );
+  ASSERT_NE( ds, nullptr );
+
+  // on a vertex, on the diagonal and inside the second triangle of the quad, in the triangle and outside
+  std::vector<double> coordinates = {1000, 2000, 1500, 2500, 1250, 2750, 2200, 2200, 2900, 2900};
+  std::vector<double> values( 5 );
+  EXPECT_EQ( 4, MDAL_D_valuesAtPoints( ds, 5, coordinates.data(), values.data() ) );
+  EXPECT_DOUBLE_EQ( 20, values[0] );
+  EXPECT_DOUBLE_EQ( 35, values[1] );
+  EXPECT_DOUBLE_EQ( 22.5, values[2] );
+  EXPECT_DOUBLE_EQ( 36, values[3] );
+  EXPECT_TRUE( std::isnan( values[4] ) );
+
+  EXPECT_EQ( 0, MDAL_D_valuesAtPoints( nullptr, 5, coordinates.data(), values.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_IncompatibleDataset, MDAL_LastStatus() );
+
+  MDAL_CloseMesh( m );
+}
+
 TEST( Mesh2DMTest, LinesFile )
 {
   std::string path = test_file( "/2dm/lines.2dm" );
@@ -4,6 +4,7 @@
 */
 #include "gtest/gtest.h"
 #include <string>
+#include <cmath>
 
 //mdal
 #include "mdal.h"
@@ -536,6 +537,16 @@ TEST( MeshAsciiDatTest, QuadAndTriangleFaceVectorFile )
 
   EXPECT_TRUE( compareReferenceTime( g, "1950-01-07T00:00:00" ) );
 
+  std::vector<double> coordinates = {1500, 2500, 2900, 2900, 2200, 2200};
+  std::vector<double> values( 6 );
+  EXPECT_EQ( 2, MDAL_D_valuesAtPoints( ds, 3, coordinates.data(), values.data() ) );
+  EXPECT_DOUBLE_EQ( 1, values[0] );
+  EXPECT_DOUBLE_EQ( 1, values[1] );
+  EXPECT_TRUE( std::isnan( values[2] ) );
+  EXPECT_TRUE( std::isnan( values[3] ) );
+  EXPECT_DOUBLE_EQ( 2, values[4] );
+  EXPECT_DOUBLE_EQ( 2, values[5] );
+
   MDAL_CloseMesh( m );
 }
 
@@ -648,6 +659,15 @@ TEST( MeshAsciiDatTest, QuadAndTriangleVertexScalarOldFile )
       EXPECT_DOUBLE_EQ( time, 3600.0 );
     }
 
+    std::vector<int> indices = {1, 0, 1};
+    std::vector<double> timeSeries( 6 );
+    ASSERT_EQ( 2, MDAL_G_timeSeries( g, indices.data(), 3, timeSeries.data() ) );
+    EXPECT_DOUBLE_EQ( 2, timeSeries[0] );
+    EXPECT_DOUBLE_EQ( 1, timeSeries[1] );
+    EXPECT_DOUBLE_EQ( 2, timeSeries[2] );
+    EXPECT_DOUBLE_EQ( getValue( ds, 1 ), timeSeries[3] );
+    EXPECT_DOUBLE_EQ( getValue( ds, 0 ), timeSeries[4] );
+
     MDAL_CloseMesh( m );
   }
 }
@@ -4,6 +4,9 @@
 */
 #include "gtest/gtest.h"
 #include <string>
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 //mdal
 #include "mdal.h"
@@ -69,6 +72,25 @@ TEST( MeshBinaryDatTest, QuadAndTriangleFile )
   value = getValue( ds, 1 );
   EXPECT_DOUBLE_EQ( 2, value );
 
+  // values are read on demand, no view on them
+  int64_t viewCount = 0;
+  EXPECT_EQ( nullptr, MDAL_D_dataView( ds, MDAL_DataType::SCALAR_DOUBLE, &viewCount ) );
+  EXPECT_EQ( 0, viewCount );
+  EXPECT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+
+  // statistics must match the values read on demand
+  double expectedMin = getValue( ds, 0 );
+  double expectedMax = expectedMin;
+  for ( int i = 1; i < count; ++i )
+  {
+    expectedMin = std::min( expectedMin, getValue( ds, i ) );
+    expectedMax = std::max( expectedMax, getValue( ds, i ) );
+  }
+  double min, max;
+  MDAL_D_minimumMaximum( ds, &min, &max );
+  EXPECT_DOUBLE_EQ( expectedMin, min );
+  EXPECT_DOUBLE_EQ( expectedMax, max );
+
   MDAL_CloseMesh( m );
 }
 
@@ -120,6 +142,74 @@ TEST( MeshBinaryDatTest, RegularGridVectorFile )
   double time = MDAL_D_time( ds );
   EXPECT_TRUE( compareDurationInHours( time, 4.1666666666 ) );
 
+  // time series of two vertices
+  std::vector<int> indices = {1000, 1500};
+  std::vector<double> timeSeries( 61 * 2 * 2 );
+  ASSERT_EQ( 61, MDAL_G_timeSeries( g, indices.data(), 2, timeSeries.data() ) );
+  for ( int i = 0; i < 61; i += 10 )
+  {
+    MDAL_DatasetH dsi = MDAL_G_dataset( g, i );
+    size_t offset = static_cast<size_t>( i ) * 4;
+    EXPECT_DOUBLE_EQ( getValueX( dsi, 1000 ), timeSeries[offset] );
+    EXPECT_DOUBLE_EQ( getValueY( dsi, 1000 ), timeSeries[offset + 1] );
+    EXPECT_DOUBLE_EQ( getValueX( dsi, 1500 ), timeSeries[offset + 2] );
+    EXPECT_DOUBLE_EQ( getValueY( dsi, 1500 ), timeSeries[offset + 3] );
+  }
+
+  indices[1] = 1976;
+  EXPECT_EQ( 0, MDAL_G_timeSeries( g, indices.data(), 2, timeSeries.data() ) );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+
+  // histogram and quantiles of the magnitudes of all the datasets
+  std::vector<double> magnitudes;
+  std::vector<double> values( 1976 * 2 );
+  for ( int i = 0; i < 61; ++i )
+  {
+    ASSERT_EQ( 1976, MDAL_D_data( MDAL_G_dataset( g, i ), 0, 1976, MDAL_DataType::VECTOR_2D_DOUBLE, values.data() ) );
+    for ( size_t j = 0; j < 1976; ++j )
+    {
+      double magnitude = std::sqrt( values[2 * j] * values[2 * j] + values[2 * j + 1] * values[2 * j + 1] );
+      if ( !std::isnan( magnitude ) )
+        magnitudes.push_back( magnitude );
+    }
+  }
+  std::sort( magnitudes.begin(), magnitudes.end() );
+
+  double min, max;
+  MDAL_G_minimumMaximum( g, &min, &max );
+  EXPECT_DOUBLE_EQ( magnitudes.front(), min );
+  EXPECT_DOUBLE_EQ( magnitudes.back(), max );
+
+  std::vector<int64_t> counts( 10 );
+  MDAL_G_histogram( g, min, max, 10, counts.data() );
+  int64_t total = 0;
+  for ( int64_t binCount : counts )
+    total += binCount;
+  EXPECT_EQ( static_cast<int64_t>( magnitudes.size() ), total );
+
+  const double tolerance = ( max - min ) / 256;
+  const std::vector<double> probabilities = {0, 0.02, 0.5, 0.98, 1};
+  std::vector<double> quantiles( probabilities.size() );
+  MDAL_G_quantiles( g, 5, probabilities.data(), quantiles.data() );
+  EXPECT_DOUBLE_EQ( min, quantiles[0] );
+  EXPECT_DOUBLE_EQ( max, quantiles[4] );
+  for ( size_t i = 1; i < 4; ++i )
+  {
+    const double expected = magnitudes[static_cast<size_t>( probabilities[i] * static_cast<double>( magnitudes.size() - 1 ) )];
+    EXPECT_NEAR( expected, quantiles[i], tolerance );
+  }
+
+  // single dataset
+  MDAL_D_quantiles( ds, 1, &probabilities[4], quantiles.data() );
+  double dsMin, dsMax;
+  MDAL_D_minimumMaximum( ds, &dsMin, &dsMax );
+  EXPECT_DOUBLE_EQ( dsMax, quantiles[0] );
+  MDAL_D_histogram( ds, dsMin, dsMax, 1, counts.data() );
+  EXPECT_LT( 0, counts[0] );
+
+  MDAL_G_histogram( g, 1, 0, 10, counts.data() );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+
   MDAL_CloseMesh( m );
 }
 
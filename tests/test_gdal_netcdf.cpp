@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include <string>
 #include <vector>
+#include <cmath>
 
 //mdal
 #include "mdal.h"
@@ -77,6 +78,84 @@ TEST( MeshGdalNetCDFTest, OceanCurrents )
   MDAL_CloseMesh( m );
 }
 
+TEST( MeshGdalNetCDFTest, OceanCurrentsStrips )
+{
+  // bands of netCDF classic files are read by strips of one row of 241 values
+  std::string path = test_file( std::string( "/netcdf/Copernicus Ocean Currents Forecast Model/cmems_global-analysis-forecast-phy-001-024.nc" ) );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 1 );
+  ASSERT_NE( ds, nullptr );
+
+  const int valuesCount = MDAL_D_valueCount( ds );
+  ASSERT_EQ( 43621, valuesCount );
+  std::vector<double> allValues( 2 * static_cast<size_t>( valuesCount ) );
+  ASSERT_EQ( valuesCount, MDAL_D_data( ds, 0, valuesCount, MDAL_DataType::VECTOR_2D_DOUBLE, allValues.data() ) );
+
+  // vector pair across the end of the first row
+  std::vector<double> values( 2 * 10 );
+  ASSERT_EQ( 10, MDAL_D_data( ds, 236, 10, MDAL_DataType::VECTOR_2D_DOUBLE, values.data() ) );
+  EXPECT_DOUBLE_EQ( -0.095703125, values[6] );
+  EXPECT_DOUBLE_EQ( -0.037109375, values[7] );
+  EXPECT_DOUBLE_EQ( -0.078125, values[8] );
+  EXPECT_DOUBLE_EQ( -0.0390625, values[9] );
+  EXPECT_TRUE( std::isnan( values[10] ) );
+  EXPECT_TRUE( std::isnan( values[11] ) );
+  EXPECT_DOUBLE_EQ( -0.384765625, allValues[2 * 385] );
+  EXPECT_DOUBLE_EQ( 0.076171875, allValues[2 * 385 + 1] );
+
+  // several rows, starting and ending in the middle of a row
+  const int start = 200;
+  const int count = 3 * 241;
+  values.resize( 2 * count );
+  ASSERT_EQ( count, MDAL_D_data( ds, start, count, MDAL_DataType::VECTOR_2D_DOUBLE, values.data() ) );
+  for ( size_t i = 0; i < values.size(); ++i )
+  {
+    const double expected = allValues[2 * start + i];
+    if ( std::isnan( expected ) )
+      EXPECT_TRUE( std::isnan( values[i] ) );
+    else
+      EXPECT_DOUBLE_EQ( expected, values[i] );
+  }
+
+  // faces were activated at load when all their vertices have a value
+  const int facesCount = MDAL_M_faceCount( m );
+  ASSERT_EQ( 4, MDAL_M_faceVerticesMaximumCount( m ) );
+  const std::vector<int> vertices = faceVertexIndices( m, facesCount );
+  std::vector<int> active( static_cast<size_t>( facesCount ) );
+  ASSERT_EQ( facesCount, MDAL_D_data( ds, 0, facesCount, MDAL_DataType::ACTIVE_INTEGER, active.data() ) );
+  int inactiveCount = 0;
+  int differentCount = 0;
+  for ( size_t i = 0; i < active.size(); ++i )
+  {
+    int expected = 1;
+    for ( size_t j = 0; j < 4; ++j )
+    {
+      const size_t vertex = static_cast<size_t>( vertices[4 * i + j] );
+      if ( std::isnan( allValues[2 * vertex] ) || std::isnan( allValues[2 * vertex + 1] ) )
+        expected = 0;
+    }
+    if ( expected == 0 )
+      ++inactiveCount;
+    if ( expected != active[i] )
+      ++differentCount;
+  }
+  EXPECT_GT( inactiveCount, 0 );
+  EXPECT_EQ( 0, differentCount );
+
+  // faces on both sides of the coast, from the middle of a row of faces
+  std::vector<int> activeChunk( 300 );
+  ASSERT_EQ( 300, MDAL_D_data( ds, 100, 300, MDAL_DataType::ACTIVE_INTEGER, activeChunk.data() ) );
+  for ( size_t i = 0; i < activeChunk.size(); ++i )
+    EXPECT_EQ( active[100 + i], activeChunk[i] );
+  EXPECT_EQ( 0, active[143] );
+  EXPECT_EQ( 1, active[144] );
+
+  MDAL_CloseMesh( m );
+}
+
 TEST( MeshGdalNetCDFTest, Indonesia )
 {
   std::vector<std::string> files;
@@ -188,6 +188,9 @@ TEST( MeshHec2dTest, simpleArea )
   EXPECT_DOUBLE_EQ( 0, min );
   EXPECT_TRUE( MDAL::equals( 0.3837422465, max, 0.000001 ) );
 
+  // values read by time series, with one read per dataset of the selected elements
+  EXPECT_TRUE( compareTimeSeries( MDAL_M_datasetGroup( m, 1 ), {0, 15, 850} ) );
+
   MDAL_CloseMesh( m );
 }
 
@@ -303,6 +306,31 @@ TEST( MeshHec2dTest, MultiAreas )
 
   EXPECT_TRUE( compareReferenceTime( g, "1999-01-01T12:00:00" ) );
 
+  // ///////////
+  // Vector Dataset, values read by timestep are the same for the whole mesh and for each face
+  // ///////////
+  g = MDAL_M_datasetGroup( m, 5 );
+  ASSERT_NE( g, nullptr );
+  EXPECT_EQ( std::string( "Velocity" ), std::string( MDAL_G_name( g ) ) );
+  ds = MDAL_G_dataset( g, 5 );
+  ASSERT_NE( ds, nullptr );
+
+  std::vector<double> values( 2 * 725 );
+  EXPECT_EQ( 725, MDAL_D_data( ds, 0, 725, MDAL_DataType::VECTOR_2D_DOUBLE, values.data() ) );
+  size_t nanCount = 0;
+  for ( int i = 0; i < 725; ++i )
+  {
+    if ( std::isnan( values[2 * i] ) )
+    {
+      ++nanCount;
+      EXPECT_TRUE( std::isnan( getValueX( ds, i ) ) );
+      continue;
+    }
+    EXPECT_DOUBLE_EQ( values[2 * i], getValueX( ds, i ) );
+    EXPECT_DOUBLE_EQ( values[2 * i + 1], getValueY( ds, i ) );
+  }
+  EXPECT_LT( nanCount, 725 );
+
   MDAL_CloseMesh( m );
 }
 
@@ -413,6 +441,116 @@ TEST( MeshHec2dTest, model_505 )
 }
 
 
+//! Returns the values of the Water Surface timesteps of the multi areas model
+static std::vector<double> readMultiAreasWaterSurface()
+{
+  std::string path = test_file( "/hec2d/2areas/baldeagle_multi2d.hdf" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  EXPECT_NE( m, nullptr );
+  if ( !m )
+    return std::vector<double>();
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 1 );
+  int count = MDAL_M_faceCount( m );
+  std::vector<double> values( static_cast<size_t>( MDAL_G_datasetCount( g ) * count ) );
+  for ( int i = 0; i < MDAL_G_datasetCount( g ); ++i )
+  {
+    MDAL_DatasetH ds = MDAL_G_dataset( g, i );
+    // in 2 chunks, the second one is read from the same chunk cache
+    EXPECT_EQ( 300, MDAL_D_data( ds, 0, 300, MDAL_DataType::SCALAR_DOUBLE, values.data() + i * count ) );
+    EXPECT_EQ( count - 300, MDAL_D_data( ds, 300, count - 300, MDAL_DataType::SCALAR_DOUBLE, values.data() + i * count + 300 ) );
+  }
+  MDAL_CloseMesh( m );
+  return values;
+}
+
+TEST( MeshHec2dTest, Hdf5AccessSettings )
+{
+  std::vector<double> defaultValues = readMultiAreasWaterSurface();
+  ASSERT_EQ( 7 * 725, defaultValues.size() );
+
+  MDAL_SetHdf5DatasetChunkCacheSize( 64 * 1024 * 1024 );
+  MDAL_SetHdf5FileDriver( MDAL_Hdf5FileDriver::Hdf5Core );
+  std::vector<double> values = readMultiAreasWaterSurface();
+  MDAL_SetHdf5DatasetChunkCacheSize( 1024 * 1024 );
+  MDAL_SetHdf5FileDriver( MDAL_Hdf5FileDriver::Hdf5Sec2 );
+
+  ASSERT_EQ( defaultValues.size(), values.size() );
+  for ( size_t i = 0; i < values.size(); ++i )
+  {
+    if ( std::isnan( defaultValues[i] ) )
+      EXPECT_TRUE( std::isnan( values[i] ) );
+    else
+      EXPECT_DOUBLE_EQ( defaultValues[i], values[i] );
+  }
+
+  MDAL_SetHdf5DatasetChunkCacheSize( -1 );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+}
+
+TEST( MeshHec2dTest, MeshSummary )
+{
+  const std::vector<std::string> files = {"/hec2d/1area/test.p01.hdf",
+                                          "/hec2d/2areas/baldeagle_multi2d.hdf",
+                                          "/hec2d/2dmodel_5.0.5/temp.p01.hdf"
+                                         };
+  for ( const std::string &file : files )
+  {
+    std::string path = test_file( file );
+    MDAL_MeshSummaryH summary = MDAL_LoadMeshSummary( path.c_str() );
+    ASSERT_NE( summary, nullptr );
+    EXPECT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+
+    // same as the fully loaded mesh
+    MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+    ASSERT_NE( m, nullptr );
+    EXPECT_EQ( std::string( "HEC2D" ), MDAL_MS_driverName( summary ) );
+    EXPECT_EQ( std::string( MDAL_M_projection( m ) ), MDAL_MS_projection( summary ) );
+    EXPECT_EQ( MDAL_M_vertexCount64( m ), MDAL_MS_vertexCount( summary ) );
+    EXPECT_EQ( MDAL_M_edgeCount64( m ), MDAL_MS_edgeCount( summary ) );
+    EXPECT_EQ( MDAL_M_faceCount64( m ), MDAL_MS_faceCount( summary ) );
+
+    double minX, maxX, minY, maxY;
+    double sMinX, sMaxX, sMinY, sMaxY;
+    MDAL_M_extent( m, &minX, &maxX, &minY, &maxY );
+    MDAL_MS_extent( summary, &sMinX, &sMaxX, &sMinY, &sMaxY );
+    EXPECT_DOUBLE_EQ( minX, sMinX );
+    EXPECT_DOUBLE_EQ( maxX, sMaxX );
+    EXPECT_DOUBLE_EQ( minY, sMinY );
+    EXPECT_DOUBLE_EQ( maxY, sMaxY );
+
+    ASSERT_EQ( MDAL_M_datasetGroupCount( m ), MDAL_MS_datasetGroupCount( summary ) );
+    for ( int i = 0; i < MDAL_M_datasetGroupCount( m ); ++i )
+    {
+      MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, i );
+      EXPECT_EQ( std::string( MDAL_G_name( g ) ), MDAL_MS_datasetGroupName( summary, i ) );
+      EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_MS_datasetGroupDataLocation( summary, i ) );
+      EXPECT_EQ( MDAL_G_hasScalarData( g ), MDAL_MS_datasetGroupHasScalarData( summary, i ) );
+      EXPECT_EQ( std::string( MDAL_G_referenceTime( g ) ), MDAL_MS_datasetGroupReferenceTime( summary, i ) );
+      ASSERT_EQ( MDAL_G_datasetCount( g ), MDAL_MS_datasetGroupDatasetCount( summary, i ) );
+
+      double startTime, endTime;
+      MDAL_MS_datasetGroupTimeRange( summary, i, &startTime, &endTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, 0 ) ), startTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, MDAL_G_datasetCount( g ) - 1 ) ), endTime );
+    }
+
+    MDAL_CloseMesh( m );
+    MDAL_CloseMeshSummary( summary );
+  }
+
+  std::string path = test_file( "/hec2d/1area/test.p01.hdf" );
+  MDAL_MeshSummaryH summary = MDAL_LoadMeshSummary( path.c_str() );
+  ASSERT_NE( summary, nullptr );
+  EXPECT_EQ( std::string( "Depth" ), MDAL_MS_datasetGroupName( summary, 2 ) );
+  EXPECT_EQ( 0, MDAL_MS_datasetGroupDatasetCount( summary, 100 ) );
+  EXPECT_EQ( MDAL_Status::Err_IncompatibleDatasetGroup, MDAL_LastStatus() );
+  MDAL_CloseMeshSummary( summary );
+
+  EXPECT_EQ( nullptr, MDAL_LoadMeshSummary( test_file( "/hec2d/not_found.hdf" ).c_str() ) );
+  EXPECT_EQ( MDAL_Status::Err_FileNotFound, MDAL_LastStatus() );
+}
+
 int main( int argc, char **argv )
 {
   testing::InitGoogleTest( &argc, argv );
@@ -248,6 +248,10 @@ TEST( MeshSLFTest, MalpassetResultFrench )
   // ///////////
   testPreExisitingVectorDatasetGroup( MDAL_M_datasetGroup( m, 0 ) );
 
+  // values read by time series, at their offset in the file
+  EXPECT_TRUE( compareTimeSeries( MDAL_M_datasetGroup( m, 2 ), {0, 5000, 13540} ) );
+  EXPECT_TRUE( compareTimeSeries( MDAL_M_datasetGroup( m, 0 ), {0, 5000, 13540} ) );
+
   MDAL_CloseMesh( m );
 }
 
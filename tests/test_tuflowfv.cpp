@@ -369,6 +369,56 @@ TEST( MeshTuflowFVTest, TrapSteady053DWithMaxes )
   MDAL_CloseMesh( m );
 }
 
+TEST( MeshTuflowFVTest, MeshSummary )
+{
+  const std::vector<std::string> files = {"/tuflowfv/withoutMaxes/trap_steady_05_3D.nc",
+                                          "/tuflowfv/withMaxes/trap_steady_05_3D.nc"
+                                         };
+  for ( const std::string &file : files )
+  {
+    std::string path = test_file( file );
+    MDAL_MeshSummaryH summary = MDAL_LoadMeshSummary( path.c_str() );
+    ASSERT_NE( summary, nullptr );
+
+    // same as the fully loaded mesh
+    MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+    ASSERT_NE( m, nullptr );
+    EXPECT_EQ( std::string( MDAL_M_driverName( m ) ), MDAL_MS_driverName( summary ) );
+    EXPECT_EQ( std::string( MDAL_M_projection( m ) ), MDAL_MS_projection( summary ) );
+    EXPECT_EQ( MDAL_M_vertexCount64( m ), MDAL_MS_vertexCount( summary ) );
+    EXPECT_EQ( MDAL_M_edgeCount64( m ), MDAL_MS_edgeCount( summary ) );
+    EXPECT_EQ( MDAL_M_faceCount64( m ), MDAL_MS_faceCount( summary ) );
+
+    double minX, maxX, minY, maxY;
+    double sMinX, sMaxX, sMinY, sMaxY;
+    MDAL_M_extent( m, &minX, &maxX, &minY, &maxY );
+    MDAL_MS_extent( summary, &sMinX, &sMaxX, &sMinY, &sMaxY );
+    EXPECT_DOUBLE_EQ( minX, sMinX );
+    EXPECT_DOUBLE_EQ( maxX, sMaxX );
+    EXPECT_DOUBLE_EQ( minY, sMinY );
+    EXPECT_DOUBLE_EQ( maxY, sMaxY );
+
+    ASSERT_EQ( MDAL_M_datasetGroupCount( m ), MDAL_MS_datasetGroupCount( summary ) );
+    for ( int i = 0; i < MDAL_M_datasetGroupCount( m ); ++i )
+    {
+      MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, i );
+      EXPECT_EQ( std::string( MDAL_G_name( g ) ), MDAL_MS_datasetGroupName( summary, i ) );
+      EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_MS_datasetGroupDataLocation( summary, i ) );
+      EXPECT_EQ( MDAL_G_hasScalarData( g ), MDAL_MS_datasetGroupHasScalarData( summary, i ) );
+      EXPECT_EQ( std::string( MDAL_G_referenceTime( g ) ), MDAL_MS_datasetGroupReferenceTime( summary, i ) );
+      ASSERT_EQ( MDAL_G_datasetCount( g ), MDAL_MS_datasetGroupDatasetCount( summary, i ) );
+
+      double startTime, endTime;
+      MDAL_MS_datasetGroupTimeRange( summary, i, &startTime, &endTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, 0 ) ), startTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, MDAL_G_datasetCount( g ) - 1 ) ), endTime );
+    }
+
+    MDAL_CloseMesh( m );
+    MDAL_CloseMeshSummary( summary );
+  }
+}
+
 int main( int argc, char **argv )
 {
   testing::InitGoogleTest( &argc, argv );
@@ -6,6 +6,9 @@
 #include <string>
 #include <vector>
 #include <math.h>
+#include <cmath>
+#include <algorithm>
+#include <limits>
 
 //mdal
 #include "mdal.h"
@@ -123,6 +126,38 @@ TEST( MeshUgridTest, DFlow11Manzese )
   MDAL_CloseMesh( m );
 }
 
+TEST( MeshUgridTest, DFlow11ManzeseReadInChunks )
+{
+  std::string path = test_file( "/ugrid/D-Flow1.1/manzese_1d2d_small_map.nc" );
+  std::string uri = "\"" + path + "\":mesh2d";
+  MDAL_MeshH m = MDAL_LoadMesh( uri.c_str() );
+  ASSERT_NE( m, nullptr );
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 3 );
+  ASSERT_NE( g, nullptr );
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 1 );
+  ASSERT_NE( ds, nullptr );
+  int count = MDAL_D_valueCount( ds );
+
+  // values read in small chunks, not cached, are the same as the values of the whole timestep
+  std::vector<double> chunked( count );
+  for ( int start = 0; start < count; start += 100 )
+    EXPECT_EQ( std::min( 100, count - start ), MDAL_D_data( ds, start, 100, MDAL_DataType::SCALAR_DOUBLE, chunked.data() + start ) );
+  std::vector<double> whole( count );
+  EXPECT_EQ( count, MDAL_D_data( ds, 0, count, MDAL_DataType::SCALAR_DOUBLE, whole.data() ) );
+
+  for ( int i = 0; i < count; ++i )
+  {
+    if ( std::isnan( whole[i] ) )
+      EXPECT_TRUE( std::isnan( chunked[i] ) );
+    else
+      EXPECT_DOUBLE_EQ( whole[i], chunked[i] );
+    EXPECT_TRUE( MDAL::equals( getValue( ds, i ), whole[i] ) || std::isnan( whole[i] ) );
+  }
+
+  MDAL_CloseMesh( m );
+}
+
 TEST( MeshUgridTest, DFlow11ManzeseNodeZValue )
 {
   std::string path = test_file( "/ugrid/D-Flow1.1/manzese_1d2d_small_map.nc" );
@@ -704,6 +739,163 @@ TEST( MeshUgridTest, magnitude_direction )
   }
 }
 
+TEST( MeshUgridTest, PackedShortValues )
+{
+  std::string path = test_file( "/ugrid/packed/packed_short.nc" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+  ASSERT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+  EXPECT_EQ( 6, MDAL_M_vertexCount( m ) );
+  EXPECT_EQ( 4, MDAL_M_faceCount( m ) );
+  ASSERT_EQ( 2, MDAL_M_datasetGroupCount( m ) );
+
+  // actual_range of the unpacked values
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  EXPECT_EQ( std::string( "Water depth at pressure points" ), std::string( MDAL_G_name( g ) ) );
+  EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_DataLocation::DataOnFaces );
+  ASSERT_EQ( 2, MDAL_G_datasetCount( g ) );
+
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 0 );
+  EXPECT_DOUBLE_EQ( 1.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( 2.0, getValue( ds, 1 ) );
+  EXPECT_DOUBLE_EQ( 3.5, getValue( ds, 2 ) );
+  EXPECT_TRUE( std::isnan( getValue( ds, 3 ) ) );
+  ds = MDAL_G_dataset( g, 1 );
+  EXPECT_DOUBLE_EQ( 6.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( 0.0, getValue( ds, 1 ) );
+  EXPECT_DOUBLE_EQ( 11.0, getValue( ds, 2 ) );
+  EXPECT_DOUBLE_EQ( 4.0, getValue( ds, 3 ) );
+
+  // actual_range of the packed values
+  g = MDAL_M_datasetGroup( m, 1 );
+  ASSERT_NE( g, nullptr );
+  EXPECT_EQ( std::string( "Water level" ), std::string( MDAL_G_name( g ) ) );
+  EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_DataLocation::DataOnVertices );
+  ASSERT_EQ( 2, MDAL_G_datasetCount( g ) );
+
+  ds = MDAL_G_dataset( g, 0 );
+  EXPECT_DOUBLE_EQ( 0.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( 4.0, getValue( ds, 4 ) );
+  EXPECT_TRUE( std::isnan( getValue( ds, 5 ) ) );
+  ds = MDAL_G_dataset( g, 1 );
+  EXPECT_DOUBLE_EQ( 10.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( -10.0, getValue( ds, 4 ) );
+  EXPECT_DOUBLE_EQ( -9.0, getValue( ds, 5 ) );
+
+  // group statistics given by actual_range are the ones of the unpacked values
+  const double expectedRanges[2][2] = {{0.0, 11.0}, { -10.0, 10.0}};
+  for ( int i = 0; i < 2; ++i )
+  {
+    g = MDAL_M_datasetGroup( m, i );
+    double min, max;
+    MDAL_G_minimumMaximum( g, &min, &max );
+    EXPECT_DOUBLE_EQ( expectedRanges[i][0], min );
+    EXPECT_DOUBLE_EQ( expectedRanges[i][1], max );
+
+    double dataMin = std::numeric_limits<double>::max();
+    double dataMax = -std::numeric_limits<double>::max();
+    for ( int j = 0; j < MDAL_G_datasetCount( g ); ++j )
+    {
+      MDAL_D_minimumMaximum( MDAL_G_dataset( g, j ), &min, &max );
+      dataMin = std::min( dataMin, min );
+      dataMax = std::max( dataMax, max );
+    }
+    EXPECT_DOUBLE_EQ( expectedRanges[i][0], dataMin );
+    EXPECT_DOUBLE_EQ( expectedRanges[i][1], dataMax );
+  }
+
+  MDAL_CloseMesh( m );
+}
+
+TEST( MeshUgridTest, PackedUnsignedShortValues )
+{
+  std::string path = test_file( "/ugrid/packed/packed_ushort.nc" );
+  MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+  ASSERT_NE( m, nullptr );
+  ASSERT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+  EXPECT_EQ( 4, MDAL_M_faceCount( m ) );
+  ASSERT_EQ( 1, MDAL_M_datasetGroupCount( m ) );
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 0 );
+  ASSERT_NE( g, nullptr );
+  EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_DataLocation::DataOnFaces );
+  ASSERT_EQ( 2, MDAL_G_datasetCount( g ) );
+
+  MDAL_DatasetH ds = MDAL_G_dataset( g, 0 );
+  EXPECT_DOUBLE_EQ( -1.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( 0.0, getValue( ds, 1 ) );
+  EXPECT_DOUBLE_EQ( 1.5, getValue( ds, 2 ) );
+  EXPECT_TRUE( std::isnan( getValue( ds, 3 ) ) );
+  ds = MDAL_G_dataset( g, 1 );
+  EXPECT_DOUBLE_EQ( 4.0, getValue( ds, 0 ) );
+  EXPECT_DOUBLE_EQ( 599.0, getValue( ds, 1 ) );
+  EXPECT_DOUBLE_EQ( 9.0, getValue( ds, 2 ) );
+  EXPECT_DOUBLE_EQ( 2.0, getValue( ds, 3 ) );
+
+  // actual_range of the packed values
+  double min, max;
+  MDAL_G_minimumMaximum( g, &min, &max );
+  EXPECT_DOUBLE_EQ( -1.0, min );
+  EXPECT_DOUBLE_EQ( 599.0, max );
+
+  MDAL_CloseMesh( m );
+}
+
+TEST( MeshUgridTest, MeshSummary )
+{
+  const std::vector<std::string> files = {"/ugrid/D-Flow1.1/manzese_1d2d_small_map.nc",
+                                          "/ugrid/D-Flow1.2/bw_11_zonder_riviergrid_met_1dwtg_map.nc",
+                                          "/ugrid/without_time/TINUGRID.tin",
+                                          "/ugrid/ADCIRC/ADCIRC_BG_20190910_1t.nc",
+                                          "/ugrid/1dtest/dflow1d_map.nc",
+                                          "/ugrid/classified/simplebox_clm.nc"
+                                         };
+  for ( const std::string &file : files )
+  {
+    std::string path = test_file( file );
+    MDAL_MeshSummaryH summary = MDAL_LoadMeshSummary( path.c_str() );
+    ASSERT_NE( summary, nullptr );
+
+    // same as the fully loaded mesh
+    MDAL_MeshH m = MDAL_LoadMesh( path.c_str() );
+    ASSERT_NE( m, nullptr );
+    EXPECT_EQ( std::string( MDAL_M_driverName( m ) ), MDAL_MS_driverName( summary ) );
+    EXPECT_EQ( std::string( MDAL_M_projection( m ) ), MDAL_MS_projection( summary ) );
+    EXPECT_EQ( MDAL_M_vertexCount64( m ), MDAL_MS_vertexCount( summary ) );
+    EXPECT_EQ( MDAL_M_edgeCount64( m ), MDAL_MS_edgeCount( summary ) );
+    EXPECT_EQ( MDAL_M_faceCount64( m ), MDAL_MS_faceCount( summary ) );
+
+    double minX, maxX, minY, maxY;
+    double sMinX, sMaxX, sMinY, sMaxY;
+    MDAL_M_extent( m, &minX, &maxX, &minY, &maxY );
+    MDAL_MS_extent( summary, &sMinX, &sMaxX, &sMinY, &sMaxY );
+    EXPECT_DOUBLE_EQ( minX, sMinX );
+    EXPECT_DOUBLE_EQ( maxX, sMaxX );
+    EXPECT_DOUBLE_EQ( minY, sMinY );
+    EXPECT_DOUBLE_EQ( maxY, sMaxY );
+
+    ASSERT_EQ( MDAL_M_datasetGroupCount( m ), MDAL_MS_datasetGroupCount( summary ) );
+    for ( int i = 0; i < MDAL_M_datasetGroupCount( m ); ++i )
+    {
+      MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, i );
+      EXPECT_EQ( std::string( MDAL_G_name( g ) ), MDAL_MS_datasetGroupName( summary, i ) );
+      EXPECT_EQ( MDAL_G_dataLocation( g ), MDAL_MS_datasetGroupDataLocation( summary, i ) );
+      EXPECT_EQ( MDAL_G_hasScalarData( g ), MDAL_MS_datasetGroupHasScalarData( summary, i ) );
+      EXPECT_EQ( std::string( MDAL_G_referenceTime( g ) ), MDAL_MS_datasetGroupReferenceTime( summary, i ) );
+      ASSERT_EQ( MDAL_G_datasetCount( g ), MDAL_MS_datasetGroupDatasetCount( summary, i ) );
+
+      double startTime, endTime;
+      MDAL_MS_datasetGroupTimeRange( summary, i, &startTime, &endTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, 0 ) ), startTime );
+      EXPECT_DOUBLE_EQ( MDAL_D_time( MDAL_G_dataset( g, MDAL_G_datasetCount( g ) - 1 ) ), endTime );
+    }
+
+    MDAL_CloseMesh( m );
+    MDAL_CloseMeshSummary( summary );
+  }
+}
+
 int main( int argc, char **argv )
 {
   testing::InitGoogleTest( &argc, argv );
@@ -115,6 +115,9 @@ TEST( MeshXmdfTest, RegularGridScalarDataset )
 
   EXPECT_FALSE( hasReferenceTime( g ) );
 
+  // values read by time series, with one read per dataset of the selected elements
+  EXPECT_TRUE( compareTimeSeries( g, {0, 1000, 1975} ) );
+
   MDAL_CloseMesh( m );
 }
 
@@ -197,6 +200,8 @@ TEST( MeshXmdfTest, RegularGridVectorMaxDataset )
 
   EXPECT_FALSE( hasReferenceTime( g ) );
 
+  EXPECT_TRUE( compareTimeSeries( g, {0, 1000, 1975} ) );
+
   MDAL_CloseMesh( m );
 }
 
@@ -452,6 +457,75 @@ TEST( MeshXmdfTest, HydroAs2D )
   MDAL_CloseMesh( m );
 }
 
+TEST( MeshXmdfTest, LoadDatasetsWithOptions )
+{
+  std::string meshPath = test_file( "/2dm/regular_grid.2dm" );
+  std::string path = test_file( "/xmdf/regular_grid.xmdf" );
+
+  MDAL_MeshH fullMesh = MDAL_LoadMesh( meshPath.c_str() );
+  ASSERT_NE( fullMesh, nullptr );
+  MDAL_M_LoadDatasets( fullMesh, path.c_str() );
+  ASSERT_EQ( 9, MDAL_M_datasetGroupCount( fullMesh ) );
+  MDAL_DatasetGroupH fullDepth = MDAL_M_datasetGroup( fullMesh, 4 );
+  ASSERT_EQ( 61, MDAL_G_datasetCount( fullDepth ) );
+
+  MDAL_MeshH m = MDAL_LoadMesh( meshPath.c_str() );
+  ASSERT_NE( m, nullptr );
+  const char *options[] = {"GROUPS=depth, Velocity/Maximums", "TIME_START=2", "time_end= 3", "UNKNOWN=1", nullptr};
+  MDAL_M_LoadDatasetsWithOptions( m, path.c_str(), options );
+  EXPECT_EQ( MDAL_Status::None, MDAL_LastStatus() );
+
+  // groups loaded with the mesh are kept
+  ASSERT_EQ( 3, MDAL_M_datasetGroupCount( m ) );
+  EXPECT_EQ( std::string( "Bed Elevation" ), MDAL_G_name( MDAL_M_datasetGroup( m, 0 ) ) );
+
+  MDAL_DatasetGroupH g = MDAL_M_datasetGroup( m, 2 );
+  EXPECT_EQ( std::string( "Depth" ), MDAL_G_name( g ) );
+  ASSERT_EQ( 13, MDAL_G_datasetCount( g ) );
+
+  double min, max;
+  MDAL_G_minimumMaximum( g, &min, &max );
+  double fullMin, fullMax;
+  MDAL_G_minimumMaximum( fullDepth, &fullMin, &fullMax );
+  EXPECT_LE( fullMin, min );
+  EXPECT_GE( fullMax, max );
+
+  for ( int i = 0; i < MDAL_G_datasetCount( g ); ++i )
+  {
+    MDAL_DatasetH ds = MDAL_G_dataset( g, i );
+    double time = MDAL_D_time( ds );
+    EXPECT_GE( time, 2 - 1e-6 );
+    EXPECT_LE( time, 3 + 1e-6 );
+
+    // same values as the dataset at the same time in the full group
+    MDAL_DatasetH fullDs = MDAL_G_dataset( fullDepth, i + 24 );
+    EXPECT_DOUBLE_EQ( MDAL_D_time( fullDs ), time );
+    EXPECT_DOUBLE_EQ( getValue( fullDs, 60 ), getValue( ds, 60 ) );
+  }
+
+  // single dataset groups are not restricted by the time window
+  g = MDAL_M_datasetGroup( m, 1 );
+  EXPECT_EQ( std::string( "Velocity/Maximums" ), MDAL_G_name( g ) );
+  EXPECT_EQ( 1, MDAL_G_datasetCount( g ) );
+
+  MDAL_CloseMesh( m );
+
+  // null options load everything
+  m = MDAL_LoadMesh( meshPath.c_str() );
+  MDAL_M_LoadDatasetsWithOptions( m, path.c_str(), nullptr );
+  EXPECT_EQ( 9, MDAL_M_datasetGroupCount( m ) );
+  MDAL_CloseMesh( m );
+
+  // options of the mesh load also apply to the groups of the mesh file
+  const char *meshOptions[] = {"GROUPS=Depth", nullptr};
+  m = MDAL_LoadMeshWithOptions( meshPath.c_str(), meshOptions );
+  ASSERT_NE( m, nullptr );
+  EXPECT_EQ( 0, MDAL_M_datasetGroupCount( m ) );
+  EXPECT_EQ( MDAL_M_vertexCount( fullMesh ), MDAL_M_vertexCount( m ) );
+  MDAL_CloseMesh( m );
+
+  MDAL_CloseMesh( fullMesh );
+}
 
 int main( int argc, char **argv )
 {
@@ -0,0 +1,83 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <string>
+
+//mdal
+#include "mdal.h"
+#include "mdal_config.hpp"
+#include "mdal_testutils.hpp"
+
+#ifdef HAVE_HDF5
+#include "frmts/mdal_hdf5.hpp"
+
+//! Creates a file with a chunked dataset of doubles of 4 x 300000 values and chunks of 1 x 150000 values (1.2 MB)
+static void createChunkedFile( const std::string &path )
+{
+  hid_t file = H5Fcreate( path.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+  ASSERT_GE( file, 0 );
+  const hsize_t dims[2] = {4, 300000};
+  const hsize_t chunkDims[2] = {1, 150000};
+  hid_t space = H5Screate_simple( 2, dims, nullptr );
+  hid_t dcpl = H5Pcreate( H5P_DATASET_CREATE );
+  H5Pset_chunk( dcpl, 2, chunkDims );
+  hid_t dataset = H5Dcreate2( file, "values", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, dcpl, H5P_DEFAULT );
+  EXPECT_GE( dataset, 0 );
+  H5Dclose( dataset );
+  H5Pclose( dcpl );
+  H5Sclose( space );
+  H5Fclose( file );
+}
+
+//! Returns the size of the chunk cache of the opened dataset
+static size_t chunkCacheSize( const HdfDataset &dataset )
+{
+  hid_t dapl = H5Dget_access_plist( dataset.id() );
+  size_t slots = 0;
+  size_t bytes = 0;
+  double w0 = 0;
+  H5Pget_chunk_cache( dapl, &slots, &bytes, &w0 );
+  H5Pclose( dapl );
+  return bytes;
+}
+
+//! Returns the size of the chunk cache of the dataset of the file opened for reading
+static size_t datasetChunkCacheSize( const std::string &path )
+{
+  HdfFile file( path, HdfFile::ReadOnly );
+  return chunkCacheSize( file.dataset( "values" ) );
+}
+
+TEST( MdalHdf5Test, DatasetChunkCacheSize )
+{
+  const std::string path = tmp_file( "/chunk_cache.h5" );
+  createChunkedFile( path );
+  const size_t defaultSize = 1024 * 1024;
+  EXPECT_EQ( defaultSize, HdfFile::datasetChunkCacheSize() );
+  EXPECT_EQ( defaultSize, datasetChunkCacheSize( path ) );
+
+  // sized for the 2 chunks of one index of the first dimension
+  MDAL_SetHdf5DatasetChunkCacheSize( 64 * 1024 * 1024 );
+  EXPECT_EQ( 2 * 150000 * sizeof( double ), datasetChunkCacheSize( path ) );
+
+  // each dataset is capped, not sharing a budget with the other opened datasets
+  MDAL_SetHdf5DatasetChunkCacheSize( 2 * 1024 * 1024 );
+  {
+    HdfFile file( path, HdfFile::ReadOnly );
+    HdfDataset dataset1 = file.dataset( "values" );
+    HdfDataset dataset2 = file.dataset( "values" );
+    EXPECT_EQ( 2 * 1024 * 1024, chunkCacheSize( dataset1 ) );
+    EXPECT_EQ( 2 * 1024 * 1024, chunkCacheSize( dataset2 ) );
+  }
+
+  MDAL_SetHdf5DatasetChunkCacheSize( -1 );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  EXPECT_EQ( 2 * 1024 * 1024, HdfFile::datasetChunkCacheSize() );
+
+  MDAL_SetHdf5DatasetChunkCacheSize( static_cast<int64_t>( defaultSize ) );
+  EXPECT_EQ( defaultSize, datasetChunkCacheSize( path ) );
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+//mdal
+#include "mdal.h"
+#include "mdal_histogram.hpp"
+#include "mdal_testutils.hpp"
+
+TEST( MdalHistogramTest, Quantiles )
+{
+  MDAL::Histogram histogram;
+  EXPECT_TRUE( std::isnan( histogram.quantile( 0.5 ) ) );
+
+  // values from 0 to 999, added in blocks extending the range on both sides
+  std::vector<double> values;
+  for ( int i = 500; i < 600; ++i )
+    values.push_back( i );
+  histogram.addValues( values.data(), values.size(), false );
+  values.clear();
+  for ( int i = 0; i < 500; ++i )
+    values.push_back( i );
+  values.push_back( std::numeric_limits<double>::quiet_NaN() );
+  values.push_back( std::numeric_limits<double>::infinity() );
+  histogram.addValues( values.data(), values.size(), false );
+  values.clear();
+  for ( int i = 600; i < 1000; ++i )
+    values.push_back( i );
+  histogram.addValues( values.data(), values.size(), false );
+
+  EXPECT_EQ( 1000, histogram.valuesCount() );
+  EXPECT_DOUBLE_EQ( 0, histogram.quantile( 0 ) );
+  EXPECT_DOUBLE_EQ( 999, histogram.quantile( 1 ) );
+  const double tolerance = 999.0 / 256;
+  EXPECT_NEAR( 20, histogram.quantile( 0.02 ), tolerance );
+  EXPECT_NEAR( 500, histogram.quantile( 0.5 ), tolerance );
+  EXPECT_NEAR( 980, histogram.quantile( 0.98 ), tolerance );
+
+  std::vector<uint64_t> counts( 4 );
+  histogram.counts( 0, 999, 4, counts.data() );
+  for ( uint64_t count : counts )
+    EXPECT_NEAR( 250, static_cast<double>( count ), 4 );
+  EXPECT_EQ( 1000, counts[0] + counts[1] + counts[2] + counts[3] );
+
+  // values outside of the requested range are not counted
+  histogram.counts( 0, 499, 1, counts.data() );
+  EXPECT_NEAR( 500, static_cast<double>( counts[0] ), 4 );
+}
+
+TEST( MdalHistogramTest, SingleValue )
+{
+  MDAL::Histogram histogram;
+  const std::vector<double> values( 10, 3.5 );
+  histogram.addValues( values.data(), values.size(), false );
+  EXPECT_DOUBLE_EQ( 3.5, histogram.quantile( 0.3 ) );
+
+  uint64_t count = 0;
+  histogram.counts( 3.5, 3.5, 1, &count );
+  EXPECT_EQ( 10, count );
+}
+
+TEST( MdalHistogramTest, VectorsAndMerge )
+{
+  // magnitudes 5 and 10
+  const std::vector<double> vectors1 = {3, 4, 3, 4};
+  const std::vector<double> vectors2 = {6, 8, -6, -8, std::numeric_limits<double>::quiet_NaN(), 1};
+
+  MDAL::Histogram histogram1;
+  histogram1.addValues( vectors1.data(), 2, true );
+  MDAL::Histogram histogram2;
+  histogram2.addValues( vectors2.data(), 3, true );
+
+  // merging does not depend on the order
+  MDAL::Histogram merged1 = histogram1;
+  merged1.merge( histogram2 );
+  MDAL::Histogram merged2 = histogram2;
+  merged2.merge( histogram1 );
+
+  EXPECT_EQ( 4, merged1.valuesCount() );
+  std::vector<uint64_t> counts1( 5 );
+  std::vector<uint64_t> counts2( 5 );
+  merged1.counts( 5, 10, 5, counts1.data() );
+  merged2.counts( 5, 10, 5, counts2.data() );
+  EXPECT_EQ( counts1, counts2 );
+  EXPECT_EQ( 2, counts1[0] );
+  EXPECT_EQ( 2, counts1[4] );
+  EXPECT_DOUBLE_EQ( 5, merged1.quantile( 0 ) );
+  EXPECT_DOUBLE_EQ( 10, merged1.quantile( 1 ) );
+}
+
+//! Checks that the quantiles of \a histogram are within 4 times the range of the \a values divided by the bins count
+static void expectQuantilesAccuracy( const MDAL::Histogram &histogram, std::vector<double> values )
+{
+  std::sort( values.begin(), values.end() );
+  const double tolerance = 4 * ( values.back() - values.front() ) / MDAL::Histogram::BINS_COUNT;
+  // not at the limits of the parts, where any value of the gap between the parts is a quantile
+  for ( int i = 0; i < 100; ++i )
+  {
+    const double probability = ( i + 0.5 ) / 100.0;
+    const double expected = values[static_cast<size_t>( probability * static_cast<double>( values.size() ) )];
+    EXPECT_NEAR( expected, histogram.quantile( probability ), tolerance ) << "probability " << probability;
+  }
+}
+
+TEST( MdalHistogramTest, MergeDisjointRanges )
+{
+  // values of each part in [ 100 * k, 100 * k + 1 ], the bins grow with each part
+  std::vector<double> values;
+  MDAL::Histogram merged;
+  MDAL::Histogram added;
+  for ( int k = 0; k < 20; ++k )
+  {
+    std::vector<double> partValues;
+    for ( int i = 0; i < 1000; ++i )
+      partValues.push_back( 100.0 * k + i / 1000.0 );
+    values.insert( values.end(), partValues.begin(), partValues.end() );
+
+    MDAL::Histogram part;
+    part.addValues( partValues.data(), partValues.size(), false );
+    merged.merge( part );
+    added.addValues( partValues.data(), partValues.size(), false );
+  }
+
+  EXPECT_EQ( values.size(), merged.valuesCount() );
+  expectQuantilesAccuracy( merged, values );
+  expectQuantilesAccuracy( added, values );
+
+  // parts on both sides, merged in decreasing order
+  MDAL::Histogram reversed;
+  for ( int k = 19; k >= 0; --k )
+  {
+    MDAL::Histogram part;
+    part.addValues( values.data() + k * 1000, 1000, false );
+    reversed.merge( part );
+  }
+  expectQuantilesAccuracy( reversed, values );
+}
+
+TEST( MdalHistogramTest, WriteAndRead )
+{
+  MDAL::Histogram histogram;
+  std::vector<double> values;
+  for ( int i = 0; i < 100; ++i )
+    values.push_back( std::sin( i ) * 100 );
+  histogram.addValues( values.data(), values.size(), false );
+
+  std::stringstream stream;
+  histogram.write( stream );
+  MDAL::Histogram read;
+  ASSERT_TRUE( read.read( stream ) );
+  EXPECT_EQ( histogram.valuesCount(), read.valuesCount() );
+  for ( double probability = 0; probability <= 1; probability += 0.1 )
+    EXPECT_DOUBLE_EQ( histogram.quantile( probability ), read.quantile( probability ) );
+
+  // truncated
+  stream.str( "" );
+  histogram.write( stream );
+  std::stringstream partial( stream.str().substr( 0, 40 ) );
+  EXPECT_FALSE( read.read( partial ) );
+  EXPECT_EQ( 0, read.valuesCount() );
+}
@@ -0,0 +1,291 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <limits>
+#include <cmath>
+#include <vector>
+
+//mdal
+#include "mdal.h"
+#include "mdal_memory_data_model.hpp"
+#include "mdal_histogram.hpp"
+#include "mdal_utils.hpp"
+#include "mdal_logger.hpp"
+#include "mdal_testutils.hpp"
+
+TEST( MdalMemoryDataModelTest, Faces )
+{
+  MDAL::Faces faces;
+  EXPECT_TRUE( faces.empty() );
+  EXPECT_EQ( faces.vertexIndicesCount(), 0 );
+
+  faces.addFace( MDAL::Face( {0, 1, 2} ) );
+  size_t quad[4] = {1, 3, 4, 2};
+  faces.addFace( quad, 4 );
+  faces.addFace( MDAL::Face() );
+
+  EXPECT_EQ( faces.size(), 3 );
+  EXPECT_EQ( faces.vertexIndicesCount(), 7 );
+  EXPECT_EQ( faces.faceSize( 0 ), 3 );
+  EXPECT_EQ( faces.faceSize( 1 ), 4 );
+  EXPECT_EQ( faces.faceSize( 2 ), 0 );
+  EXPECT_EQ( faces.vertexIndex( 1, 1 ), 3 );
+  EXPECT_EQ( faces.face( 1 ), MDAL::Face( {1, 3, 4, 2} ) );
+  EXPECT_FALSE( faces.isWide() );
+
+  faces.setVertexIndex( 0, 2, 5 );
+  EXPECT_EQ( faces.face( 0 ), MDAL::Face( {0, 1, 5} ) );
+
+  MDAL::Faces other;
+  other.addFace( MDAL::Face( {7, 8, 9} ) );
+  faces.append( other );
+  EXPECT_EQ( faces.size(), 4 );
+  EXPECT_EQ( faces.face( 3 ), MDAL::Face( {7, 8, 9} ) );
+
+  // indices that do not fit into 32 bits
+  if ( sizeof( size_t ) > sizeof( uint32_t ) )
+  {
+    const size_t bigIndex = static_cast<size_t>( std::numeric_limits<uint32_t>::max() ) + 1;
+    faces.setVertexIndex( 3, 0, bigIndex );
+    EXPECT_TRUE( faces.isWide() );
+    EXPECT_EQ( faces.face( 3 ), MDAL::Face( {bigIndex, 8, 9} ) );
+    EXPECT_EQ( faces.face( 1 ), MDAL::Face( {1, 3, 4, 2} ) );
+
+    MDAL::Faces narrow;
+    narrow.addFace( MDAL::Face( {1, 2, 3} ) );
+    narrow.append( faces );
+    EXPECT_TRUE( narrow.isWide() );
+    EXPECT_EQ( narrow.size(), 5 );
+    EXPECT_EQ( narrow.face( 0 ), MDAL::Face( {1, 2, 3} ) );
+    EXPECT_EQ( narrow.face( 4 ), MDAL::Face( {bigIndex, 8, 9} ) );
+  }
+}
+
+TEST( MdalMemoryDataModelTest, SinglePrecisionDataset )
+{
+  MDAL::MemoryMesh mesh( "test", 3, "mesh" );
+  MDAL::Vertices vertices( 3 );
+  mesh.setVertices( vertices );
+
+  MDAL::DatasetGroup group( "test", &mesh, "mesh", "values" );
+  group.setDataLocation( MDAL_DataLocation::DataOnVertices );
+  group.setIsScalar( true );
+
+  MDAL::MemoryDataset2D dataset( &group, false, true );
+  EXPECT_TRUE( dataset.isSinglePrecision() );
+  dataset.setScalarValue( 0, 1.5 );
+  dataset.setScalarValue( 2, -2.25 );
+  EXPECT_DOUBLE_EQ( dataset.scalarValue( 2 ), -2.25 );
+
+  std::vector<double> buffer( 3 );
+  EXPECT_EQ( dataset.scalarData( 0, 3, buffer.data() ), 3 );
+  EXPECT_DOUBLE_EQ( buffer[0], 1.5 );
+  EXPECT_TRUE( std::isnan( buffer[1] ) );
+  EXPECT_DOUBLE_EQ( buffer[2], -2.25 );
+
+  EXPECT_EQ( dataset.scalarData( 1, 5, buffer.data() ), 2 );
+  EXPECT_TRUE( std::isnan( buffer[0] ) );
+  EXPECT_DOUBLE_EQ( buffer[1], -2.25 );
+}
+
+TEST( MdalMemoryDataModelTest, LazyStatistics )
+{
+  MDAL::MemoryMesh mesh( "test", 3, "mesh" );
+  MDAL::Vertices vertices( 3 );
+  mesh.setVertices( vertices );
+
+  MDAL::DatasetGroup group( "test", &mesh, "mesh", "values" );
+  group.setDataLocation( MDAL_DataLocation::DataOnVertices );
+  group.setIsScalar( true );
+
+  std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared<MDAL::MemoryDataset2D>( &group );
+  dataset->setScalarValue( 0, 1.5 );
+  dataset->setScalarValue( 1, -2 );
+  dataset->setScalarValue( 2, std::numeric_limits<double>::quiet_NaN() );
+  group.datasets.push_back( dataset );
+
+  // computed on first call
+  EXPECT_DOUBLE_EQ( -2, dataset->statistics().minimum );
+  EXPECT_DOUBLE_EQ( 1.5, dataset->statistics().maximum );
+  EXPECT_DOUBLE_EQ( -2, group.statistics().minimum );
+
+  // kept until invalidated
+  dataset->setScalarValue( 2, 4 );
+  EXPECT_DOUBLE_EQ( 1.5, dataset->statistics().maximum );
+  dataset->invalidateStatistics();
+  EXPECT_DOUBLE_EQ( 4, dataset->statistics().maximum );
+  EXPECT_DOUBLE_EQ( 1.5, group.statistics().maximum );
+  group.invalidateStatistics();
+  EXPECT_DOUBLE_EQ( 4, group.statistics().maximum );
+
+  // statistics set by the driver are not computed
+  MDAL::Statistics stats;
+  stats.minimum = -10;
+  stats.maximum = 10;
+  dataset->setStatistics( stats );
+  group.invalidateStatistics();
+  EXPECT_DOUBLE_EQ( -10, dataset->statistics().minimum );
+  EXPECT_DOUBLE_EQ( 10, group.statistics().maximum );
+}
+
+//! Memory dataset behaving as the datasets of drivers that cannot be read from different threads
+class SerialMemoryDataset: public MDAL::MemoryDataset2D
+{
+  public:
+    SerialMemoryDataset( MDAL::DatasetGroup *grp ): MDAL::MemoryDataset2D( grp ) {}
+    bool supportsConcurrentReads() const override {return false;}
+};
+
+TEST( MdalMemoryDataModelTest, ParallelStatistics )
+{
+  // enough values to spread the datasets over several threads
+  const size_t verticesCount = 100000;
+  MDAL::MemoryMesh mesh( "test", 3, "mesh" );
+  mesh.setVertices( MDAL::Vertices( verticesCount ) );
+
+  MDAL::DatasetGroup group( "test", &mesh, "mesh", "velocity" );
+  group.setDataLocation( MDAL_DataLocation::DataOnVertices );
+  group.setIsScalar( false );
+
+  for ( size_t i = 0; i < 16; ++i )
+  {
+    std::shared_ptr<MDAL::MemoryDataset2D> dataset;
+    if ( i % 2 )
+      dataset = std::make_shared<SerialMemoryDataset>( &group );
+    else
+      dataset = std::make_shared<MDAL::MemoryDataset2D>( &group );
+
+    for ( size_t j = 0; j < verticesCount; ++j )
+      dataset->setVectorValue( j, std::sin( static_cast<double>( i + j ) ), std::cos( static_cast<double>( i * j ) ) * i );
+    group.datasets.push_back( dataset );
+  }
+
+  MDAL::setThreadCount( 1 );
+  const MDAL::Statistics serial = MDAL::calculateStatistics( &group );
+  std::vector<MDAL::Statistics> serialDatasets;
+  for ( const std::shared_ptr<MDAL::Dataset> &dataset : group.datasets )
+  {
+    serialDatasets.push_back( dataset->statistics() );
+    dataset->invalidateStatistics();
+  }
+
+  MDAL::setThreadCount( 4 );
+  EXPECT_EQ( 4, MDAL::threadCount() );
+  const MDAL::Statistics parallel = MDAL::calculateStatistics( &group );
+  EXPECT_EQ( serial.minimum, parallel.minimum );
+  EXPECT_EQ( serial.maximum, parallel.maximum );
+  for ( size_t i = 0; i < group.datasets.size(); ++i )
+  {
+    EXPECT_EQ( serialDatasets[i].minimum, group.datasets[i]->statistics().minimum );
+    EXPECT_EQ( serialDatasets[i].maximum, group.datasets[i]->statistics().maximum );
+  }
+
+  // back to the count of hardware threads
+  MDAL::setThreadCount( 0 );
+  EXPECT_LE( 1, MDAL::threadCount() );
+}
+
+//! Memory dataset logging a warning for each read, as the datasets of drivers reading invalid values
+class WarningMemoryDataset: public MDAL::MemoryDataset2D
+{
+  public:
+    WarningMemoryDataset( MDAL::DatasetGroup *grp ): MDAL::MemoryDataset2D( grp ) {}
+    size_t scalarData( size_t indexStart, size_t count, double *buffer ) override
+    {
+      MDAL::Log::warning( MDAL_Status::Warn_InvalidElements, "invalid values" );
+      return MDAL::MemoryDataset2D::scalarData( indexStart, count, buffer );
+    }
+};
+
+TEST( MdalMemoryDataModelTest, ParallelStatisticsLastStatus )
+{
+  const size_t verticesCount = 100000;
+  MDAL::MemoryMesh mesh( "test", 3, "mesh" );
+  mesh.setVertices( MDAL::Vertices( verticesCount ) );
+
+  MDAL::DatasetGroup group( "test", &mesh, "mesh", "depth" );
+  group.setDataLocation( MDAL_DataLocation::DataOnVertices );
+  group.setIsScalar( true );
+
+  // only the last dataset, read by a worker thread, logs a warning
+  for ( size_t i = 0; i < 16; ++i )
+  {
+    std::shared_ptr<MDAL::MemoryDataset2D> dataset;
+    if ( i == 15 )
+      dataset = std::make_shared<WarningMemoryDataset>( &group );
+    else
+      dataset = std::make_shared<MDAL::MemoryDataset2D>( &group );
+
+    for ( size_t j = 0; j < verticesCount; ++j )
+      dataset->setScalarValue( j, static_cast<double>( i + j ) );
+    group.datasets.push_back( dataset );
+  }
+
+  MDAL::setThreadCount( 4 );
+  MDAL::Log::resetLastStatus();
+  MDAL::Statistics stats = MDAL::calculateStatistics( &group );
+  EXPECT_EQ( MDAL_Status::Warn_InvalidElements, MDAL::Log::getLastStatus() );
+  EXPECT_DOUBLE_EQ( 0, stats.minimum );
+  EXPECT_DOUBLE_EQ( 15 + verticesCount - 1, stats.maximum );
+
+  MDAL::Log::resetLastStatus();
+  group.datasets.pop_back();
+  for ( const std::shared_ptr<MDAL::Dataset> &dataset : group.datasets )
+    dataset->invalidateStatistics();
+  stats = MDAL::calculateStatistics( &group );
+  EXPECT_EQ( MDAL_Status::None, MDAL::Log::getLastStatus() );
+  EXPECT_DOUBLE_EQ( 14 + verticesCount - 1, stats.maximum );
+
+  MDAL::setThreadCount( 0 );
+}
+
+//! Memory dataset counting the reads of its values
+class CountingMemoryDataset: public MDAL::MemoryDataset2D
+{
+  public:
+    CountingMemoryDataset( MDAL::DatasetGroup *grp ): MDAL::MemoryDataset2D( grp ) {}
+    size_t scalarData( size_t indexStart, size_t count, double *buffer ) override
+    {
+      valuesRead += count;
+      return MDAL::MemoryDataset2D::scalarData( indexStart, count, buffer );
+    }
+    size_t valuesRead = 0;
+};
+
+TEST( MdalMemoryDataModelTest, HistogramWithStatistics )
+{
+  const size_t verticesCount = 1000;
+  MDAL::MemoryMesh mesh( "test", 3, "mesh" );
+  mesh.setVertices( MDAL::Vertices( verticesCount ) );
+
+  MDAL::DatasetGroup group( "test", &mesh, "mesh", "depth" );
+  group.setDataLocation( MDAL_DataLocation::DataOnVertices );
+  group.setIsScalar( true );
+  std::vector<std::shared_ptr<CountingMemoryDataset>> datasets;
+  for ( size_t i = 0; i < 3; ++i )
+  {
+    std::shared_ptr<CountingMemoryDataset> dataset = std::make_shared<CountingMemoryDataset>( &group );
+    for ( size_t j = 0; j < verticesCount; ++j )
+      dataset->setScalarValue( j, static_cast<double>( i * verticesCount + j ) );
+    group.datasets.push_back( dataset );
+    datasets.push_back( dataset );
+  }
+
+  // the values are read once for the statistics and the histograms
+  const MDAL::Statistics stats = group.statistics();
+  EXPECT_DOUBLE_EQ( 0, stats.minimum );
+  EXPECT_DOUBLE_EQ( 3 * verticesCount - 1, stats.maximum );
+  for ( const std::shared_ptr<CountingMemoryDataset> &dataset : datasets )
+  {
+    EXPECT_EQ( verticesCount, dataset->valuesRead );
+    EXPECT_TRUE( dataset->hasHistogram() );
+  }
+
+  std::shared_ptr<const MDAL::Histogram> histogram = group.histogram();
+  EXPECT_EQ( 3 * verticesCount, histogram->valuesCount() );
+  EXPECT_NEAR( 1500, histogram->quantile( 0.5 ), 4 * 3000.0 / MDAL::Histogram::BINS_COUNT );
+  for ( const std::shared_ptr<CountingMemoryDataset> &dataset : datasets )
+    EXPECT_EQ( verticesCount, dataset->valuesRead );
+}
@@ -0,0 +1,126 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+//mdal
+#include "mdal.h"
+#include "mdal_config.hpp"
+#include "mdal_driver_manager.hpp"
+#include "mdal_testutils.hpp"
+
+#ifdef HAVE_NETCDF
+#include "frmts/mdal_netcdf.hpp"
+
+static void expectSameValue( double expected, double value )
+{
+  if ( std::isnan( expected ) )
+    EXPECT_TRUE( std::isnan( value ) );
+  else
+    EXPECT_DOUBLE_EQ( expected, value );
+}
+
+TEST( MdalNetCDFTest, TimeSeriesReads )
+{
+  std::unique_ptr<MDAL::Mesh> mesh = MDAL::DriverManager::instance().load( test_file( "/ugrid/D-Flow1.1/manzese_1d2d_small_map.nc" ), "mesh2d" );
+  ASSERT_TRUE( mesh );
+  std::shared_ptr<MDAL::DatasetGroup> group = mesh->datasetGroups[3];
+  ASSERT_EQ( "Total bed shear stress", group->name() );
+  ASSERT_EQ( 6, group->datasets.size() );
+  const size_t valuesCount = group->datasets[0]->valuesCount();
+  ASSERT_EQ( 1824, valuesCount );
+
+  // time series: only the requested values of each timestep are read, their blocks are not cached
+  const std::vector<size_t> indices = {3, 1000, 1823, 1824};
+  std::vector<std::vector<double>> timeSeries;
+  size_t readCount = NetCDFFile::timestepValuesReadCount();
+  for ( const std::shared_ptr<MDAL::Dataset> &dataset : group->datasets )
+  {
+    std::vector<double> values( indices.size() );
+    // stops at the index out of range
+    EXPECT_EQ( 3, dataset->scalarDataAt( indices.data(), indices.size(), values.data() ) );
+    timeSeries.push_back( values );
+  }
+  EXPECT_EQ( 3 * group->datasets.size(), NetCDFFile::timestepValuesReadCount() - readCount );
+
+  // read again, not taken from the cache
+  std::vector<double> values( indices.size() );
+  readCount = NetCDFFile::timestepValuesReadCount();
+  EXPECT_EQ( 3, group->datasets[5]->scalarDataAt( indices.data(), 3, values.data() ) );
+  EXPECT_EQ( 3, NetCDFFile::timestepValuesReadCount() - readCount );
+
+  // a single value is read alone too
+  readCount = NetCDFFile::timestepValuesReadCount();
+  double value = 0;
+  EXPECT_EQ( 1, group->datasets[5]->scalarData( 1000, 1, &value ) );
+  EXPECT_EQ( 1, NetCDFFile::timestepValuesReadCount() - readCount );
+  expectSameValue( timeSeries[5][1], value );
+
+  // whole timesteps are read once in a cached block, same values as the time series
+  for ( size_t ts = 0; ts < group->datasets.size(); ++ts )
+  {
+    std::vector<double> whole( valuesCount );
+    readCount = NetCDFFile::timestepValuesReadCount();
+    EXPECT_EQ( valuesCount, group->datasets[ts]->scalarData( 0, valuesCount, whole.data() ) );
+    EXPECT_EQ( valuesCount, NetCDFFile::timestepValuesReadCount() - readCount );
+    for ( size_t i = 0; i < 3; ++i )
+      expectSameValue( whole[indices[i]], timeSeries[ts][i] );
+  }
+
+  // the values of cached blocks are not read again
+  readCount = NetCDFFile::timestepValuesReadCount();
+  EXPECT_EQ( 3, group->datasets[5]->scalarDataAt( indices.data(), 3, values.data() ) );
+  EXPECT_EQ( 1, group->datasets[5]->scalarData( 1000, 1, &value ) );
+  EXPECT_EQ( 0, NetCDFFile::timestepValuesReadCount() - readCount );
+  for ( size_t i = 0; i < 3; ++i )
+    expectSameValue( timeSeries[5][i], values[i] );
+}
+
+TEST( MdalNetCDFTest, BlockCacheSize )
+{
+  const int64_t defaultSize = 64 * 1024 * 1024;
+  EXPECT_EQ( defaultSize, MDAL_NetCDFBlockCacheSize() );
+
+  std::unique_ptr<MDAL::Mesh> mesh = MDAL::DriverManager::instance().load( test_file( "/ugrid/D-Flow1.1/manzese_1d2d_small_map.nc" ), "mesh2d" );
+  ASSERT_TRUE( mesh );
+  std::shared_ptr<MDAL::Dataset> dataset = mesh->datasetGroups[3]->datasets[2];
+  const size_t valuesCount = dataset->valuesCount();
+  std::vector<double> values( valuesCount );
+
+  // disabled, each read reads the values
+  MDAL_SetNetCDFBlockCacheSize( 0 );
+  EXPECT_EQ( 0, MDAL_NetCDFBlockCacheSize() );
+  for ( int i = 0; i < 2; ++i )
+  {
+    const size_t readCount = NetCDFFile::timestepValuesReadCount();
+    EXPECT_EQ( valuesCount, dataset->scalarData( 0, valuesCount, values.data() ) );
+    EXPECT_EQ( valuesCount, NetCDFFile::timestepValuesReadCount() - readCount );
+  }
+  EXPECT_EQ( 0, NetCDFFile::blockCacheUsage() );
+
+  MDAL_SetNetCDFBlockCacheSize( defaultSize );
+  EXPECT_EQ( valuesCount, dataset->scalarData( 0, valuesCount, values.data() ) );
+  EXPECT_EQ( valuesCount * sizeof( double ), NetCDFFile::blockCacheUsage() );
+  size_t readCount = NetCDFFile::timestepValuesReadCount();
+  EXPECT_EQ( valuesCount, dataset->scalarData( 0, valuesCount, values.data() ) );
+  EXPECT_EQ( 0, NetCDFFile::timestepValuesReadCount() - readCount );
+
+  // smaller than a block, the last block read is kept
+  MDAL_SetNetCDFBlockCacheSize( 1024 );
+  EXPECT_EQ( valuesCount * sizeof( double ), NetCDFFile::blockCacheUsage() );
+  MDAL_SetNetCDFBlockCacheSize( -1 );
+  EXPECT_EQ( MDAL_Status::Err_InvalidData, MDAL_LastStatus() );
+  EXPECT_EQ( 1024, MDAL_NetCDFBlockCacheSize() );
+  MDAL_SetNetCDFBlockCacheSize( defaultSize );
+
+  // the blocks of the file are removed when it is closed
+  dataset.reset();
+  mesh.reset();
+  EXPECT_EQ( 0, NetCDFFile::blockCacheUsage() );
+}
+
+#endif
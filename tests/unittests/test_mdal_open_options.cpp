@@ -0,0 +1,84 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <memory>
+#include <string>
+
+//mdal
+#include "mdal.h"
+#include "mdal_open_options.hpp"
+#include "mdal_memory_data_model.hpp"
+#include "mdal_testutils.hpp"
+
+TEST( MdalOpenOptionsTest, Parse )
+{
+  EXPECT_TRUE( MDAL::OpenOptions().isEmpty() );
+  EXPECT_TRUE( MDAL::OpenOptions( nullptr ).isEmpty() );
+
+  const char *invalid[] = {"GROUPS", "TIME_START=abc", "TIME_END=", "OTHER=1", nullptr};
+  MDAL::OpenOptions invalidOptions( invalid );
+  EXPECT_TRUE( invalidOptions.isEmpty() );
+  EXPECT_TRUE( invalidOptions.acceptsGroup( "depth" ) );
+
+  const char *options[] = {"groups=Depth,, water level ", "TIME_START=1.5", "TIME_END=-2e1", nullptr};
+  MDAL::OpenOptions openOptions( options );
+  EXPECT_FALSE( openOptions.isEmpty() );
+  EXPECT_TRUE( openOptions.acceptsGroup( "depth" ) );
+  EXPECT_TRUE( openOptions.acceptsGroup( "Water Level" ) );
+  EXPECT_FALSE( openOptions.acceptsGroup( "Velocity" ) );
+
+  // empty time window, except for time independent groups
+  EXPECT_FALSE( openOptions.acceptsTime( MDAL::RelativeTimestamp( 2, MDAL::RelativeTimestamp::hours ), 10 ) );
+  EXPECT_TRUE( openOptions.acceptsTime( MDAL::RelativeTimestamp( 2, MDAL::RelativeTimestamp::hours ), 1 ) );
+
+  const char *window[] = {"TIME_START=1", "TIME_END=2", nullptr};
+  MDAL::OpenOptions windowOptions( window );
+  EXPECT_TRUE( windowOptions.acceptsGroup( "Velocity" ) );
+  EXPECT_FALSE( windowOptions.acceptsTime( MDAL::RelativeTimestamp( 59, MDAL::RelativeTimestamp::minutes ), 2 ) );
+  EXPECT_TRUE( windowOptions.acceptsTime( MDAL::RelativeTimestamp( 60, MDAL::RelativeTimestamp::minutes ), 2 ) );
+  EXPECT_TRUE( windowOptions.acceptsTime( MDAL::RelativeTimestamp( 2, MDAL::RelativeTimestamp::hours ), 2 ) );
+  EXPECT_FALSE( windowOptions.acceptsTime( MDAL::RelativeTimestamp( 3, MDAL::RelativeTimestamp::hours ), 2 ) );
+}
+
+TEST( MdalOpenOptionsTest, FilterDatasetGroups )
+{
+  MDAL::MemoryMesh mesh( "test", 3, "" );
+  mesh.datasetGroups.push_back( std::make_shared<MDAL::DatasetGroup>( "test", &mesh, "", "Bed Elevation" ) );
+  for ( const char *name : {"Depth", "Velocity"} )
+  {
+    std::shared_ptr<MDAL::DatasetGroup> group = std::make_shared<MDAL::DatasetGroup>( "test", &mesh, "", name );
+    for ( int i = 0; i < 4; ++i )
+    {
+      std::shared_ptr<MDAL::MemoryDataset2D> dataset = std::make_shared<MDAL::MemoryDataset2D>( group.get() );
+      dataset->setTime( i, MDAL::RelativeTimestamp::hours );
+      MDAL::Statistics stats;
+      stats.minimum = i;
+      stats.maximum = 10 * i;
+      dataset->setStatistics( stats );
+      group->datasets.push_back( dataset );
+    }
+    mesh.datasetGroups.push_back( group );
+  }
+
+  const char *options[] = {"GROUPS=depth", "TIME_START=1", "TIME_END=2", nullptr};
+  MDAL::OpenOptions( options ).filterDatasetGroups( mesh.datasetGroups, 1 );
+
+  // groups before the first index are kept
+  ASSERT_EQ( 2, mesh.datasetGroups.size() );
+  EXPECT_EQ( "Bed Elevation", mesh.datasetGroups[0]->name() );
+
+  std::shared_ptr<MDAL::DatasetGroup> depth = mesh.datasetGroups[1];
+  EXPECT_EQ( "Depth", depth->name() );
+  ASSERT_EQ( 2, depth->datasets.size() );
+  EXPECT_DOUBLE_EQ( 1, depth->datasets[0]->time( MDAL::RelativeTimestamp::hours ) );
+  EXPECT_DOUBLE_EQ( 1, depth->statistics().minimum );
+  EXPECT_DOUBLE_EQ( 20, depth->statistics().maximum );
+
+  // groups without dataset in the time window are removed
+  const char *late[] = {"TIME_START=10", nullptr};
+  MDAL::OpenOptions( late ).filterDatasetGroups( mesh.datasetGroups );
+  ASSERT_EQ( 1, mesh.datasetGroups.size() );
+  EXPECT_EQ( "Bed Elevation", mesh.datasetGroups[0]->name() );
+}
@@ -0,0 +1,173 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <vector>
+#include <cmath>
+
+//mdal
+#include "mdal.h"
+#include "mdal_regular_grid_mesh.hpp"
+#include "mdal_spatial_index.hpp"
+#include "mdal_testutils.hpp"
+
+//! Reads all the vertices of the mesh in form x1, y1, z1, ..., xN, yN, zN
+static std::vector<double> readVertices( MDAL::Mesh *mesh )
+{
+  std::vector<double> coordinates( mesh->verticesCount() * 3 );
+  std::unique_ptr<MDAL::MeshVertexIterator> it = mesh->readVertices();
+  // read in several chunks
+  size_t read = 0;
+  while ( size_t count = it->next( 7, coordinates.data() + read * 3 ) )
+    read += count;
+  EXPECT_EQ( mesh->verticesCount(), read );
+  return coordinates;
+}
+
+//! Reads all the faces of the mesh, 4 vertices per face
+static std::vector<int> readFaces( MDAL::Mesh *mesh )
+{
+  std::vector<int> indices( mesh->facesCount() * 4 );
+  std::vector<int> offsets( mesh->facesCount() );
+  std::unique_ptr<MDAL::MeshFaceIterator> it = mesh->readFaces();
+  size_t read = 0;
+  while ( size_t count = it->next( 5, offsets.data() + read, 20, indices.data() + read * 4 ) )
+  {
+    for ( size_t i = 0; i < count; ++i )
+      EXPECT_EQ( static_cast<int>( 4 * ( i + 1 ) ), offsets[read + i] );
+    read += count;
+  }
+  EXPECT_EQ( mesh->facesCount(), read );
+  return indices;
+}
+
+TEST( MdalRegularGridMeshTest, RotatedGrid )
+{
+  const double gt[6] = {100, 2, 0.5, 50, 0.25, -3};
+  MDAL::RegularGridMesh mesh( "test", "", 4, 3, gt );
+
+  EXPECT_EQ( 12, mesh.verticesCount() );
+  EXPECT_EQ( 6, mesh.facesCount() );
+  EXPECT_EQ( 0, mesh.edgesCount() );
+  EXPECT_FALSE( mesh.isLongitudeShifted() );
+
+  std::vector<double> coordinates = readVertices( &mesh );
+  for ( size_t y = 0; y < 3; ++y )
+    for ( size_t x = 0; x < 4; ++x )
+    {
+      const size_t index = x + 4 * y;
+      EXPECT_DOUBLE_EQ( gt[0] + ( x + 0.5 ) * gt[1] + ( y + 0.5 ) * gt[2], coordinates[index * 3] );
+      EXPECT_DOUBLE_EQ( gt[3] + ( x + 0.5 ) * gt[4] + ( y + 0.5 ) * gt[5], coordinates[index * 3 + 1] );
+      EXPECT_DOUBLE_EQ( 0, coordinates[index * 3 + 2] );
+    }
+
+  std::vector<int> faces = readFaces( &mesh );
+  // face of column 1, row 1
+  EXPECT_EQ( 10, faces[4 * 4] );
+  EXPECT_EQ( 9, faces[4 * 4 + 1] );
+  EXPECT_EQ( 5, faces[4 * 4 + 2] );
+  EXPECT_EQ( 6, faces[4 * 4 + 3] );
+
+  MDAL::BBox extent = mesh.extent();
+  EXPECT_DOUBLE_EQ( 101.25, extent.minX );
+  EXPECT_DOUBLE_EQ( 108.25, extent.maxX );
+  EXPECT_DOUBLE_EQ( 42.625, extent.minY );
+  EXPECT_DOUBLE_EQ( 49.375, extent.maxY );
+
+  // located with the geotransform, same result as the generic index
+  MDAL::MeshSpatialIndex genericIndex( &mesh );
+  for ( double y = 40.1; y < 50; y += 0.37 )
+    for ( double x = 100.1; x < 110; x += 0.29 )
+      EXPECT_EQ( genericIndex.faceAt( x, y ), mesh.faceAt( x, y ) );
+}
+
+TEST( MdalRegularGridMeshTest, LongitudeShifted )
+{
+  // whole earth, 4 degrees cells, longitudes from 2 to 358
+  const double gt[6] = {0, 4, 0, 90, 0, -4};
+  const size_t xSize = 90;
+  const size_t ySize = 45;
+  MDAL::RegularGridMesh mesh( "test", "", xSize, ySize, gt, true );
+  EXPECT_TRUE( mesh.isLongitudeShifted() );
+
+  std::vector<double> coordinates = readVertices( &mesh );
+  EXPECT_DOUBLE_EQ( 2, coordinates[0] );
+  EXPECT_DOUBLE_EQ( -2, coordinates[( xSize - 1 ) * 3] );
+
+  MDAL::BBox extent = mesh.extent();
+  EXPECT_DOUBLE_EQ( -178, extent.minX );
+  EXPECT_DOUBLE_EQ( 178, extent.maxX );
+  EXPECT_DOUBLE_EQ( -88, extent.minY );
+  EXPECT_DOUBLE_EQ( 88, extent.maxY );
+
+  // expected faces, the face crossing the antimeridian (column 44) is replaced by a face around the prime meridian
+  std::vector<int> expected;
+  for ( size_t y = 0; y < ySize - 1; ++y )
+  {
+    expected.insert( expected.end(), {static_cast<int>( xSize * ( y + 1 ) ),
+                                      static_cast<int>( xSize - 1 + xSize * ( y + 1 ) ),
+                                      static_cast<int>( xSize - 1 + xSize * y ),
+                                      static_cast<int>( xSize * y )
+                                     } );
+    for ( size_t x = 0; x < xSize - 1; ++x )
+    {
+      if ( x == 44 )
+        continue;
+      expected.insert( expected.end(), {static_cast<int>( x + 1 + xSize * ( y + 1 ) ),
+                                        static_cast<int>( x + xSize * ( y + 1 ) ),
+                                        static_cast<int>( x + xSize * y ),
+                                        static_cast<int>( x + 1 + xSize * y )
+                                       } );
+    }
+  }
+
+  ASSERT_EQ( expected.size() / 4, mesh.facesCount() );
+  EXPECT_EQ( expected, readFaces( &mesh ) );
+
+  // around the prime meridian and on the antimeridian
+  EXPECT_EQ( 0, mesh.faceAt( 0, 87 ) );
+  EXPECT_EQ( -1, mesh.faceAt( 180, 87 ) );
+}
+
+TEST( MdalRegularGridMeshTest, Editing )
+{
+  // 3 x 3 vertices with 1 unit cells, centers from (0.5, 2.5) to (2.5, 0.5)
+  const double gt[6] = {0, 1, 0, 3, 0, -1};
+  MDAL::RegularGridMesh mesh( "test", "", 3, 3, gt );
+  EXPECT_TRUE( mesh.isEditable() );
+
+  const std::vector<double> gridVertices = readVertices( &mesh );
+  const std::vector<int> gridFaces = readFaces( &mesh );
+
+  // triangle on the right of the grid
+  double coordinates[3] = {4.5, 1.5, 2};
+  mesh.addVertices( 1, coordinates );
+  int faceSizes[1] = {3};
+  int vertexIndices[3] = {5, 2, 9};
+  mesh.addFaces( 1, 4, faceSizes, vertexIndices );
+
+  ASSERT_EQ( 10, mesh.verticesCount() );
+  ASSERT_EQ( 5, mesh.facesCount() );
+  EXPECT_EQ( 0, mesh.edgesCount() );
+  EXPECT_DOUBLE_EQ( 4.5, mesh.extent().maxX );
+
+  // vertices and faces of the grid are kept
+  std::vector<double> vertices = readVertices( &mesh );
+  EXPECT_EQ( gridVertices, std::vector<double>( vertices.begin(), vertices.begin() + 27 ) );
+  EXPECT_DOUBLE_EQ( 4.5, vertices[27] );
+  EXPECT_DOUBLE_EQ( 2, vertices[29] );
+  ASSERT_NE( nullptr, mesh.verticesView() );
+
+  std::vector<int> offsets( 5 );
+  std::vector<int> faces( 20 );
+  EXPECT_EQ( 5, mesh.readFaces()->next( 5, offsets.data(), 20, faces.data() ) );
+  EXPECT_EQ( 19, offsets[4] );
+  EXPECT_EQ( gridFaces, std::vector<int>( faces.begin(), faces.begin() + 16 ) );
+  EXPECT_EQ( std::vector<int>( {5, 2, 9} ), std::vector<int>( faces.begin() + 16, faces.begin() + 19 ) );
+
+  // the spatial index includes the new face
+  EXPECT_EQ( 1, mesh.faceAt( 2, 2 ) );
+  EXPECT_EQ( 4, mesh.faceAt( 3, 1.5 ) );
+  EXPECT_EQ( -1, mesh.faceAt( 5, 1.5 ) );
+}
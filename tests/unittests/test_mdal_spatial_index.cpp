@@ -0,0 +1,157 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <vector>
+
+//mdal
+#include "mdal.h"
+#include "mdal_memory_data_model.hpp"
+#include "mdal_spatial_index.hpp"
+#include "mdal_testutils.hpp"
+
+//! Creates a regular grid mesh of size x size square faces of width 1, half of them split in two triangles
+static std::unique_ptr<MDAL::MemoryMesh> createGridMesh( size_t size )
+{
+  std::unique_ptr<MDAL::MemoryMesh> mesh( new MDAL::MemoryMesh( "test", 4, "" ) );
+
+  MDAL::Vertices vertices;
+  for ( size_t j = 0; j <= size; ++j )
+    for ( size_t i = 0; i <= size; ++i )
+    {
+      MDAL::Vertex vertex;
+      vertex.x = static_cast<double>( i );
+      vertex.y = static_cast<double>( j );
+      vertices.push_back( vertex );
+    }
+
+  MDAL::Faces faces;
+  for ( size_t j = 0; j < size; ++j )
+    for ( size_t i = 0; i < size; ++i )
+    {
+      const size_t v0 = j * ( size + 1 ) + i;
+      const size_t v1 = v0 + 1;
+      const size_t v2 = v1 + size + 1;
+      const size_t v3 = v0 + size + 1;
+      if ( i % 2 == 0 )
+      {
+        faces.addFace( MDAL::Face( {v0, v1, v2, v3} ) );
+      }
+      else
+      {
+        faces.addFace( MDAL::Face( {v0, v1, v2} ) );
+        faces.addFace( MDAL::Face( {v0, v2, v3} ) );
+      }
+    }
+
+  mesh->setVertices( vertices );
+  mesh->setFaces( faces );
+  return mesh;
+}
+
+//! Returns the expected face at point of the mesh created by createGridMesh()
+static int64_t expectedFace( size_t size, double x, double y )
+{
+  if ( x < 0 || y < 0 || x >= size || y >= size )
+    return -1;
+
+  const size_t i = static_cast<size_t>( x );
+  const size_t j = static_cast<size_t>( y );
+  // each row has size / 2 quads and ( size - size / 2 ) pairs of triangles
+  const size_t rowStart = j * ( size / 2 + 2 * ( size - size / 2 ) );
+  const size_t columnStart = i / 2 * 3 + ( i % 2 );
+  if ( i % 2 == 0 )
+    return static_cast<int64_t>( rowStart + columnStart );
+
+  const bool lowerTriangle = ( x - i ) > ( y - j );
+  return static_cast<int64_t>( rowStart + columnStart + ( lowerTriangle ? 0 : 1 ) );
+}
+
+TEST( MdalSpatialIndexTest, FaceAt )
+{
+  const size_t size = 300;
+  std::unique_ptr<MDAL::MemoryMesh> mesh = createGridMesh( size );
+  MDAL::MeshSpatialIndex index( mesh.get() );
+  EXPECT_TRUE( index.isUpToDate( mesh.get() ) );
+
+  EXPECT_EQ( 0, index.faceAt( 0.5, 0.5 ) );
+  EXPECT_EQ( 1, index.faceAt( 1.7, 0.2 ) );
+  EXPECT_EQ( 2, index.faceAt( 1.2, 0.7 ) );
+  EXPECT_EQ( -1, index.faceAt( -0.5, 0.5 ) );
+  EXPECT_EQ( -1, index.faceAt( 0.5, 300.5 ) );
+
+  std::vector<double> coordinates;
+  for ( double y = -1.13; y < size + 1; y += 0.7 )
+    for ( double x = -1.05; x < size + 1; x += 0.9 )
+    {
+      coordinates.push_back( x );
+      coordinates.push_back( y );
+    }
+
+  const size_t count = coordinates.size() / 2;
+  std::vector<int64_t> faceIndexes( count );
+  size_t found = index.facesAt( count, coordinates.data(), faceIndexes.data() );
+
+  size_t expectedFound = 0;
+  for ( size_t i = 0; i < count; ++i )
+  {
+    const int64_t expected = expectedFace( size, coordinates[i * 2], coordinates[i * 2 + 1] );
+    EXPECT_EQ( expected, faceIndexes[i] );
+    if ( expected >= 0 )
+      ++expectedFound;
+  }
+  EXPECT_EQ( expectedFound, found );
+}
+
+TEST( MdalSpatialIndexTest, FaceBoundary )
+{
+  std::unique_ptr<MDAL::MemoryMesh> mesh = createGridMesh( 2 );
+  MDAL::MeshSpatialIndex index( mesh.get() );
+
+  // points on the edges, the lowest index of the faces sharing the edge is returned
+  EXPECT_EQ( 0, index.faceAt( 0.0, 0.5 ) );
+  EXPECT_EQ( 0, index.faceAt( 0.5, 1.0 ) );
+  EXPECT_EQ( 1, index.faceAt( 2.0, 0.5 ) );
+  EXPECT_EQ( 3, index.faceAt( 0.5, 2.0 ) );
+  EXPECT_EQ( 4, index.faceAt( 1.5, 1.5 ) );
+  EXPECT_EQ( 5, index.faceAt( 1.5, 2.0 ) );
+
+  // vertices
+  EXPECT_EQ( 0, index.faceAt( 0.0, 0.0 ) );
+  EXPECT_EQ( 0, index.faceAt( 1.0, 1.0 ) );
+  EXPECT_EQ( 1, index.faceAt( 2.0, 0.0 ) );
+  EXPECT_EQ( 4, index.faceAt( 2.0, 2.0 ) );
+  EXPECT_EQ( 3, index.faceAt( 0.0, 2.0 ) );
+
+  EXPECT_EQ( -1, index.faceAt( 2.0 + 1e-6, 1.0 ) );
+  EXPECT_EQ( -1, index.faceAt( 1.0, 2.0 + 1e-6 ) );
+
+  size_t vertexIndexes[3];
+  double weights[3];
+  EXPECT_EQ( 4, index.interpolationAt( 2.0, 2.0, vertexIndexes, weights ) );
+  for ( size_t i = 0; i < 3; ++i )
+  {
+    if ( vertexIndexes[i] == 8 )
+      EXPECT_DOUBLE_EQ( 1.0, weights[i] );
+    else
+      EXPECT_NEAR( 0.0, weights[i], 1e-12 );
+  }
+}
+
+TEST( MdalSpatialIndexTest, MeshModified )
+{
+  std::unique_ptr<MDAL::MemoryMesh> mesh = createGridMesh( 2 );
+  EXPECT_EQ( 0, mesh->faceAt( 0.5, 0.5 ) );
+  EXPECT_EQ( -1, mesh->faceAt( 2.3, 0.3 ) );
+
+  // add a triangle on the right of the mesh
+  double coordinates[3] = {3, 0, 0};
+  mesh->addVertices( 1, coordinates );
+  int faceSizes[1] = {3};
+  int vertexIndices[3] = {2, 9, 5};
+  mesh->addFaces( 1, 3, faceSizes, vertexIndices );
+
+  EXPECT_EQ( 6, mesh->faceAt( 2.3, 0.3 ) );
+  EXPECT_EQ( 0, mesh->faceAt( 0.5, 0.5 ) );
+}
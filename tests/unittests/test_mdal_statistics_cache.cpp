@@ -0,0 +1,135 @@
+/*
+ MDAL - Mesh Data Abstraction Library (MIT License)
+ Copyright (C) 2026 agent (agent at local)
+*/
+#include "gtest/gtest.h"
+#include <fstream>
+#include <string>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if !defined(WIN32)
+#include <fcntl.h>
+#endif
+
+//mdal
+#include "mdal.h"
+#include "mdal_driver_manager.hpp"
+#include "mdal_statistics_cache.hpp"
+#include "mdal_histogram.hpp"
+#include "mdal_utils.hpp"
+#include "mdal_testutils.hpp"
+
+//! Loads the mesh with the datasets of the dat file and returns the group of the datasets
+static std::unique_ptr<MDAL::Mesh> loadDatasets( const std::string &meshFile, const std::string &datFile )
+{
+  std::unique_ptr<MDAL::Mesh> mesh = MDAL::DriverManager::instance().load( meshFile, "" );
+  EXPECT_TRUE( mesh );
+  if ( mesh )
+  {
+    MDAL::DriverManager::instance().loadDatasets( mesh.get(), datFile );
+    EXPECT_EQ( 2, mesh->datasetGroups.size() );
+  }
+  return mesh;
+}
+
+TEST( MdalStatisticsCacheTest, ReopenFile )
+{
+  const std::string meshFile = tmp_file( "/statistics_cache.2dm" );
+  const std::string datFile = tmp_file( "/statistics_cache.dat" );
+  copy( test_file( "/2dm/quad_and_triangle.2dm" ), meshFile );
+  copy( test_file( "/binary_dat/quad_and_triangle_binary.dat" ), datFile );
+  const std::string cacheFile = MDAL::StatisticsCache::cachePath( datFile );
+  EXPECT_EQ( datFile + ".mdalcache", cacheFile );
+  deleteFile( cacheFile );
+
+  MDAL::StatisticsCache::setEnabled( true );
+
+  MDAL::Statistics expected;
+  double expectedMedian = 0;
+  {
+    std::unique_ptr<MDAL::Mesh> mesh = loadDatasets( meshFile, datFile );
+    ASSERT_TRUE( mesh );
+    std::shared_ptr<MDAL::Dataset> dataset = mesh->datasetGroups[1]->datasets[0];
+    EXPECT_FALSE( dataset->hasStatistics() );
+
+    // nothing computed, nothing to write
+    MDAL::StatisticsCache::save( mesh->datasetGroups );
+    EXPECT_FALSE( MDAL::fileExists( cacheFile ) );
+
+    // the histogram is computed with the statistics and written in the cache with them
+    expected = dataset->statistics();
+    EXPECT_TRUE( dataset->hasHistogram() );
+    expectedMedian = dataset->histogram()->quantile( 0.5 );
+    MDAL::StatisticsCache::save( mesh->datasetGroups );
+    EXPECT_TRUE( MDAL::fileExists( cacheFile ) );
+  }
+
+  {
+    // read from the cache
+    std::unique_ptr<MDAL::Mesh> mesh = loadDatasets( meshFile, datFile );
+    ASSERT_TRUE( mesh );
+    std::shared_ptr<MDAL::Dataset> dataset = mesh->datasetGroups[1]->datasets[0];
+    EXPECT_TRUE( dataset->hasStatistics() );
+    EXPECT_DOUBLE_EQ( expected.minimum, dataset->statistics().minimum );
+    EXPECT_DOUBLE_EQ( expected.maximum, dataset->statistics().maximum );
+    EXPECT_TRUE( dataset->hasHistogram() );
+    EXPECT_DOUBLE_EQ( expectedMedian, dataset->histogram()->quantile( 0.5 ) );
+  }
+
+#if !defined(WIN32)
+  {
+    // the file is rewritten with the same size within the same second, the cache is ignored
+    struct stat st;
+    ASSERT_EQ( 0, stat( datFile.c_str(), &st ) );
+    struct timespec times[2];
+    times[0].tv_sec = times[1].tv_sec = st.st_mtime;
+    times[0].tv_nsec = times[1].tv_nsec = 123456789;
+    ASSERT_EQ( 0, utimensat( AT_FDCWD, datFile.c_str(), times, 0 ) );
+
+    std::unique_ptr<MDAL::Mesh> mesh = loadDatasets( meshFile, datFile );
+    ASSERT_TRUE( mesh );
+    std::shared_ptr<MDAL::Dataset> dataset = mesh->datasetGroups[1]->datasets[0];
+    EXPECT_FALSE( dataset->hasStatistics() );
+
+    // cached again for the new modification time
+    dataset->statistics();
+    MDAL::StatisticsCache::save( mesh->datasetGroups );
+  }
+  {
+    std::unique_ptr<MDAL::Mesh> mesh = loadDatasets( meshFile, datFile );
+    ASSERT_TRUE( mesh );
+    EXPECT_TRUE( mesh->datasetGroups[1]->datasets[0]->hasStatistics() );
+  }
+#endif
+
+  {
+    // the file changed, the cache is ignored
+    std::ofstream out( datFile, std::ofstream::out | std::ofstream::binary | std::ofstream::app );
+    out.write( "\0\0\0\0", 4 );
+  }
+  {
+    std::unique_ptr<MDAL::Mesh> mesh = loadDatasets( meshFile, datFile );
+    ASSERT_TRUE( mesh );
+    EXPECT_FALSE( mesh->datasetGroups[1]->datasets[0]->hasStatistics() );
+  }
+
+  MDAL::StatisticsCache::setEnabled( false );
+  deleteFile( cacheFile );
+  deleteFile( MDAL::StatisticsCache::cachePath( meshFile ) );
+  deleteFile( meshFile );
+  deleteFile( datFile );
+}
+
+TEST( MdalStatisticsCacheTest, CacheDirectory )
+{
+  MDAL::StatisticsCache::setDirectory( "/cache" );
+  const std::string path1 = MDAL::StatisticsCache::cachePath( "/data/a/results.dat" );
+  const std::string path2 = MDAL::StatisticsCache::cachePath( "/data/b/results.dat" );
+  EXPECT_TRUE( MDAL::startsWith( path1, "/cache/results.dat." ) );
+  EXPECT_TRUE( MDAL::endsWith( path1, ".mdalcache" ) );
+  EXPECT_NE( path1, path2 );
+
+  MDAL_SetStatisticsCacheDirectory( nullptr );
+  EXPECT_EQ( std::string(), MDAL_StatisticsCacheDirectory() );
+  EXPECT_EQ( "/data/a/results.dat.mdalcache", MDAL::StatisticsCache::cachePath( "/data/a/results.dat" ) );
+}
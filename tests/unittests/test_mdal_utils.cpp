@@ -7,10 +7,12 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include <thread>
 
 //mdal
 #include "mdal.h"
 #include "mdal_utils.hpp"
+#include "mdal_logger.hpp"
 #include "mdal_testutils.hpp"
 
 struct SplitTestData
@@ -359,3 +361,151 @@ TEST( MdalUtilsTest, LibraryTest )
   std::function<void ( int )> funct = library.getSymbol<int, int>( "function" );
   EXPECT_FALSE( funct );
 }
+
+TEST( MdalUtilsTest, ReadValues )
+{
+  std::vector<float> values = {1.5f, -2.25f, 3.0f, 1e6f};
+  std::string path = tmp_file( "/read_values.bin" );
+  {
+    std::ofstream out( path, std::ofstream::out | std::ofstream::binary );
+    out.write( reinterpret_cast<const char *>( values.data() ), static_cast<std::streamsize>( values.size() * sizeof( float ) ) );
+    std::vector<float> swapped = values;
+    MDAL::swapEndianness( swapped.data(), swapped.size() );
+    out.write( reinterpret_cast<const char *>( swapped.data() ), static_cast<std::streamsize>( swapped.size() * sizeof( float ) ) );
+  }
+
+  std::ifstream in( path, std::ifstream::in | std::ifstream::binary );
+  std::vector<double> buffer( values.size() );
+  ASSERT_TRUE( MDAL::readValues<float>( buffer.data(), values.size(), in ) );
+  for ( size_t i = 0; i < values.size(); ++i )
+    EXPECT_DOUBLE_EQ( static_cast<double>( values[i] ), buffer[i] );
+
+  ASSERT_TRUE( MDAL::readValues<float>( buffer.data(), values.size(), in, true ) );
+  for ( size_t i = 0; i < values.size(); ++i )
+    EXPECT_DOUBLE_EQ( static_cast<double>( values[i] ), buffer[i] );
+
+  // end of file reached
+  EXPECT_FALSE( MDAL::readValues<float>( buffer.data(), 1, in ) );
+  in.close();
+  deleteFile( path );
+}
+
+TEST( MdalUtilsTest, StreamPool )
+{
+  std::vector<int> values( 1000 );
+  for ( size_t i = 0; i < values.size(); ++i )
+    values[i] = static_cast<int>( i );
+  std::string path = tmp_file( "/stream_pool.bin" );
+  {
+    std::ofstream out( path, std::ofstream::out | std::ofstream::binary );
+    out.write( reinterpret_cast<const char *>( values.data() ), static_cast<std::streamsize>( values.size() * sizeof( int ) ) );
+  }
+
+  {
+    MDAL::StreamPool pool( path );
+    std::ifstream *first = nullptr;
+    {
+      MDAL::StreamPool::Stream stream1 = pool.acquire();
+      MDAL::StreamPool::Stream stream2 = pool.acquire();
+      first = &( *stream1 );
+      // streams in use are not shared
+      EXPECT_NE( first, &( *stream2 ) );
+
+      // read past the end of the file
+      int value;
+      stream1->seekg( static_cast<std::streamoff>( values.size() * sizeof( int ) ) );
+      EXPECT_FALSE( MDAL::readValue( value, *stream1 ) );
+    }
+
+    // the last released stream is reused, with its state cleared
+    {
+      MDAL::StreamPool::Stream stream = pool.acquire();
+      EXPECT_EQ( first, &( *stream ) );
+      EXPECT_TRUE( stream->good() );
+    }
+
+    // reads from different threads, each one at its own position
+    std::vector<int> sums( 4, 0 );
+    std::vector<std::thread> threads;
+    for ( size_t t = 0; t < sums.size(); ++t )
+    {
+      threads.emplace_back( [&pool, &sums, t]
+      {
+        for ( size_t i = t; i < 1000; i += 4 )
+        {
+          MDAL::StreamPool::Stream s = pool.acquire();
+          s->seekg( static_cast<std::streamoff>( i * sizeof( int ) ) );
+          int value = -1;
+          if ( MDAL::readValue( value, *s ) && value == static_cast<int>( i ) )
+            ++sums[t];
+        }
+      } );
+    }
+    for ( std::thread &thread : threads )
+      thread.join();
+    for ( int sum : sums )
+      EXPECT_EQ( 250, sum );
+
+    pool.clear();
+  }
+
+  deleteFile( path );
+}
+
+TEST( MdalUtilsTest, CalculateStatistics )
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  // more values than the accumulators of the kernel, with a remainder, extremes in both parts
+  std::vector<double> scalars;
+  for ( int i = 0; i < 21; ++i )
+    scalars.push_back( i % 3 == 0 ? nan : std::sin( i ) );
+  scalars[4] = -7.5;
+  scalars[19] = 12.25;
+  MDAL::Statistics stats = MDAL::calculateStatistics( scalars.data(), scalars.size(), false );
+  EXPECT_DOUBLE_EQ( -7.5, stats.minimum );
+  EXPECT_DOUBLE_EQ( 12.25, stats.maximum );
+
+  // only NaN values
+  std::vector<double> nans( 10, nan );
+  stats = MDAL::calculateStatistics( nans.data(), nans.size(), false );
+  EXPECT_TRUE( std::isnan( stats.minimum ) );
+  EXPECT_TRUE( std::isnan( stats.maximum ) );
+
+  stats = MDAL::calculateStatistics( nans.data(), 0, false );
+  EXPECT_TRUE( std::isnan( stats.minimum ) );
+
+  // vectors, a pair with one NaN component is ignored
+  std::vector<double> vectors;
+  for ( int i = 0; i < 11; ++i )
+  {
+    vectors.push_back( 3.0 + i );
+    vectors.push_back( -4.0 );
+  }
+  vectors[2 * 9 + 1] = nan;
+  vectors[2 * 10] = 0.5;
+  vectors[2 * 10 + 1] = 0;
+  stats = MDAL::calculateStatistics( vectors.data(), vectors.size() / 2, true );
+  EXPECT_DOUBLE_EQ( 0.5, stats.minimum );
+  EXPECT_DOUBLE_EQ( std::sqrt( 11.0 * 11.0 + 16.0 ), stats.maximum );
+}
+
+TEST( MdalUtilsTest, ParallelForLastStatus )
+{
+  MDAL::setThreadCount( 4 );
+  MDAL::Log::resetLastStatus();
+
+  // the failure happens in a worker thread, not in the first chunk run by the calling thread
+  MDAL::parallelFor( 400, 100, []( size_t begin, size_t )
+  {
+    if ( begin > 0 )
+      MDAL::Log::warning( MDAL_Status::Warn_InvalidElements, "worker failure" );
+  } );
+  EXPECT_EQ( MDAL_Status::Warn_InvalidElements, MDAL::Log::getLastStatus() );
+
+  MDAL::Log::resetLastStatus();
+  MDAL::parallelFor( 400, 100, []( size_t, size_t ) {} );
+  EXPECT_EQ( MDAL_Status::None, MDAL::Log::getLastStatus() );
+
+  MDAL::setThreadCount( 0 );
+}
@@ -14,6 +14,7 @@
 #include "mdal_external_driver.h"
 
 #include "limits.h"
+#include <limits>
 //-----------------------------------------------------------------
 //          Mesh structure
 